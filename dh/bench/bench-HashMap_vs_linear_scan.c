@@ -0,0 +1,115 @@
+#define main_no_args (1)
+#include "dh/main.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/HashMap.h"
+#include "dh/time.h"
+
+#include <stdio.h>
+
+/*========== Benchmark Configuration ========================================*/
+
+/* Same workload as bench-HashMap_vs_std_unordered_map.cpp */
+#define bench_seed       (0x5eedull)
+#define bench_lookups    (4 * 1000 * 1000)
+#define bench_linear_max (1024) // Linear scan beyond this takes minutes
+
+typedef struct bench_Entry {
+    u64 key;
+    u64 val;
+} bench_Entry;
+
+typedef struct bench_Result {
+    f64 secs;
+    u64 checksum; // Keeps lookups from being optimized away
+} bench_Result;
+use_Err$(bench_Result);
+
+use_HashMap$(u64, u64);
+
+/*========== Workload =======================================================*/
+
+/// SplitMix64, identical sequence in C and C++ benchmarks
+static fn_(bench_next(u64* state), u64) {
+    var z = (*state += 0x9E3779B97F4A7C15ull);
+    z     = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z     = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/// Half of the lookups hit an existing key, half miss
+static fn_(bench_lookupKey(u64* state, const bench_Entry* entries, usize len), u64) {
+    let r = bench_next(state);
+    return (r & 1) ? entries[(r >> 1) % len].key : r;
+}
+
+static fn_(bench_runLinearScan(const bench_Entry* entries, usize len), bench_Result) {
+    var state    = bench_seed;
+    var checksum = as$(u64, 0);
+    let start    = time_Instant_now();
+    for (usize op = 0; op < bench_lookups; ++op) {
+        let key = bench_lookupKey(&state, entries, len);
+        for (usize i = 0; i < len; ++i) {
+            if (entries[i].key == key) {
+                checksum += entries[i].val;
+                break;
+            }
+        }
+    }
+    return (bench_Result){
+        .secs     = time_Duration_asSecs_f64(time_Instant_elapsed(start)),
+        .checksum = checksum,
+    };
+}
+
+static fn_scope_ext(bench_runHashMap(const bench_Entry* entries, usize len), Err$bench_Result) {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(HashMap$u64$u64, try_(HashMap_initCap(typeInfo$(u64), typeInfo$(u64), (HashMap_Ctx){}, heap_Classic_allocator(&classic), len)));
+    defer_(HashMap_fini(map.base));
+    for (usize i = 0; i < len; ++i) {
+        var entry = entries[i];
+        try_(HashMap_put(map.base, meta_refPtr(&entry.key), meta_refPtr(&entry.val)));
+    }
+
+    var state    = bench_seed;
+    var checksum = as$(u64, 0);
+    let start    = time_Instant_now();
+    for (usize op = 0; op < bench_lookups; ++op) {
+        var key = bench_lookupKey(&state, entries, len);
+        let val = HashMap_getPtr(map.base, meta_refPtr(&key));
+        if (isSome(val)) {
+            checksum += *meta_castPtr$(u64*, unwrap(val));
+        }
+    }
+    return_ok({
+        .secs     = time_Duration_asSecs_f64(time_Instant_elapsed(start)),
+        .checksum = checksum,
+    });
+} unscoped_ext;
+
+fn_scope(dh_main(void), Err$void) {
+    static const usize key_counts[]   = { 16, 64, 256, 1024, 4096, 65536 };
+    static bench_Entry entries[65536] = {};
+    var                state          = bench_seed ^ 0xABCDull;
+    for (usize i = 0; i < countOf(entries); ++i) {
+        entries[i] = (bench_Entry){ .key = bench_next(&state), .val = i };
+    }
+
+    printf("lookups (50%% hit): %d ops\n", bench_lookups);
+    for (usize i = 0; i < countOf(key_counts); ++i) {
+        let len = key_counts[i];
+        let map = try_(bench_runHashMap(entries, len));
+        if (bench_linear_max < len) {
+            printf("  %6zu keys: linear scan %9s    HashMap %8.3f ms          [checksum %llu]\n",
+                len, "-", map.secs * 1000.0, as$(unsigned long long, map.checksum)
+            );
+            continue;
+        }
+        let linear = bench_runLinearScan(entries, len);
+        printf("  %6zu keys: linear scan %9.3f ms, HashMap %8.3f ms (%6.2fx) [checksum %llu%s]\n",
+            len, linear.secs * 1000.0, map.secs * 1000.0, linear.secs / map.secs,
+            as$(unsigned long long, map.checksum), linear.checksum == map.checksum ? "" : " MISMATCH"
+        );
+    }
+    return_ok({});
+} unscoped;
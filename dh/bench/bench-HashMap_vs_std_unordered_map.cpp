@@ -0,0 +1,64 @@
+// Baseline for bench-HashMap_vs_linear_scan.c: same keys, same lookup sequence,
+// timed with std::unordered_map (build with e.g. `c++ -O2 -std=c++17`).
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <unordered_map>
+
+/*========== Benchmark Configuration ========================================*/
+
+#define bench_seed    (0x5eedull)
+#define bench_lookups (4 * 1000 * 1000)
+
+struct bench_Entry {
+    uint64_t key;
+    uint64_t val;
+};
+
+/*========== Workload =======================================================*/
+
+/// SplitMix64, identical sequence in C and C++ benchmarks
+static uint64_t bench_next(uint64_t* state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+/// Half of the lookups hit an existing key, half miss
+static uint64_t bench_lookupKey(uint64_t* state, const bench_Entry* entries, size_t len) {
+    uint64_t r = bench_next(state);
+    return (r & 1) ? entries[(r >> 1) % len].key : r;
+}
+
+int main() {
+    static const size_t key_counts[]   = { 16, 64, 256, 1024, 4096, 65536 };
+    static bench_Entry  entries[65536] = {};
+    uint64_t            state          = bench_seed ^ 0xABCDull;
+    for (size_t i = 0; i < sizeof(entries) / sizeof(entries[0]); ++i) {
+        entries[i] = bench_Entry{ bench_next(&state), i };
+    }
+
+    std::printf("lookups (50%% hit): %d ops\n", bench_lookups);
+    for (size_t i = 0; i < sizeof(key_counts) / sizeof(key_counts[0]); ++i) {
+        size_t                                 len = key_counts[i];
+        std::unordered_map<uint64_t, uint64_t> map;
+        map.reserve(len);
+        for (size_t j = 0; j < len; ++j) {
+            map[entries[j].key] = entries[j].val;
+        }
+
+        uint64_t lookup_state = bench_seed;
+        uint64_t checksum     = 0;
+        auto     start        = std::chrono::steady_clock::now();
+        for (size_t op = 0; op < bench_lookups; ++op) {
+            auto it = map.find(bench_lookupKey(&lookup_state, entries, len));
+            if (it != map.end()) { checksum += it->second; }
+        }
+        std::chrono::duration<double> secs = std::chrono::steady_clock::now() - start;
+        std::printf("  %6zu keys: std::unordered_map %8.3f ms [checksum %llu]\n",
+            len, secs.count() * 1000.0, static_cast<unsigned long long>(checksum)
+        );
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+#define main_no_args (1)
+#include "dh/main.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/MpmcQueue.h"
+#include "dh/time.h"
+
+#include <pthread.h>
+#include <stdio.h>
+
+// -pthread
+
+/*========== Benchmark Configuration ========================================*/
+
+#define bench_ops         (4 * 1000 * 1000) // Items moved through the queue per run
+#define bench_cap         (1024)
+#define bench_threads_max (8) // Producers and consumers each, doubling from 1
+
+typedef struct bench_Worker {
+    MpmcQueue* queue;
+    usize      count;    // Items to push or pop
+    u64        checksum; // Sum of popped items, keeps pops from being optimized away
+} bench_Worker;
+
+typedef struct bench_Result {
+    f64 secs;
+    u64 checksum;
+} bench_Result;
+use_Err$(bench_Result);
+
+/*========== Workload =======================================================*/
+
+static void* bench_produce(void* arg) {
+    let worker = as$(bench_Worker*, arg);
+    for (u64 i = 0; i < worker->count; ++i) {
+        MpmcQueue_push(worker->queue, meta_refPtr(&i));
+    }
+    return null;
+}
+
+static void* bench_consume(void* arg) {
+    let worker   = as$(bench_Worker*, arg);
+    var checksum = as$(u64, 0);
+    for (usize i = 0; i < worker->count; ++i) {
+        var_(item, u64) = 0;
+        MpmcQueue_pop(worker->queue, meta_refPtr(&item));
+        checksum += item;
+    }
+    // Stored once, workers sit next to each other and would otherwise share cache lines
+    worker->checksum = checksum;
+    return null;
+}
+
+/// Run `threads` producers against `threads` consumers over one queue
+static fn_scope_ext(bench_run(usize threads), Err$bench_Result) {
+    var_(classic, heap_Classic) = {};
+    var queue                   = try_(MpmcQueue_init(typeInfo$(u64), bench_cap, heap_Classic_allocator(&classic)));
+    defer_(MpmcQueue_fini(&queue));
+
+    pthread_t    producers[bench_threads_max] = {};
+    pthread_t    consumers[bench_threads_max] = {};
+    bench_Worker workers[bench_threads_max]   = {};
+    bench_Worker feeders[bench_threads_max]   = {};
+    let          start                        = time_Instant_now();
+    for (usize i = 0; i < threads; ++i) {
+        feeders[i] = (bench_Worker){ .queue = &queue, .count = bench_ops / threads };
+        workers[i] = (bench_Worker){ .queue = &queue, .count = bench_ops / threads };
+        pthread_create(&producers[i], null, bench_produce, &feeders[i]);
+        pthread_create(&consumers[i], null, bench_consume, &workers[i]);
+    }
+    var checksum = as$(u64, 0);
+    for (usize i = 0; i < threads; ++i) {
+        pthread_join(producers[i], null);
+        pthread_join(consumers[i], null);
+        checksum += workers[i].checksum;
+    }
+    return_ok({
+        .secs     = time_Duration_asSecs_f64(time_Instant_elapsed(start)),
+        .checksum = checksum,
+    });
+} unscoped_ext;
+
+fn_scope(dh_main(void), Err$void) {
+    printf("MpmcQueue<u64> (cap %d): %d items per run\n", bench_cap, bench_ops);
+    for (usize threads = 1; threads <= bench_threads_max; threads *= 2) {
+        let result   = try_(bench_run(threads));
+        let per_side = as$(u64, bench_ops / threads);
+        let expected = as$(u64, threads) * (per_side * (per_side - 1) / 2);
+        printf("  %zu producer(s) x %zu consumer(s): %8.3f ms, %7.2f Mops/s [%s]\n",
+            threads, threads, result.secs * 1000.0, bench_ops / result.secs / 1e6,
+            result.checksum == expected ? "ok" : "MISMATCH"
+        );
+    }
+    return_ok({});
+} unscoped;
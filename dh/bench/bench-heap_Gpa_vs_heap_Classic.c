@@ -0,0 +1,76 @@
+#define main_no_args (1)
+#include "dh/main.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/heap/Gpa.h"
+#include "dh/mem/Allocator.h"
+#include "dh/time.h"
+#include "dh/Random.h"
+
+#include <stdio.h>
+
+/*========== Benchmark Configuration ========================================*/
+
+#define bench_seed        (0x5eed)
+#define bench_live_slots  (4096)
+#define bench_operations  (4 * 1000 * 1000)
+#define bench_large_every (256) // Roughly one in N requests exceeds the size classes
+
+typedef struct bench_Result {
+    f64   secs;
+    usize failed;
+} bench_Result;
+
+/*========== Mixed Alloc/Free Trace =========================================*/
+
+/// Random request size skewed towards small objects (as produced by ArrList/Str)
+static fn_(bench_nextSize(void), usize) {
+    if (Random_usize() % bench_large_every == 0) {
+        return 16 * 1024 + Random_usize() % (48 * 1024);
+    }
+    let shift = Random_usize() % 8; // 8..1024 bytes
+    return (as$(usize, 8) << shift) + Random_usize() % (as$(usize, 8) << shift);
+}
+
+static fn_(bench_runTrace(mem_Allocator allocator), bench_Result) {
+    static Sli$u8 live[bench_live_slots] = {};
+    usize         failed                 = 0;
+    Random_initWithSeed(bench_seed);
+
+    let start = time_Instant_now();
+    for (usize op = 0; op < bench_operations; ++op) {
+        let slot = Random_usize() % bench_live_slots;
+        if (live[slot].ptr != null) {
+            mem_Allocator_rawFree(allocator, live[slot], alignOf(usize));
+            live[slot] = (Sli$u8){};
+            continue;
+        }
+        let len = bench_nextSize();
+        if_some(mem_Allocator_rawAlloc(allocator, len, alignOf(usize)), ptr) {
+            ptr[0]     = as$(u8, op); // Touch memory like a real workload would
+            live[slot] = Sli_from$(Sli$u8, ptr, len);
+        } else_none {
+            failed += 1;
+        }
+    }
+    for (usize slot = 0; slot < bench_live_slots; ++slot) {
+        if (live[slot].ptr == null) { continue; }
+        mem_Allocator_rawFree(allocator, live[slot], alignOf(usize));
+        live[slot] = (Sli$u8){};
+    }
+    return (bench_Result){
+        .secs   = time_Duration_asSecs_f64(time_Instant_elapsed(start)),
+        .failed = failed,
+    };
+}
+
+fn_scope(dh_main(void), Err$void) {
+    let classic = bench_runTrace(heap_Classic_allocator(&(heap_Classic){}));
+    let gpa     = bench_runTrace(heap_Gpa_allocator(&(heap_Gpa){}));
+
+    printf("mixed alloc/free trace: %d ops, %d live slots\n", bench_operations, bench_live_slots);
+    printf("  heap_Classic: %8.3f ms (failed: %zu)\n", classic.secs * 1000.0, classic.failed);
+    printf("  heap_Gpa:     %8.3f ms (failed: %zu)\n", gpa.secs * 1000.0, gpa.failed);
+    printf("  speedup:      %8.2fx\n", classic.secs / gpa.secs);
+    return_ok({});
+} unscoped;
@@ -5,7 +5,7 @@
  * @file    ArrList.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2025-03-23 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.5
  * @ingroup dasae-headers(dh)
  * @prefix  ArrList
@@ -85,6 +85,8 @@ fn_(ArrList_fromOwnedSli(mem_Allocator allocator, meta_Sli slice), ArrList);
 fn_(ArrList_clone(const ArrList* self), mem_Allocator_Err$ArrList);
 
 /* Capacity Management */
+/// Grow capacity by the array list growth policy until it reaches minimum
+fn_(ArrList_growCap(usize current, usize minimum), usize);
 /// Ensure total capacity of the array list
 fn_(ArrList_ensureTotalCap(ArrList* self, usize new_cap), mem_Allocator_Err$void);
 /// Ensure precise total capacity of the array list
@@ -313,6 +315,15 @@ extern fn_(ArrList_fromOwnedSli(mem_Allocator allocator, meta_Sli slice), ArrLis
 ///     ArrList$i32 cloned = type$(ArrList$i32, try_(ArrList_clone(list.base)));
 extern fn_(ArrList_clone(const ArrList* self), $must_check mem_Allocator_Err$ArrList);
 
+/// @brief Grow capacity by the array list growth policy
+/// @param current Current capacity
+/// @param minimum Required capacity (greater than 0)
+/// @return Capacity of at least minimum
+/// @details Grows by about 1.5x, so other growable containers can follow the same policy
+/// @example
+///     let new_cap = ArrList_growCap(self->cap, self->len + 1);
+extern fn_(ArrList_growCap(usize current, usize minimum), usize);
+
 /// @brief Ensure total capacity of the list
 /// @param self Pointer to array list
 /// @param new_cap Desired capacity
@@ -0,0 +1,229 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    BTreeMap.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-17 (date of creation)
+ * @updated 2025-04-17 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  BTreeMap
+ *
+ * @brief   Ordered map implementation
+ * @details B+ tree keeping entries sorted by a comparison callback.
+ *          Entries live in linked leaves and inner nodes hold only separator keys
+ *          and children. Node capacities are chosen so a node spans a few cache lines,
+ *          which keeps the tree shallow and each node search within cached memory.
+ *          Cursors walk the leaf chain, so range scans cost O(log n + k).
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+BTreeMap         map = BTreeMap_init(typeInfo$(i64), typeInfo$(f32), wrapFn(cmpI64), allocator);                           // i64 -> f32
+BTreeMap$i64$f32 map = type$(BTreeMap$i64$f32, BTreeMap_init(typeInfo$(i64), typeInfo$(f32), wrapFn(cmpI64), allocator)); // Typed map
+
+/* Operations */
+BTreeMap_put(map.base, meta_refPtr(&key), meta_refPtr(&val));              // Insert or overwrite
+BTreeMap_getPtr(map.base, meta_refPtr(&key));                              // Optional pointer to value
+BTreeMap_remove(map.base, meta_refPtr(&key));                              // Remove entry
+var cursor = BTreeMap_range(map.base, meta_refPtr(&lo), meta_refPtr(&hi)); // Entries with lo <= key < hi
+BTreeMap_Cursor_next(&cursor);                                             // Next entry in key order
+BTreeMap_fini(map.base);                                                   // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef B_TREE_MAP_INCLUDED
+#define B_TREE_MAP_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+#include "sort.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Target size of a node in bytes (capacities are derived from key and value sizes)
+#define BTreeMap_node_size (512)
+
+#define use_BTreeMap$(K, V)                                                 \
+    /**                                                                     \
+     * @brief Declare and implement typed ordered map                       \
+     * @param K Type of keys                                                \
+     * @param V Type of values                                              \
+     * @example                                                             \
+     *     use_BTreeMap$(i64, f32); // Declare and implement i64 -> f32 map \
+     */                                                                     \
+    comp_type_gen__use_BTreeMap$(K, V)
+#define decl_BTreeMap$(K, V)                                         \
+    /**                                                              \
+     * @brief Declare typed ordered map structure                    \
+     * @param K Type of keys                                         \
+     * @param V Type of values                                       \
+     * @example                                                      \
+     *     decl_BTreeMap$(i64, f32); // Declare i64 -> f32 map union \
+     */                                                              \
+    comp_type_gen__decl_BTreeMap$(K, V)
+#define impl_BTreeMap$(K, V)                                                \
+    /**                                                                     \
+     * @brief Implement typed ordered map structure                         \
+     * @param K Type of keys                                                \
+     * @param V Type of values                                              \
+     * @example                                                             \
+     *     impl_BTreeMap$(i64, f32); // Implement previously declared union \
+     */                                                                     \
+    comp_type_gen__impl_BTreeMap$(K, V)
+
+#define BTreeMap$(K, V)                                                 \
+    /**                                                                 \
+     * @brief Create an ordered map type                                \
+     * @param K Type of keys                                            \
+     * @param V Type of values                                          \
+     * @return Ordered map type alias                                   \
+     * @example                                                         \
+     *     BTreeMap$(i64, f32) map; // Create ordered map of i64 -> f32 \
+     */                                                                 \
+    comp_type_alias__BTreeMap$(K, V)
+
+/// Node of the tree (layout computed from key and value types)
+typedef struct BTreeMap_Node BTreeMap_Node;
+
+/// @brief Ordered map structure
+/// @details Leaves hold `leaf_cap` keys and values, inner nodes hold `inner_cap` separator
+///          keys and one more child. Separator `i` bounds the keys of child `i + 1` from below.
+typedef struct BTreeMap {
+    TypeInfo       key_type;    ///< Type information for the keys
+    TypeInfo       val_type;    ///< Type information for the values
+    u32            leaf_cap;    ///< Maximum entries per leaf
+    u32            inner_cap;   ///< Maximum separator keys per inner node
+    u32            node_align;  ///< Alignment of nodes
+    usize          keys_offset; ///< Offset of keys within a node
+    usize          vals_offset; ///< Offset of values within a leaf
+    usize          kids_offset; ///< Offset of children within an inner node
+    usize          leaf_size;   ///< Size of a leaf
+    usize          inner_size;  ///< Size of an inner node
+    BTreeMap_Node* root;        ///< Root node (null while empty)
+    usize          height;      ///< Number of levels (0 while empty)
+    usize          len;         ///< Number of entries
+    sort_CmpFn     cmpFn;       ///< Ordering of keys
+    mem_Allocator  allocator;   ///< Memory allocator to use
+} BTreeMap;
+use_Opt$(BTreeMap);
+use_Err$(BTreeMap);
+use_ErrSet$(mem_Allocator_Err, BTreeMap);
+
+/// Entry of ordered map (pointers stay valid until next insert or remove)
+typedef struct BTreeMap_Entry {
+    meta_Ptr_const key; ///< Pointer to key
+    meta_Ptr       val; ///< Pointer to value
+} BTreeMap_Entry;
+use_Opt$(BTreeMap_Entry);
+
+/// Result of get or put
+typedef struct BTreeMap_GetOrPutResult {
+    meta_Ptr val;            ///< Pointer to value (uninitialized for new entries)
+    bool     found_existing; ///< Whether the key was already present
+} BTreeMap_GetOrPutResult;
+use_Err$(BTreeMap_GetOrPutResult);
+use_ErrSet$(mem_Allocator_Err, BTreeMap_GetOrPutResult);
+
+/// Position in key order with an exclusive end position (invalidated by insert or remove)
+typedef struct BTreeMap_Cursor {
+    const BTreeMap* map;       ///< Map to walk
+    BTreeMap_Node*  leaf;      ///< Leaf of current entry (null at the end of the map)
+    usize           index;     ///< Index of current entry within leaf
+    BTreeMap_Node*  end_leaf;  ///< Leaf of end position
+    usize           end_index; ///< Index of end position within leaf
+} BTreeMap_Cursor;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty map
+/// @param key_type Type information for the keys
+/// @param val_type Type information for the values (may be zero-sized)
+/// @param cmpFn Ordering of keys
+/// @param allocator Memory allocator to use
+/// @return Initialized ordered map
+extern fn_(BTreeMap_init(TypeInfo key_type, TypeInfo val_type, sort_CmpFn cmpFn, mem_Allocator allocator), BTreeMap);
+/// @brief Build map from keys in strictly ascending order and their values in O(n)
+/// @details Nodes are filled completely, except the last ones which share entries with their neighbors
+extern fn_(BTreeMap_initSorted(meta_Sli_const keys, meta_Sli_const vals, sort_CmpFn cmpFn, mem_Allocator allocator), $must_check mem_Allocator_Err$BTreeMap);
+/// @brief Free resources used by the map
+extern fn_(BTreeMap_fini(BTreeMap* self), void);
+
+/// @brief Check if key is present
+extern fn_(BTreeMap_contains(const BTreeMap* self, meta_Ptr key), bool);
+/// @brief Get pointer to value of key, or none if absent
+extern fn_(BTreeMap_getPtr(const BTreeMap* self, meta_Ptr key), Opt$meta_Ptr);
+
+/// @brief Insert entry or overwrite value of existing key
+extern fn_(BTreeMap_put(BTreeMap* self, meta_Ptr key, meta_Ptr val), $must_check mem_Allocator_Err$void);
+/// @brief Get pointer to value of key, inserting an entry with uninitialized value if absent
+extern fn_(BTreeMap_getOrPut(BTreeMap* self, meta_Ptr key), $must_check mem_Allocator_Err$BTreeMap_GetOrPutResult);
+/// @brief Remove entry of key
+/// @return Whether the key was present
+extern fn_(BTreeMap_remove(BTreeMap* self, meta_Ptr key), bool);
+/// @brief Remove all entries and free all nodes
+extern fn_(BTreeMap_clearAndFree(BTreeMap* self), void);
+
+/// @brief Cursor over all entries in key order
+/// @example
+///     var cursor = BTreeMap_iter(map.base);
+///     for (var entry = BTreeMap_Cursor_next(&cursor); isSome(entry); entry = BTreeMap_Cursor_next(&cursor)) { ... }
+extern fn_(BTreeMap_iter(const BTreeMap* self), BTreeMap_Cursor);
+/// @brief Cursor from the first key not less than `key` to the end
+extern fn_(BTreeMap_lowerBound(const BTreeMap* self, meta_Ptr key), BTreeMap_Cursor);
+/// @brief Cursor from the first key greater than `key` to the end
+extern fn_(BTreeMap_upperBound(const BTreeMap* self, meta_Ptr key), BTreeMap_Cursor);
+/// @brief Cursor over keys in [lo, hi)
+extern fn_(BTreeMap_range(const BTreeMap* self, meta_Ptr lo, meta_Ptr hi), BTreeMap_Cursor);
+/// @brief Get entry at cursor without advancing, or none at the end
+extern fn_(BTreeMap_Cursor_peek(const BTreeMap_Cursor* self), Opt$BTreeMap_Entry);
+/// @brief Get entry at cursor and advance to the next key
+extern fn_(BTreeMap_Cursor_next(BTreeMap_Cursor* self), Opt$BTreeMap_Entry);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_BTreeMap$(K, V) \
+    decl_BTreeMap$(K, V);                  \
+    impl_BTreeMap$(K, V)
+#define comp_type_gen__decl_BTreeMap$(K, V) \
+    typedef union BTreeMap$(K, V) BTreeMap$(K, V)
+#define comp_type_gen__impl_BTreeMap$(K, V) \
+    union BTreeMap$(K, V) {                 \
+        BTreeMap base[1];                   \
+        struct {                            \
+            TypeInfo       key_type;        \
+            TypeInfo       val_type;        \
+            u32            leaf_cap;        \
+            u32            inner_cap;       \
+            u32            node_align;      \
+            usize          keys_offset;     \
+            usize          vals_offset;     \
+            usize          kids_offset;     \
+            usize          leaf_size;       \
+            usize          inner_size;      \
+            BTreeMap_Node* root;            \
+            usize          height;          \
+            usize          len;             \
+            sort_CmpFn     cmpFn;           \
+            mem_Allocator  allocator;       \
+            rawptr$(K) __key_type_hint[0];  \
+            rawptr$(V) __val_type_hint[0];  \
+        };                                  \
+    }
+
+#define comp_type_alias__BTreeMap$(K, V) \
+    pp_join3($, BTreeMap, K, V)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* B_TREE_MAP_INCLUDED */
@@ -0,0 +1,172 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    BitSet.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-14 (date of creation)
+ * @updated 2025-04-14 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  BitSet
+ *
+ * @brief   Bit set implementation
+ * @details One bit per flag packed into 64-bit words (8x smaller than bool arrays).
+ *          BitSet is a view over words, either fixed storage from BitSet_fixed$
+ *          or the allocation of a DynBitSet. Whole-set operations process
+ *          several words at once with AVX2, SSE2 or NEON when available.
+ *          Bits past the length in the last word are kept zero.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+BitSet    visited = BitSet_fixed$(64 * 64);                 // Fixed storage of enclosing scope
+DynBitSet alive   = try_(DynBitSet_initEmpty(allocator, n)); // Allocated storage
+
+/* Operations */
+BitSet_set(visited, index);          // Set bit
+BitSet_isSet(visited, index);        // Test bit
+BitSet_or(alive.set, visited);       // Union into alive
+BitSet_count(alive.set);             // Number of set bits
+var iter = BitSet_iter(alive.set);   // Iterate set bits in ascending order
+DynBitSet_fini(&alive);              // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef BIT_SET_INCLUDED
+#define BIT_SET_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Storage unit of bits
+typedef u64 BitSet_Word;
+/// Bits per word
+#define BitSet_word_bits (64)
+
+#define BitSet_wordsFor(_bit_len)                              \
+    /**                                                        \
+     * @brief Number of words needed to hold bits              \
+     * @param _bit_len Number of bits                          \
+     * @return Word count                                      \
+     */                                                        \
+    comp_op__BitSet_wordsFor(_bit_len)
+#define BitSet_fixed$(N)                                     \
+    /**                                                      \
+     * @brief Create bit set with zeroed fixed storage       \
+     * @details Storage lives as long as the enclosing block \
+     * @param N Number of bits (constant expression)         \
+     * @return Bit set viewing the storage                   \
+     * @example                                              \
+     *     var visited = BitSet_fixed$(64 * 64);             \
+     */                                                      \
+    comp_op__BitSet_fixed$(N)
+
+/// @brief Bit set view structure
+/// @details Passed by value like a slice, operations write through `words`
+typedef struct BitSet {
+    BitSet_Word* words;   ///< Words holding the bits (bit i is bit i % 64 of word i / 64)
+    usize        bit_len; ///< Number of bits
+} BitSet;
+use_Opt$(BitSet);
+use_Err$(BitSet);
+
+/// Iterator over indices of set bits (ascending)
+typedef struct BitSet_Iter {
+    BitSet      set;        ///< Set to iterate over
+    usize       word_index; ///< Index of current word
+    BitSet_Word word;       ///< Remaining set bits of current word
+} BitSet_Iter;
+
+/// @brief Allocator-backed bit set structure
+typedef struct DynBitSet {
+    BitSet        set;       ///< View over the allocation
+    mem_Allocator allocator; ///< Memory allocator to use
+} DynBitSet;
+use_Opt$(DynBitSet);
+use_Err$(DynBitSet);
+use_ErrSet$(mem_Allocator_Err, DynBitSet);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Create bit set viewing existing words (bits past `bit_len` must be zero)
+extern fn_(BitSet_fromWords(BitSet_Word* words, usize bit_len), BitSet);
+
+/// @brief Check if bit is set
+extern fn_(BitSet_isSet(BitSet self, usize index), bool);
+/// @brief Set bit
+extern fn_(BitSet_set(BitSet self, usize index), void);
+/// @brief Unset bit
+extern fn_(BitSet_unset(BitSet self, usize index), void);
+/// @brief Toggle bit
+extern fn_(BitSet_toggle(BitSet self, usize index), void);
+/// @brief Set bit to value
+extern fn_(BitSet_setValue(BitSet self, usize index, bool value), void);
+
+/// @brief Set bits in [start, end) to value
+extern fn_(BitSet_setRangeValue(BitSet self, usize start, usize end, bool value), void);
+/// @brief Set all bits
+extern fn_(BitSet_setAll(BitSet self), void);
+/// @brief Unset all bits
+extern fn_(BitSet_unsetAll(BitSet self), void);
+/// @brief Toggle all bits
+extern fn_(BitSet_toggleAll(BitSet self), void);
+
+/// @brief Set bits of `self` that are set in `other` (union, same length)
+extern fn_(BitSet_or(BitSet self, BitSet other), void);
+/// @brief Keep bits of `self` that are set in `other` (intersection, same length)
+extern fn_(BitSet_and(BitSet self, BitSet other), void);
+/// @brief Toggle bits of `self` that are set in `other` (symmetric difference, same length)
+extern fn_(BitSet_xor(BitSet self, BitSet other), void);
+/// @brief Unset bits of `self` that are set in `other` (difference, same length)
+extern fn_(BitSet_andNot(BitSet self, BitSet other), void);
+
+/// @brief Count set bits
+extern fn_(BitSet_count(BitSet self), usize);
+/// @brief Check if sets have the same length and bits
+extern fn_(BitSet_eql(BitSet self, BitSet other), bool);
+/// @brief Get index of lowest set bit, or none if no bit is set
+extern fn_(BitSet_findFirstSet(BitSet self), Opt$usize);
+
+/// @brief Iterate over set bits
+/// @example
+///     var iter = BitSet_iter(set);
+///     for (var index = BitSet_Iter_next(&iter); isSome(index); index = BitSet_Iter_next(&iter)) { ... }
+extern fn_(BitSet_iter(BitSet self), BitSet_Iter);
+/// @brief Advance iterator to next set bit
+extern fn_(BitSet_Iter_next(BitSet_Iter* self), Opt$usize);
+
+/// @brief Initialize empty set of zero length
+extern fn_(DynBitSet_init(mem_Allocator allocator), DynBitSet);
+/// @brief Initialize set of `bit_len` unset bits
+extern fn_(DynBitSet_initEmpty(mem_Allocator allocator, usize bit_len), $must_check mem_Allocator_Err$DynBitSet);
+/// @brief Initialize set of `bit_len` set bits
+extern fn_(DynBitSet_initFull(mem_Allocator allocator, usize bit_len), $must_check mem_Allocator_Err$DynBitSet);
+/// @brief Free resources used by the set
+extern fn_(DynBitSet_fini(DynBitSet* self), void);
+/// @brief Change length, new bits take `fill`
+extern fn_(DynBitSet_resize(DynBitSet* self, usize new_len, bool fill), $must_check mem_Allocator_Err$void);
+/// @brief Copy set into new allocation
+extern fn_(DynBitSet_clone(const DynBitSet* self, mem_Allocator allocator), $must_check mem_Allocator_Err$DynBitSet);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_op__BitSet_wordsFor(_bit_len) \
+    (((_bit_len) + BitSet_word_bits - 1) / BitSet_word_bits)
+#define comp_op__BitSet_fixed$(N) \
+    ((BitSet){ .words = (BitSet_Word[BitSet_wordsFor(N)]){ 0 }, .bit_len = (N) })
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* BIT_SET_INCLUDED */
@@ -0,0 +1,187 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Deque.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-11 (date of creation)
+ * @updated 2025-04-11 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  Deque
+ *
+ * @brief   Double-ended queue implementation
+ * @details Growable ring buffer with power-of-two capacity, so pushing and popping
+ *          at either end is O(1) (unlike ArrList_prepend/ArrList_shift, which move every item).
+ *          Items occupy at most two contiguous runs of the buffer.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+Deque      deque = Deque_init(typeInfo$(i32), allocator);                   // Initialize empty deque
+Deque$i32  deque = type$(Deque$i32, Deque_init(typeInfo$(i32), allocator)); // Typed deque
+
+/* Operations */
+Deque_pushBack(deque.base, meta_refPtr(&item));  // Add item to back
+Deque_pushFront(deque.base, meta_refPtr(&item)); // Add item to front
+Deque_popFront(deque.base);                      // Optional pointer to removed front item
+Deque_popBack(deque.base);                       // Optional pointer to removed back item
+Deque_halves(deque.base);                        // Items as two contiguous slices
+Deque_fini(deque.base);                          // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef DEQUE_INCLUDED
+#define DEQUE_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_Deque$(T)                                           \
+    /**                                                         \
+     * @brief Declare and implement typed deque                 \
+     * @param T Type of items                                   \
+     * @example                                                 \
+     *     use_Deque$(i32); // Declare and implement i32 deque  \
+     */                                                         \
+    comp_type_gen__use_Deque$(T)
+#define decl_Deque$(T)                                      \
+    /**                                                     \
+     * @brief Declare typed deque structure                 \
+     * @param T Type of items                               \
+     * @example                                             \
+     *     decl_Deque$(i32); // Declare i32 deque union     \
+     */                                                     \
+    comp_type_gen__decl_Deque$(T)
+#define impl_Deque$(T)                                                \
+    /**                                                               \
+     * @brief Implement typed deque structure                         \
+     * @param T Type of items                                         \
+     * @example                                                       \
+     *     impl_Deque$(i32); // Implement previously declared union   \
+     */                                                               \
+    comp_type_gen__impl_Deque$(T)
+
+#define Deque$(T)                                         \
+    /**                                                   \
+     * @brief Create a deque type                         \
+     * @param T Type of items                             \
+     * @return Deque type alias                           \
+     * @example                                           \
+     *     Deque$(i32) deque; // Create a deque of i32    \
+     */                                                   \
+    comp_type_alias__Deque$(T)
+
+/// @brief Double-ended queue structure
+/// @details Item `i` lives at `buf[(head + i) & (cap - 1)]`
+typedef struct Deque {
+    TypeInfo      type;      ///< Type information for the items
+    anyptr        buf;       ///< Ring buffer (cap items)
+    usize         head;      ///< Buffer index of front item
+    usize         len;       ///< Number of items
+    usize         cap;       ///< Capacity of buffer (zero or power of two)
+    mem_Allocator allocator; ///< Memory allocator to use
+} Deque;
+use_Opt$(Deque);
+use_Err$(Deque);
+use_ErrSet$(mem_Allocator_Err, Deque);
+
+/// Items in order as two contiguous runs (second is empty unless the items wrap around)
+typedef struct Deque_Halves {
+    meta_Sli first;  ///< Items from front up to end of buffer
+    meta_Sli second; ///< Remaining items from start of buffer
+} Deque_Halves;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty deque
+/// @param type Type information for the items
+/// @param allocator Memory allocator to use
+/// @return Initialized deque
+/// @example
+///     Deque$i32 deque = type$(Deque$i32, Deque_init(typeInfo$(i32), allocator));
+extern fn_(Deque_init(TypeInfo type, mem_Allocator allocator), Deque);
+/// @brief Initialize deque with capacity for at least `cap` items
+extern fn_(Deque_initCap(TypeInfo type, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$Deque);
+/// @brief Free resources used by the deque
+extern fn_(Deque_fini(Deque* self), void);
+
+/// @brief Ensure the deque holds `new_cap` items without growing
+/// @details Growing keeps items in place when the allocator resizes in place,
+///          otherwise copies them to the new buffer in order (at most two copies)
+extern fn_(Deque_ensureTotalCap(Deque* self, usize new_cap), $must_check mem_Allocator_Err$void);
+/// @brief Ensure the deque holds `additional` more items without growing
+extern fn_(Deque_ensureUnusedCap(Deque* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Get pointer to item at position (0 is front)
+extern fn_(Deque_at(const Deque* self, usize index), meta_Ptr);
+/// @brief Get pointer to front item, or none if empty
+extern fn_(Deque_front(const Deque* self), Opt$meta_Ptr);
+/// @brief Get pointer to back item, or none if empty
+extern fn_(Deque_back(const Deque* self), Opt$meta_Ptr);
+/// @brief Get items as two contiguous slices
+/// @example
+///     let halves = Deque_halves(deque.base);
+///     process(halves.first);
+///     process(halves.second);
+extern fn_(Deque_halves(const Deque* self), Deque_Halves);
+
+/// @brief Add item to back
+extern fn_(Deque_pushBack(Deque* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add item to front
+extern fn_(Deque_pushFront(Deque* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add uninitialized item to back and get pointer to it
+extern fn_(Deque_addBackOne(Deque* self), $must_check mem_Allocator_Err$meta_Ptr);
+/// @brief Add uninitialized item to front and get pointer to it
+extern fn_(Deque_addFrontOne(Deque* self), $must_check mem_Allocator_Err$meta_Ptr);
+/// @brief Remove back item
+/// @return Pointer to removed item (valid until next push), or none if empty
+/// @example
+///     Opt$Ptr$i32 item = meta_castOpt$(Opt$Ptr$i32, Deque_popBack(deque.base));
+extern fn_(Deque_popBack(Deque* self), Opt$meta_Ptr);
+/// @brief Remove front item
+/// @return Pointer to removed item (valid until next push), or none if empty
+extern fn_(Deque_popFront(Deque* self), Opt$meta_Ptr);
+
+/// @brief Remove all items and retain the allocated capacity
+extern fn_(Deque_clearRetainingCap(Deque* self), void);
+/// @brief Remove all items and free all allocated memory
+extern fn_(Deque_clearAndFree(Deque* self), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_Deque$(T) \
+    decl_Deque$(T);                  \
+    impl_Deque$(T)
+#define comp_type_gen__decl_Deque$(T) \
+    typedef union Deque$(T) Deque$(T)
+#define comp_type_gen__impl_Deque$(T) \
+    union Deque$(T) {                 \
+        Deque base[1];                \
+        struct {                      \
+            TypeInfo      type;       \
+            T*            buf;        \
+            usize         head;       \
+            usize         len;        \
+            usize         cap;        \
+            mem_Allocator allocator;  \
+        };                            \
+    }
+
+#define comp_type_alias__Deque$(T) \
+    pp_join($, Deque, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* DEQUE_INCLUDED */
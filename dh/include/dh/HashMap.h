@@ -0,0 +1,245 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    HashMap.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-09 (date of creation)
+ * @updated 2025-04-09 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  HashMap
+ *
+ * @brief   Open-addressing hash map implementation
+ * @details SwissTable-style hash map storing key-value entries in a flat array.
+ *          Each slot has a control byte holding 7 bits of its hash (or empty/deleted),
+ *          and lookups compare a whole group of control bytes at once
+ *          (SSE2 or NEON when available, 64-bit SWAR otherwise) before touching keys.
+ *          Keys are hashed and compared bytewise unless a hash/eql callback pair is given.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+HashMap               map = HashMap_init(typeInfo$(i32), typeInfo$(f32), (HashMap_Ctx){}, allocator);                        // Bytewise keys
+HashMap$i32$f32       map = type$(HashMap$i32$f32, HashMap_init(typeInfo$(i32), typeInfo$(f32), (HashMap_Ctx){}, allocator)); // Typed map
+HashMap$Str_const$i32 map = type$(HashMap$Str_const$i32, HashMap_init(typeInfo$(Str_const), typeInfo$(i32), HashMap_Ctx_str(), allocator)); // String keys
+
+/* Operations */
+HashMap_put(map.base, meta_refPtr(&key), meta_refPtr(&val)); // Insert or overwrite
+HashMap_getPtr(map.base, meta_refPtr(&key));                 // Optional pointer to value
+HashMap_getOrPut(map.base, meta_refPtr(&key));               // Pointer to existing or new entry
+HashMap_remove(map.base, meta_refPtr(&key));                 // Remove entry
+HashMap_fini(map.base);                                      // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef HASH_MAP_INCLUDED
+#define HASH_MAP_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "callback.h"
+#include "mem/Allocator.h"
+#include "Str.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_HashMap$(K, V)                                                 \
+    /**                                                                    \
+     * @brief Declare and implement typed hash map                         \
+     * @param K Type of keys                                               \
+     * @param V Type of values                                             \
+     * @example                                                            \
+     *     use_HashMap$(i32, f32); // Declare and implement i32 -> f32 map \
+     */                                                                    \
+    comp_type_gen__use_HashMap$(K, V)
+#define decl_HashMap$(K, V)                                          \
+    /**                                                              \
+     * @brief Declare typed hash map structure                       \
+     * @param K Type of keys                                         \
+     * @param V Type of values                                       \
+     * @example                                                      \
+     *     decl_HashMap$(i32, f32); // Declare i32 -> f32 map union  \
+     */                                                              \
+    comp_type_gen__decl_HashMap$(K, V)
+#define impl_HashMap$(K, V)                                                  \
+    /**                                                                      \
+     * @brief Implement typed hash map structure                             \
+     * @param K Type of keys                                                 \
+     * @param V Type of values                                               \
+     * @example                                                              \
+     *     impl_HashMap$(i32, f32); // Implement previously declared union   \
+     */                                                                      \
+    comp_type_gen__impl_HashMap$(K, V)
+
+#define HashMap$(K, V)                                                  \
+    /**                                                                 \
+     * @brief Create a hash map type                                    \
+     * @param K Type of keys                                            \
+     * @param V Type of values                                          \
+     * @return Hash map type alias                                      \
+     * @example                                                         \
+     *     HashMap$(i32, f32) map; // Create a map from i32 to f32      \
+     */                                                                 \
+    comp_type_alias__HashMap$(K, V)
+
+/// Hash callback (any 64-bit hash, it is finalized by the map)
+use_Callback(HashMap_HashFn, (anyptr_const key), u64);
+/// Key equality callback
+use_Callback(HashMap_EqlFn, (anyptr_const lhs, anyptr_const rhs), bool);
+
+/// @brief Hash and equality of keys
+/// @details Zero-initialized context hashes and compares keys bytewise
+typedef struct HashMap_Ctx {
+    HashMap_HashFn hashFn; ///< Hash of key
+    HashMap_EqlFn  eqlFn;  ///< Equality of keys
+} HashMap_Ctx;
+
+/// @brief Open-addressing hash map structure
+/// @details Entries are laid out as `struct { K key; V val; }` in a single allocation
+///          followed by one control byte per slot (plus one mirrored group)
+typedef struct HashMap {
+    TypeInfo      key_type;    ///< Type information for the keys
+    TypeInfo      val_type;    ///< Type information for the values
+    usize         val_offset;  ///< Offset of value within entry
+    usize         entry_size;  ///< Size of entry (key and value)
+    u8*           ctrls;       ///< Control bytes (cap + group width)
+    anyptr        entries;     ///< Key-value entries (cap)
+    usize         cap;         ///< Number of slots (zero or power of two)
+    usize         len;         ///< Number of entries
+    usize         growth_left; ///< Inserts into empty slots left before rehash
+    HashMap_Ctx   ctx;         ///< Hash and equality of keys
+    mem_Allocator allocator;   ///< Memory allocator to use
+} HashMap;
+use_Opt$(HashMap);
+use_Err$(HashMap);
+use_ErrSet$(mem_Allocator_Err, HashMap);
+
+/// Entry of hash map (pointers stay valid until next insert or remove)
+typedef struct HashMap_Entry {
+    meta_Ptr key; ///< Pointer to key
+    meta_Ptr val; ///< Pointer to value
+} HashMap_Entry;
+use_Opt$(HashMap_Entry);
+
+/// Result of get or put
+typedef struct HashMap_GetOrPutResult {
+    meta_Ptr key;            ///< Pointer to key
+    meta_Ptr val;            ///< Pointer to value (uninitialized for new entries)
+    bool     found_existing; ///< Whether the key was already present
+} HashMap_GetOrPutResult;
+use_Err$(HashMap_GetOrPutResult);
+use_ErrSet$(mem_Allocator_Err, HashMap_GetOrPutResult);
+
+/// Iterator over entries (in unspecified order)
+typedef struct HashMap_Iter {
+    const HashMap* map;   ///< Map to iterate over
+    usize          index; ///< Next slot to visit
+} HashMap_Iter;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty map
+/// @param key_type Type information for the keys
+/// @param val_type Type information for the values (may be zero-sized, see HashSet)
+/// @param ctx Hash and equality of keys (zero for bytewise)
+/// @param allocator Memory allocator to use
+/// @return Initialized hash map
+/// @example
+///     HashMap$i32$f32 map = type$(HashMap$i32$f32, HashMap_init(typeInfo$(i32), typeInfo$(f32), (HashMap_Ctx){}, allocator));
+extern fn_(HashMap_init(TypeInfo key_type, TypeInfo val_type, HashMap_Ctx ctx, mem_Allocator allocator), HashMap);
+/// @brief Initialize map with capacity for at least `cap` entries
+extern fn_(HashMap_initCap(TypeInfo key_type, TypeInfo val_type, HashMap_Ctx ctx, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$HashMap);
+/// @brief Free resources used by the map
+extern fn_(HashMap_fini(HashMap* self), void);
+
+/// @brief Ensure the map holds `new_len` entries without rehashing
+extern fn_(HashMap_ensureTotalCap(HashMap* self, usize new_len), $must_check mem_Allocator_Err$void);
+/// @brief Ensure the map holds `additional` more entries without rehashing
+extern fn_(HashMap_ensureUnusedCap(HashMap* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Check if the map contains a key
+extern fn_(HashMap_contains(const HashMap* self, meta_Ptr key), bool);
+/// @brief Get pointer to value of a key, or none if absent
+/// @example
+///     Opt$Ptr$f32 val = meta_castOpt$(Opt$Ptr$f32, HashMap_getPtr(map.base, meta_refPtr(&key)));
+extern fn_(HashMap_getPtr(const HashMap* self, meta_Ptr key), Opt$meta_Ptr);
+/// @brief Get entry of a key, or none if absent
+extern fn_(HashMap_getEntry(const HashMap* self, meta_Ptr key), Opt$HashMap_Entry);
+
+/// @brief Insert entry, overwriting value of existing key
+extern fn_(HashMap_put(HashMap* self, meta_Ptr key, meta_Ptr val), $must_check mem_Allocator_Err$void);
+/// @brief Get entry of a key, inserting it (with uninitialized value) if absent
+/// @details Lets callers update in place with a single lookup
+/// @example
+///     let result = try_(HashMap_getOrPut(map.base, meta_refPtr(&key)));
+///     if (!result.found_existing) { *meta_castPtr$(i32*, result.val) = 0; }
+///     *meta_castPtr$(i32*, result.val) += 1;
+extern fn_(HashMap_getOrPut(HashMap* self, meta_Ptr key), $must_check mem_Allocator_Err$HashMap_GetOrPutResult);
+/// @brief Remove entry of a key
+/// @return Whether the key was present
+extern fn_(HashMap_remove(HashMap* self, meta_Ptr key), bool);
+
+/// @brief Remove all entries and retain the allocated capacity
+extern fn_(HashMap_clearRetainingCap(HashMap* self), void);
+/// @brief Remove all entries and free all allocated memory
+extern fn_(HashMap_clearAndFree(HashMap* self), void);
+
+/// @brief Iterate over entries
+/// @example
+///     var iter = HashMap_iter(map.base);
+///     for (var entry = HashMap_Iter_next(&iter); isSome(entry); entry = HashMap_Iter_next(&iter)) { ... }
+extern fn_(HashMap_iter(const HashMap* self), HashMap_Iter);
+/// @brief Advance iterator to next entry
+extern fn_(HashMap_Iter_next(HashMap_Iter* self), Opt$HashMap_Entry);
+
+/// @brief Hash of Str_const key (via Str_hash)
+extern fn_(HashMap_hashStr(anyptr_const key), u64);
+/// @brief Equality of Str_const keys
+extern fn_(HashMap_eqlStr(anyptr_const lhs, anyptr_const rhs), bool);
+/// Context for Str_const keys (contents are hashed and compared, not pointers)
+#define HashMap_Ctx_str() \
+    ((HashMap_Ctx){ .hashFn = wrapFn(HashMap_hashStr), .eqlFn = wrapFn(HashMap_eqlStr) })
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_HashMap$(K, V) \
+    decl_HashMap$(K, V);                  \
+    impl_HashMap$(K, V)
+#define comp_type_gen__decl_HashMap$(K, V) \
+    typedef union HashMap$(K, V) HashMap$(K, V)
+#define comp_type_gen__impl_HashMap$(K, V) \
+    union HashMap$(K, V) {                 \
+        HashMap base[1];                   \
+        struct {                           \
+            TypeInfo key_type;             \
+            TypeInfo val_type;             \
+            usize    val_offset;           \
+            usize    entry_size;           \
+            u8*      ctrls;                \
+            struct {                       \
+                K key;                     \
+                V val;                     \
+            }* entries;                    \
+            usize         cap;             \
+            usize         len;             \
+            usize         growth_left;     \
+            HashMap_Ctx   ctx;             \
+            mem_Allocator allocator;       \
+        };                                 \
+    }
+
+#define comp_type_alias__HashMap$(K, V) \
+    pp_join3($, HashMap, K, V)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HASH_MAP_INCLUDED */
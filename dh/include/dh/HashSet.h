@@ -0,0 +1,164 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    HashSet.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-10 (date of creation)
+ * @updated 2025-04-10 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  HashSet
+ *
+ * @brief   Hash set implementation
+ * @details HashMap with zero-sized values, so each slot holds only the element.
+ *          Elements are hashed and compared like HashMap keys (see HashMap_Ctx).
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+HashSet      set = HashSet_init(typeInfo$(i32), (HashMap_Ctx){}, allocator);                     // Bytewise elements
+HashSet$i32  set = type$(HashSet$i32, HashSet_init(typeInfo$(i32), (HashMap_Ctx){}, allocator)); // Typed set
+
+/* Operations */
+HashSet_insert(set.base, meta_refPtr(&elem));   // Insert, true if newly added
+HashSet_contains(set.base, meta_refPtr(&elem)); // Membership test
+HashSet_remove(set.base, meta_refPtr(&elem));   // Remove, true if present
+HashSet_fini(set.base);                         // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef HASH_SET_INCLUDED
+#define HASH_SET_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "HashMap.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_HashSet$(T)                                             \
+    /**                                                             \
+     * @brief Declare and implement typed hash set                  \
+     * @param T Type of elements                                    \
+     * @example                                                     \
+     *     use_HashSet$(i32); // Declare and implement i32 set      \
+     */                                                             \
+    comp_type_gen__use_HashSet$(T)
+#define decl_HashSet$(T)                                        \
+    /**                                                         \
+     * @brief Declare typed hash set structure                  \
+     * @param T Type of elements                                \
+     * @example                                                 \
+     *     decl_HashSet$(i32); // Declare i32 set union         \
+     */                                                         \
+    comp_type_gen__decl_HashSet$(T)
+#define impl_HashSet$(T)                                                \
+    /**                                                                 \
+     * @brief Implement typed hash set structure                        \
+     * @param T Type of elements                                        \
+     * @example                                                         \
+     *     impl_HashSet$(i32); // Implement previously declared union   \
+     */                                                                 \
+    comp_type_gen__impl_HashSet$(T)
+
+#define HashSet$(T)                                              \
+    /**                                                          \
+     * @brief Create a hash set type                             \
+     * @param T Type of elements                                 \
+     * @return Hash set type alias                               \
+     * @example                                                  \
+     *     HashSet$(i32) set; // Create a set of i32             \
+     */                                                          \
+    comp_type_alias__HashSet$(T)
+
+/// @brief Hash set structure
+/// @details Same layout as HashMap with zero-sized values (entries are the elements)
+typedef struct HashSet {
+    HashMap map; ///< Underlying map
+} HashSet;
+use_Opt$(HashSet);
+use_Err$(HashSet);
+use_ErrSet$(mem_Allocator_Err, HashSet);
+use_ErrSet$(mem_Allocator_Err, bool);
+
+/// Iterator over elements (in unspecified order)
+typedef struct HashSet_Iter {
+    HashMap_Iter map_iter; ///< Iterator of underlying map
+} HashSet_Iter;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty set
+/// @param elem_type Type information for the elements
+/// @param ctx Hash and equality of elements (zero for bytewise)
+/// @param allocator Memory allocator to use
+/// @return Initialized hash set
+extern fn_(HashSet_init(TypeInfo elem_type, HashMap_Ctx ctx, mem_Allocator allocator), HashSet);
+/// @brief Initialize set with capacity for at least `cap` elements
+extern fn_(HashSet_initCap(TypeInfo elem_type, HashMap_Ctx ctx, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$HashSet);
+/// @brief Free resources used by the set
+extern fn_(HashSet_fini(HashSet* self), void);
+
+/// @brief Ensure the set holds `new_len` elements without rehashing
+extern fn_(HashSet_ensureTotalCap(HashSet* self, usize new_len), $must_check mem_Allocator_Err$void);
+/// @brief Ensure the set holds `additional` more elements without rehashing
+extern fn_(HashSet_ensureUnusedCap(HashSet* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Check if the set contains an element
+extern fn_(HashSet_contains(const HashSet* self, meta_Ptr elem), bool);
+/// @brief Insert an element
+/// @return Whether the element was newly added
+/// @example
+///     if (!try_(HashSet_insert(visited.base, meta_refPtr(&pos)))) { continue; } // Already visited
+extern fn_(HashSet_insert(HashSet* self, meta_Ptr elem), $must_check mem_Allocator_Err$bool);
+/// @brief Remove an element
+/// @return Whether the element was present
+extern fn_(HashSet_remove(HashSet* self, meta_Ptr elem), bool);
+
+/// @brief Remove all elements and retain the allocated capacity
+extern fn_(HashSet_clearRetainingCap(HashSet* self), void);
+/// @brief Remove all elements and free all allocated memory
+extern fn_(HashSet_clearAndFree(HashSet* self), void);
+
+/// @brief Iterate over elements
+extern fn_(HashSet_iter(const HashSet* self), HashSet_Iter);
+/// @brief Advance iterator to next element
+extern fn_(HashSet_Iter_next(HashSet_Iter* self), Opt$meta_Ptr);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_HashSet$(T) \
+    decl_HashSet$(T);                  \
+    impl_HashSet$(T)
+#define comp_type_gen__decl_HashSet$(T) \
+    typedef union HashSet$(T) HashSet$(T)
+#define comp_type_gen__impl_HashSet$(T) \
+    union HashSet$(T) {                 \
+        HashSet base[1];                \
+        struct {                        \
+            TypeInfo      elem_type;    \
+            TypeInfo      val_type;     \
+            usize         val_offset;   \
+            usize         entry_size;   \
+            u8*           ctrls;        \
+            T*            elems;        \
+            usize         cap;          \
+            usize         len;          \
+            usize         growth_left;  \
+            HashMap_Ctx   ctx;          \
+            mem_Allocator allocator;    \
+        };                              \
+    }
+
+#define comp_type_alias__HashSet$(T) \
+    pp_join($, HashSet, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HASH_SET_INCLUDED */
@@ -0,0 +1,205 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    IntMap.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-10 (date of creation)
+ * @updated 2025-04-10 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  IntMap
+ *
+ * @brief   Hash map specialized for u32/u64 keys
+ * @details Linear probing over entries with keys stored inline, hashed by a
+ *          Fibonacci multiply (no hash/eql callbacks). Key zero marks an empty
+ *          slot, so the entry of key zero itself lives in one extra slot past
+ *          the table. Removal shifts following entries back instead of leaving
+ *          tombstones, so probe sequences never degrade over time.
+ *          Zero-sized values make it an integer set.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+IntMap          map = IntMap_init(typeInfo$(u32), typeInfo$(f32), allocator);                         // u32 -> f32
+IntMap$u64$i32  map = type$(IntMap$u64$i32, IntMap_init(typeInfo$(u64), typeInfo$(i32), allocator)); // Typed map
+
+/* Operations */
+IntMap_put(map.base, key, meta_refPtr(&val)); // Insert or overwrite
+IntMap_getPtr(map.base, key);                 // Optional pointer to value
+IntMap_getOrPut(map.base, key);               // Pointer to existing or new value
+IntMap_remove(map.base, key);                 // Remove entry
+IntMap_fini(map.base);                        // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef INT_MAP_INCLUDED
+#define INT_MAP_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_IntMap$(K, V)                                                  \
+    /**                                                                    \
+     * @brief Declare and implement typed integer map                      \
+     * @param K Type of keys (u32 or u64)                                  \
+     * @param V Type of values                                             \
+     * @example                                                            \
+     *     use_IntMap$(u32, f32); // Declare and implement u32 -> f32 map  \
+     */                                                                    \
+    comp_type_gen__use_IntMap$(K, V)
+#define decl_IntMap$(K, V)                                          \
+    /**                                                             \
+     * @brief Declare typed integer map structure                   \
+     * @param K Type of keys (u32 or u64)                           \
+     * @param V Type of values                                      \
+     * @example                                                     \
+     *     decl_IntMap$(u32, f32); // Declare u32 -> f32 map union  \
+     */                                                             \
+    comp_type_gen__decl_IntMap$(K, V)
+#define impl_IntMap$(K, V)                                                  \
+    /**                                                                     \
+     * @brief Implement typed integer map structure                         \
+     * @param K Type of keys (u32 or u64)                                   \
+     * @param V Type of values                                              \
+     * @example                                                             \
+     *     impl_IntMap$(u32, f32); // Implement previously declared union   \
+     */                                                                     \
+    comp_type_gen__impl_IntMap$(K, V)
+
+#define IntMap$(K, V)                                                  \
+    /**                                                                \
+     * @brief Create an integer map type                               \
+     * @param K Type of keys (u32 or u64)                              \
+     * @param V Type of values                                         \
+     * @return Integer map type alias                                  \
+     * @example                                                        \
+     *     IntMap$(u32, f32) map; // Create a map from u32 to f32      \
+     */                                                                \
+    comp_type_alias__IntMap$(K, V)
+
+/// @brief Integer-keyed hash map structure
+/// @details Entries are laid out as `struct { K key; V val; }`, with `cap` table slots
+///          followed by the slot of key zero
+typedef struct IntMap {
+    TypeInfo      key_type;   ///< Type information for the keys (u32 or u64)
+    TypeInfo      val_type;   ///< Type information for the values
+    usize         val_offset; ///< Offset of value within entry
+    usize         entry_size; ///< Size of entry (key and value)
+    anyptr        entries;    ///< Key-value entries (cap + 1)
+    usize         cap;        ///< Number of table slots (zero or power of two)
+    usize         len;        ///< Number of entries (including key zero)
+    u32           shift;      ///< Right shift of multiplied key to get slot index
+    bool          has_zero;   ///< Whether key zero is present
+    mem_Allocator allocator;  ///< Memory allocator to use
+} IntMap;
+use_Opt$(IntMap);
+use_Err$(IntMap);
+use_ErrSet$(mem_Allocator_Err, IntMap);
+
+/// Entry of integer map (value pointer stays valid until next insert or remove)
+typedef struct IntMap_Entry {
+    u64      key; ///< Key
+    meta_Ptr val; ///< Pointer to value
+} IntMap_Entry;
+use_Opt$(IntMap_Entry);
+
+/// Result of get or put
+typedef struct IntMap_GetOrPutResult {
+    meta_Ptr val;            ///< Pointer to value (uninitialized for new entries)
+    bool     found_existing; ///< Whether the key was already present
+} IntMap_GetOrPutResult;
+use_Err$(IntMap_GetOrPutResult);
+use_ErrSet$(mem_Allocator_Err, IntMap_GetOrPutResult);
+
+/// Iterator over entries (in unspecified order)
+typedef struct IntMap_Iter {
+    const IntMap* map;   ///< Map to iterate over
+    usize         index; ///< Next slot to visit (cap is the slot of key zero)
+} IntMap_Iter;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty map
+/// @param key_type Type information for the keys (u32 or u64)
+/// @param val_type Type information for the values (may be zero-sized)
+/// @param allocator Memory allocator to use
+/// @return Initialized integer map
+extern fn_(IntMap_init(TypeInfo key_type, TypeInfo val_type, mem_Allocator allocator), IntMap);
+/// @brief Initialize map with capacity for at least `cap` entries
+extern fn_(IntMap_initCap(TypeInfo key_type, TypeInfo val_type, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$IntMap);
+/// @brief Free resources used by the map
+extern fn_(IntMap_fini(IntMap* self), void);
+
+/// @brief Ensure the map holds `new_len` entries without rehashing
+extern fn_(IntMap_ensureTotalCap(IntMap* self, usize new_len), $must_check mem_Allocator_Err$void);
+/// @brief Ensure the map holds `additional` more entries without rehashing
+extern fn_(IntMap_ensureUnusedCap(IntMap* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Check if the map contains a key
+extern fn_(IntMap_contains(const IntMap* self, u64 key), bool);
+/// @brief Get pointer to value of a key, or none if absent
+extern fn_(IntMap_getPtr(const IntMap* self, u64 key), Opt$meta_Ptr);
+
+/// @brief Insert entry, overwriting value of existing key
+extern fn_(IntMap_put(IntMap* self, u64 key, meta_Ptr val), $must_check mem_Allocator_Err$void);
+/// @brief Get value of a key, inserting it (uninitialized) if absent
+extern fn_(IntMap_getOrPut(IntMap* self, u64 key), $must_check mem_Allocator_Err$IntMap_GetOrPutResult);
+/// @brief Remove entry of a key (moves later entries of the same cluster)
+/// @return Whether the key was present
+extern fn_(IntMap_remove(IntMap* self, u64 key), bool);
+
+/// @brief Remove all entries and retain the allocated capacity
+extern fn_(IntMap_clearRetainingCap(IntMap* self), void);
+/// @brief Remove all entries and free all allocated memory
+extern fn_(IntMap_clearAndFree(IntMap* self), void);
+
+/// @brief Iterate over entries
+extern fn_(IntMap_iter(const IntMap* self), IntMap_Iter);
+/// @brief Advance iterator to next entry
+extern fn_(IntMap_Iter_next(IntMap_Iter* self), Opt$IntMap_Entry);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_IntMap$(K, V) \
+    decl_IntMap$(K, V);                  \
+    impl_IntMap$(K, V)
+#define comp_type_gen__decl_IntMap$(K, V) \
+    typedef union IntMap$(K, V) IntMap$(K, V)
+#define comp_type_gen__impl_IntMap$(K, V) \
+    union IntMap$(K, V) {                 \
+        IntMap base[1];                   \
+        struct {                          \
+            TypeInfo key_type;            \
+            TypeInfo val_type;            \
+            usize    val_offset;          \
+            usize    entry_size;          \
+            struct {                      \
+                K key;                    \
+                V val;                    \
+            }* entries;                   \
+            usize         cap;            \
+            usize         len;            \
+            u32           shift;          \
+            bool          has_zero;       \
+            mem_Allocator allocator;      \
+        };                                \
+    }
+
+#define comp_type_alias__IntMap$(K, V) \
+    pp_join3($, IntMap, K, V)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* INT_MAP_INCLUDED */
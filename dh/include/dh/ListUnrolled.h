@@ -0,0 +1,214 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    ListUnrolled.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-19 (date of creation)
+ * @updated 2025-04-22 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  ListUnrolled
+ *
+ * @brief   Unrolled doubly linked list
+ * @details Each node stores a run of items inline, so walking the list touches one
+ *          pointer per node instead of one per item. Nodes split when full and merge
+ *          with their successor when less than half full, and the length is cached.
+ *          Nodes have a fixed size, so they can come from a heap_Pool sized with
+ *          ListUnrolled_nodeType, and emptied nodes are kept for reuse until cleared.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+ListUnrolled     list = ListUnrolled_init(typeInfo$(i32), allocator);                          // Initialize empty list
+ListUnrolled$i32 list = type$(ListUnrolled$i32, ListUnrolled_init(typeInfo$(i32), allocator)); // Typed list
+
+/* Operations */
+ListUnrolled_append(list.base, meta_refPtr(&item));           // Add item to end
+ListUnrolled_insertAt(list.base, pos, meta_refPtr(&item));    // Insert item before position
+ListUnrolled_removeAt(list.base, pos);                        // Remove item at position
+ListUnrolled_concatByMoving(dst.base, src.base);              // Splice all nodes of src onto dst
+var iter = ListUnrolled_iter(list.base);                      // Iterate items in order
+heap_Pool_init(child, ListUnrolled_nodeType(typeInfo$(i32))); // Pool sized for nodes of i32 lists
+#endif /* CHEAT_SHEET */
+
+#ifndef LIST_UNROLLED_INCLUDED
+#define LIST_UNROLLED_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Target size of a node in bytes (items per node are derived from the item size)
+#define ListUnrolled_node_size (256)
+
+#define use_ListUnrolled$(T)                                                  \
+    /**                                                                       \
+     * @brief Declare and implement typed unrolled list                       \
+     * @param T Type of elements to store in the list                         \
+     * @example                                                               \
+     *     use_ListUnrolled$(i32); // Declare and implement i32 unrolled list \
+     */                                                                       \
+    comp_type_gen__use_ListUnrolled$(T)
+#define decl_ListUnrolled$(T)                                          \
+    /**                                                                \
+     * @brief Declare typed unrolled list structure                    \
+     * @param T Type of elements to store in the list                  \
+     * @example                                                        \
+     *     decl_ListUnrolled$(i32); // Declare i32 unrolled list union \
+     */                                                                \
+    comp_type_gen__decl_ListUnrolled$(T)
+#define impl_ListUnrolled$(T)                                              \
+    /**                                                                    \
+     * @brief Implement typed unrolled list structure                      \
+     * @param T Type of elements to store in the list                      \
+     * @example                                                            \
+     *     impl_ListUnrolled$(i32); // Implement previously declared union \
+     */                                                                    \
+    comp_type_gen__impl_ListUnrolled$(T)
+
+#define ListUnrolled$(T)                                                       \
+    /**                                                                        \
+     * @brief Create an unrolled list type                                     \
+     * @param T Type of elements to store in the list                          \
+     * @return Unrolled list type alias                                        \
+     * @example                                                                \
+     *     ListUnrolled$(i32) list; // Create an unrolled list of i32 elements \
+     */                                                                        \
+    comp_type_alias__ListUnrolled$(T)
+
+/// Node of the list (header followed by up to `node_cap` items)
+typedef struct ListUnrolled_Node ListUnrolled_Node;
+struct ListUnrolled_Node {
+    ListUnrolled_Node* prev; ///< Previous node (null for the first node)
+    ListUnrolled_Node* next; ///< Next node (null for the last node, links spare nodes too)
+    usize              len;  ///< Number of items in node
+};
+
+/// @brief Unrolled list structure
+/// @details Every node but the last holds at least `node_cap / 2` items.
+typedef struct ListUnrolled {
+    TypeInfo           type;         ///< Type information for the items
+    u32                node_cap;     ///< Maximum items per node
+    u32                node_align;   ///< Alignment of nodes
+    usize              items_offset; ///< Offset of items within a node
+    usize              node_size;    ///< Size of a node
+    ListUnrolled_Node* first;        ///< First node (null while empty)
+    ListUnrolled_Node* last;         ///< Last node (null while empty)
+    usize              len;          ///< Number of items
+    ListUnrolled_Node* spare;        ///< Emptied nodes kept for reuse
+    mem_Allocator      allocator;    ///< Memory allocator to use
+} ListUnrolled;
+use_Opt$(ListUnrolled);
+use_Err$(ListUnrolled);
+use_ErrSet$(mem_Allocator_Err, ListUnrolled);
+
+/// Position of item (node and index within node; null node is the end of the list)
+typedef struct ListUnrolled_Pos {
+    ListUnrolled_Node* node;  ///< Node of item
+    usize              index; ///< Index of item within node
+} ListUnrolled_Pos;
+use_Err$(ListUnrolled_Pos);
+use_ErrSet$(mem_Allocator_Err, ListUnrolled_Pos);
+
+/// Iterator over items in list order
+typedef struct ListUnrolled_Iter {
+    const ListUnrolled* list;  ///< List to iterate over
+    ListUnrolled_Node*  node;  ///< Node of next item
+    usize               index; ///< Index of next item within node
+} ListUnrolled_Iter;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty list
+/// @param type Type information for the items
+/// @param allocator Memory allocator to use (may be a heap_Pool of ListUnrolled_nodeType)
+/// @return Initialized unrolled list
+extern fn_(ListUnrolled_init(TypeInfo type, mem_Allocator allocator), ListUnrolled);
+/// @brief Free resources used by the list
+extern fn_(ListUnrolled_fini(ListUnrolled* self), void);
+/// @brief Get type information of a node holding items of type, for sizing a pool allocator
+extern fn_(ListUnrolled_nodeType(TypeInfo type), TypeInfo);
+
+/// @brief Get number of items in O(1)
+extern fn_(ListUnrolled_len(const ListUnrolled* self), usize);
+/// @brief Get position of first item (end position if empty)
+extern fn_(ListUnrolled_front(const ListUnrolled* self), ListUnrolled_Pos);
+/// @brief Get position of item at index, walking nodes instead of items
+extern fn_(ListUnrolled_posAt(const ListUnrolled* self, usize index), ListUnrolled_Pos);
+/// @brief Get position following position
+extern fn_(ListUnrolled_next(const ListUnrolled* self, ListUnrolled_Pos pos), ListUnrolled_Pos);
+/// @brief Get pointer to item at position (valid until next insert or remove)
+extern fn_(ListUnrolled_get(const ListUnrolled* self, ListUnrolled_Pos pos), meta_Ptr);
+
+/// @brief Add item to end
+extern fn_(ListUnrolled_append(ListUnrolled* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add item to front
+extern fn_(ListUnrolled_prepend(ListUnrolled* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Insert item before position (end position appends)
+/// @return Position of the inserted item
+extern fn_(ListUnrolled_insertAt(ListUnrolled* self, ListUnrolled_Pos pos, meta_Ptr item), $must_check mem_Allocator_Err$ListUnrolled_Pos);
+/// @brief Remove item at position
+/// @return Position of the item that followed it
+extern fn_(ListUnrolled_removeAt(ListUnrolled* self, ListUnrolled_Pos pos), ListUnrolled_Pos);
+/// @brief Remove last item
+/// @return Optional pointer to the removed item (valid until next modification)
+extern fn_(ListUnrolled_pop(ListUnrolled* self), Opt$meta_Ptr);
+/// @brief Move all nodes of src to the end of dst in O(1) (both lists must share item type and allocator)
+extern fn_(ListUnrolled_concatByMoving(ListUnrolled* dst, ListUnrolled* src), void);
+
+/// @brief Remove all items and keep the nodes for reuse
+extern fn_(ListUnrolled_clearRetainingCap(ListUnrolled* self), void);
+/// @brief Remove all items and free all nodes
+extern fn_(ListUnrolled_clearAndFree(ListUnrolled* self), void);
+
+/// @brief Iterate over items in list order
+/// @example
+///     var iter = ListUnrolled_iter(list.base);
+///     for (var item = ListUnrolled_Iter_next(&iter); isSome(item); item = ListUnrolled_Iter_next(&iter)) { ... }
+extern fn_(ListUnrolled_iter(const ListUnrolled* self), ListUnrolled_Iter);
+/// @brief Advance iterator to next item
+extern fn_(ListUnrolled_Iter_next(ListUnrolled_Iter* self), Opt$meta_Ptr);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_ListUnrolled$(T) \
+    decl_ListUnrolled$(T);                  \
+    impl_ListUnrolled$(T)
+#define comp_type_gen__decl_ListUnrolled$(T) \
+    typedef union ListUnrolled$(T) ListUnrolled$(T)
+#define comp_type_gen__impl_ListUnrolled$(T) \
+    union ListUnrolled$(T) {                 \
+        ListUnrolled base[1];                \
+        struct {                             \
+            TypeInfo           type;         \
+            u32                node_cap;     \
+            u32                node_align;   \
+            usize              items_offset; \
+            usize              node_size;    \
+            ListUnrolled_Node* first;        \
+            ListUnrolled_Node* last;         \
+            usize              len;          \
+            ListUnrolled_Node* spare;        \
+            mem_Allocator      allocator;    \
+            rawptr$(T) __item_type_hint[0];  \
+        };                                   \
+    }
+
+#define comp_type_alias__ListUnrolled$(T) \
+    pp_join($, ListUnrolled, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* LIST_UNROLLED_INCLUDED */
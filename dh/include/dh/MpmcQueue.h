@@ -0,0 +1,161 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    MpmcQueue.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-20 (date of creation)
+ * @updated 2025-04-20 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  MpmcQueue
+ *
+ * @brief   Bounded lock-free multi-producer/multi-consumer queue
+ * @details Ring of cells that each carry a sequence number next to the item (Vyukov's
+ *          bounded MPMC queue). A producer claims a cell by advancing the enqueue position
+ *          with one compare-and-swap and publishes the item by storing the cell sequence;
+ *          consumers mirror that on the dequeue position. Threads never wait on a lock, and
+ *          the two positions sit on separate cache lines so producers and consumers do not
+ *          invalidate each other's line on every operation.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+MpmcQueue     queue = try_(MpmcQueue_init(typeInfo$(i32), 1024, allocator));                        // Capacity rounded up to a power of 2
+MpmcQueue$i32 queue = type$(MpmcQueue$i32, try_(MpmcQueue_init(typeInfo$(i32), 1024, allocator))); // Typed queue
+
+/* Operations (any number of threads) */
+MpmcQueue_tryPush(queue.base, meta_refPtr(&item)); // Add item, false if full
+MpmcQueue_push(queue.base, meta_refPtr(&item));    // Add item, spinning while full
+MpmcQueue_tryPop(queue.base, meta_refPtr(&item));  // Take item, false if empty
+MpmcQueue_pop(queue.base, meta_refPtr(&item));     // Take item, spinning while empty
+MpmcQueue_fini(queue.base);                        // Free resources (after all threads are done)
+#endif /* CHEAT_SHEET */
+
+#ifndef MPMC_QUEUE_INCLUDED
+#define MPMC_QUEUE_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "atomic.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_MpmcQueue$(T)                                          \
+    /**                                                            \
+     * @brief Declare and implement typed MPMC queue               \
+     * @param T Type of items                                      \
+     * @example                                                    \
+     *     use_MpmcQueue$(i32); // Declare and implement i32 queue \
+     */                                                            \
+    comp_type_gen__use_MpmcQueue$(T)
+#define decl_MpmcQueue$(T)                                  \
+    /**                                                     \
+     * @brief Declare typed MPMC queue structure            \
+     * @param T Type of items                               \
+     * @example                                             \
+     *     decl_MpmcQueue$(i32); // Declare i32 queue union \
+     */                                                     \
+    comp_type_gen__decl_MpmcQueue$(T)
+#define impl_MpmcQueue$(T)                                              \
+    /**                                                                 \
+     * @brief Implement typed MPMC queue structure                      \
+     * @param T Type of items                                           \
+     * @example                                                         \
+     *     impl_MpmcQueue$(i32); // Implement previously declared union \
+     */                                                                 \
+    comp_type_gen__impl_MpmcQueue$(T)
+
+#define MpmcQueue$(T)                                            \
+    /**                                                          \
+     * @brief Create an MPMC queue type                          \
+     * @param T Type of items                                    \
+     * @return MPMC queue type alias                             \
+     * @example                                                  \
+     *     MpmcQueue$(i32) queue; // Create an MPMC queue of i32 \
+     */                                                          \
+    comp_type_alias__MpmcQueue$(T)
+
+/// @brief Bounded MPMC queue structure
+/// @details Cell `i` is free for the producer at position `p` when its sequence is `p`,
+///          and holds an item for the consumer at position `p` when its sequence is `p + 1`.
+typedef struct MpmcQueue {
+    atomic_Value$(usize) enqueue_pos $align(atomic_cache_line); ///< Next position to push (producers only)
+    atomic_Value$(usize) dequeue_pos $align(atomic_cache_line); ///< Next position to pop (consumers only)
+    TypeInfo             type $align(atomic_cache_line);        ///< Type information for the items
+    usize                mask;                                  ///< Capacity minus one (capacity is a power of 2)
+    usize                item_offset;                           ///< Offset of item within a cell
+    usize                cell_size;                             ///< Size of a cell (sequence and item)
+    u8*                  cells;                                 ///< Ring of cells
+    mem_Allocator        allocator;                             ///< Memory allocator to use
+} MpmcQueue;
+use_Opt$(MpmcQueue);
+use_Err$(MpmcQueue);
+use_ErrSet$(mem_Allocator_Err, MpmcQueue);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize queue with room for at least `cap` items
+/// @param type Type information for the items
+/// @param cap Minimum capacity (rounded up to a power of 2, at least 2)
+/// @param allocator Memory allocator to use (only used here and in fini)
+/// @return Initialized queue (must not be moved once shared between threads)
+extern fn_(MpmcQueue_init(TypeInfo type, usize cap, mem_Allocator allocator), $must_check mem_Allocator_Err$MpmcQueue);
+/// @brief Free resources used by the queue (no thread may use it anymore)
+extern fn_(MpmcQueue_fini(MpmcQueue* self), void);
+
+/// @brief Get number of items the queue holds
+extern fn_(MpmcQueue_cap(const MpmcQueue* self), usize);
+/// @brief Get number of queued items (exact only while no thread pushes or pops)
+extern fn_(MpmcQueue_lenApprox(const MpmcQueue* self), usize);
+
+/// @brief Copy item into the queue unless it is full
+/// @return Whether the item was pushed
+extern fn_(MpmcQueue_tryPush(MpmcQueue* self, meta_Ptr item), bool);
+/// @brief Copy item into the queue, spinning until a cell is free
+extern fn_(MpmcQueue_push(MpmcQueue* self, meta_Ptr item), void);
+/// @brief Move oldest item into `out` unless the queue is empty
+/// @return Whether an item was popped
+extern fn_(MpmcQueue_tryPop(MpmcQueue* self, meta_Ptr out), bool);
+/// @brief Move oldest item into `out`, spinning until one is available
+extern fn_(MpmcQueue_pop(MpmcQueue* self, meta_Ptr out), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_MpmcQueue$(T) \
+    decl_MpmcQueue$(T);                  \
+    impl_MpmcQueue$(T)
+#define comp_type_gen__decl_MpmcQueue$(T) \
+    typedef union MpmcQueue$(T) MpmcQueue$(T)
+#define comp_type_gen__impl_MpmcQueue$(T)                               \
+    union MpmcQueue$(T) {                                               \
+        MpmcQueue base[1];                                              \
+        struct {                                                        \
+            atomic_Value$(usize) enqueue_pos $align(atomic_cache_line); \
+            atomic_Value$(usize) dequeue_pos $align(atomic_cache_line); \
+            TypeInfo             type $align(atomic_cache_line);        \
+            usize                mask;                                  \
+            usize                item_offset;                           \
+            usize                cell_size;                             \
+            u8*                  cells;                                 \
+            mem_Allocator        allocator;                             \
+            rawptr$(T) __item_type_hint[0];                             \
+        };                                                              \
+    }
+
+#define comp_type_alias__MpmcQueue$(T) \
+    pp_join($, MpmcQueue, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* MPMC_QUEUE_INCLUDED */
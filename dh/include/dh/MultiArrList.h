@@ -0,0 +1,220 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    MultiArrList.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-13 (date of creation)
+ * @updated 2025-04-13 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  MultiArrList
+ *
+ * @brief   Struct-of-arrays list implementation
+ * @details Stores each field of a struct in its own contiguous column, so loops over
+ *          a few fields only touch the memory of those fields (and vectorize well).
+ *          All columns share a single allocation, ordered by descending alignment
+ *          so no padding is needed between them.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Field Descriptions */
+static const MultiArrList_Field body_fields[] = {
+    MultiArrList_field$(Body, pos),  // Column 0
+    MultiArrList_field$(Body, mass), // Column 1
+};
+
+/* Type Declarations */
+MultiArrList       list = MultiArrList_init(typeInfo$(Body), body_fields, countOf(body_fields), allocator);
+MultiArrList$Body  list = type$(MultiArrList$Body, MultiArrList_init(typeInfo$(Body), body_fields, countOf(body_fields), allocator));
+
+/* Operations */
+MultiArrList_append(list.base, meta_refPtr(&body));                 // Scatter fields of item to columns
+MultiArrList_get(list.base, index, meta_refPtr(&body));             // Gather fields of item from columns
+Sli$f32 masses = MultiArrList_items$(Sli$f32, list.base, 1);        // Column of one field
+MultiArrList_removeSwap(list.base, index);                          // Remove item in O(1)
+MultiArrList_sort(list.base, 1, wrapFn(cmpMass));                   // Sort all columns by one field
+MultiArrList_fini(list.base);                                       // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef MULTI_ARR_LIST_INCLUDED
+#define MULTI_ARR_LIST_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+#include "sort.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_MultiArrList$(T)                                                   \
+    /**                                                                        \
+     * @brief Declare and implement typed struct-of-arrays list                \
+     * @param T Type of items (struct)                                         \
+     * @example                                                                \
+     *     use_MultiArrList$(Body); // Declare and implement Body list         \
+     */                                                                        \
+    comp_type_gen__use_MultiArrList$(T)
+#define decl_MultiArrList$(T)                                              \
+    /**                                                                    \
+     * @brief Declare typed struct-of-arrays list structure                \
+     * @param T Type of items (struct)                                     \
+     * @example                                                            \
+     *     decl_MultiArrList$(Body); // Declare Body list union            \
+     */                                                                    \
+    comp_type_gen__decl_MultiArrList$(T)
+#define impl_MultiArrList$(T)                                                   \
+    /**                                                                         \
+     * @brief Implement typed struct-of-arrays list structure                   \
+     * @param T Type of items (struct)                                          \
+     * @example                                                                 \
+     *     impl_MultiArrList$(Body); // Implement previously declared union     \
+     */                                                                         \
+    comp_type_gen__impl_MultiArrList$(T)
+
+#define MultiArrList$(T)                                                  \
+    /**                                                                   \
+     * @brief Create a struct-of-arrays list type                         \
+     * @param T Type of items (struct)                                    \
+     * @return Struct-of-arrays list type alias                           \
+     * @example                                                           \
+     *     MultiArrList$(Body) list; // Create a list of Body columns     \
+     */                                                                   \
+    comp_type_alias__MultiArrList$(T)
+
+#define MultiArrList_field$(T, _field)                                  \
+    /**                                                                 \
+     * @brief Describe a field of item type stored as its own column    \
+     * @param T Type of items (struct)                                  \
+     * @param _field Name of the field                                  \
+     * @return Field description initializer (usable in static data)    \
+     * @example                                                         \
+     *     MultiArrList_field$(Body, mass)                              \
+     */                                                                 \
+    comp_op__MultiArrList_field$(T, _field)
+#define MultiArrList_items$(T_Sli, _self, _field_index)                 \
+    /**                                                                 \
+     * @brief Get column of a field as typed slice                      \
+     * @param T_Sli Slice type of the field                             \
+     * @param _self Pointer to list                                     \
+     * @param _field_index Index of field in the field descriptions     \
+     * @return Column slice (valid until next growth)                   \
+     * @example                                                         \
+     *     Sli$f32 masses = MultiArrList_items$(Sli$f32, list.base, 1); \
+     */                                                                 \
+    comp_op__MultiArrList_items$(T_Sli, _self, _field_index)
+
+/// Field of item type stored as its own column
+typedef struct MultiArrList_Field {
+    TypeInfo type;   ///< Type information for the field
+    usize    offset; ///< Offset of field within item
+} MultiArrList_Field;
+
+/// @brief Struct-of-arrays list structure
+/// @details Column of field `i` holds `cap` values, all columns live in `bytes`
+typedef struct MultiArrList {
+    TypeInfo                  type;       ///< Type information for the items
+    const MultiArrList_Field* fields;     ///< Field descriptions (must outlive the list)
+    usize                     fields_len; ///< Number of fields
+    u8*                       bytes;      ///< Single allocation backing all columns
+    usize                     len;        ///< Number of items
+    usize                     cap;        ///< Capacity of each column
+    mem_Allocator             allocator;  ///< Memory allocator to use
+} MultiArrList;
+use_Opt$(MultiArrList);
+use_Err$(MultiArrList);
+use_ErrSet$(mem_Allocator_Err, MultiArrList);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty list
+/// @param type Type information for the items
+/// @param fields Field descriptions, one column each (fields not listed are not stored)
+/// @param fields_len Number of fields
+/// @param allocator Memory allocator to use
+/// @return Initialized struct-of-arrays list
+extern fn_(MultiArrList_init(TypeInfo type, const MultiArrList_Field* fields, usize fields_len, mem_Allocator allocator), MultiArrList);
+/// @brief Initialize list with capacity for at least `cap` items
+extern fn_(MultiArrList_initCap(TypeInfo type, const MultiArrList_Field* fields, usize fields_len, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$MultiArrList);
+/// @brief Free resources used by the list
+extern fn_(MultiArrList_fini(MultiArrList* self), void);
+
+/// @brief Ensure each column holds `new_cap` items
+extern fn_(MultiArrList_ensureTotalCap(MultiArrList* self, usize new_cap), $must_check mem_Allocator_Err$void);
+/// @brief Ensure each column holds `additional` more items
+extern fn_(MultiArrList_ensureUnusedCap(MultiArrList* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Get column of a field
+/// @return Slice of `len` field values (valid until next growth)
+extern fn_(MultiArrList_items(const MultiArrList* self, usize field_index), meta_Sli);
+/// @brief Gather fields of item at index into `out`
+extern fn_(MultiArrList_get(const MultiArrList* self, usize index, meta_Ptr out), void);
+/// @brief Scatter fields of `item` into item at index
+extern fn_(MultiArrList_set(MultiArrList* self, usize index, meta_Ptr item), void);
+
+/// @brief Add item to end
+extern fn_(MultiArrList_append(MultiArrList* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add item to end, assuming capacity is sufficient
+extern fn_(MultiArrList_appendAssumeCap(MultiArrList* self, meta_Ptr item), void);
+/// @brief Remove item at index, shifting following items
+extern fn_(MultiArrList_removeOrdered(MultiArrList* self, usize index), void);
+/// @brief Remove item at index, replacing it with the last item
+extern fn_(MultiArrList_removeSwap(MultiArrList* self, usize index), void);
+/// @brief Stable sort of all items by the values of one field
+/// @param field_index Index of field to compare
+/// @param cmpFn Ordering of field values
+extern fn_(MultiArrList_sort(MultiArrList* self, usize field_index, sort_CmpFn cmpFn), $must_check Err$void);
+
+/// @brief Remove all items and retain the allocated capacity
+extern fn_(MultiArrList_clearRetainingCap(MultiArrList* self), void);
+/// @brief Remove all items and free all allocated memory
+extern fn_(MultiArrList_clearAndFree(MultiArrList* self), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_MultiArrList$(T) \
+    decl_MultiArrList$(T);                  \
+    impl_MultiArrList$(T)
+#define comp_type_gen__decl_MultiArrList$(T) \
+    typedef union MultiArrList$(T) MultiArrList$(T)
+#define comp_type_gen__impl_MultiArrList$(T)             \
+    union MultiArrList$(T) {                             \
+        MultiArrList base[1];                            \
+        struct {                                         \
+            TypeInfo                  type;              \
+            const MultiArrList_Field* fields;            \
+            usize                     fields_len;        \
+            u8*                       bytes;             \
+            usize                     len;               \
+            usize                     cap;               \
+            mem_Allocator             allocator;         \
+            rawptr$(T) __item_type_hint[0];              \
+        };                                               \
+    }
+
+#define comp_type_alias__MultiArrList$(T) \
+    pp_join($, MultiArrList, T)
+
+#define comp_op__MultiArrList_field$(T, _field)                 \
+    {                                                           \
+        .type   = {                                             \
+            .size  = sizeOf$(FieldTypeOf(T, _field)),           \
+            .align = alignOf$(FieldTypeOf(T, _field)),          \
+        },                                                      \
+        .offset = offsetTo(T, _field),                          \
+    }
+#define comp_op__MultiArrList_items$(T_Sli, _self, _field_index) \
+    meta_castSli$(T_Sli, MultiArrList_items(_self, _field_index))
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* MULTI_ARR_LIST_INCLUDED */
@@ -0,0 +1,198 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    PriorityQueue.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-12 (date of creation)
+ * @updated 2025-04-12 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  PriorityQueue
+ *
+ * @brief   Heap-based priority queue implementation
+ * @details Implicit d-ary heap (binary or 4-ary) stored in an ArrList, ordered by a
+ *          sort_CmpFn comparator: the item comparing least is popped first.
+ *          Every pushed item gets a handle that stays valid while it is queued,
+ *          so its priority can be changed (decrease-key) or it can be removed.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+PriorityQueue     queue = PriorityQueue_init(typeInfo$(i32), wrapFn(cmpI32), PriorityQueue_Arity_quaternary, allocator);
+PriorityQueue$i32 queue = type$(PriorityQueue$i32, PriorityQueue_init(typeInfo$(i32), wrapFn(cmpI32), PriorityQueue_Arity_binary, allocator));
+
+/* Operations */
+PriorityQueue_Handle handle = PriorityQueue_push(queue.base, meta_refPtr(&item)); // Add item
+PriorityQueue_peek(queue.base);                                                   // Optional pointer to least item
+PriorityQueue_pop(queue.base);                                                    // Optional pointer to removed least item
+PriorityQueue_decreaseKey(queue.base, handle, meta_refPtr(&smaller));             // Move item towards front
+PriorityQueue_fini(queue.base);                                                   // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef PRIORITY_QUEUE_INCLUDED
+#define PRIORITY_QUEUE_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+#include "ArrList.h"
+#include "sort.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_PriorityQueue$(T)                                                 \
+    /**                                                                       \
+     * @brief Declare and implement typed priority queue                      \
+     * @param T Type of items                                                 \
+     * @example                                                               \
+     *     use_PriorityQueue$(i32); // Declare and implement i32 queue        \
+     */                                                                       \
+    comp_type_gen__use_PriorityQueue$(T)
+#define decl_PriorityQueue$(T)                                            \
+    /**                                                                   \
+     * @brief Declare typed priority queue structure                      \
+     * @param T Type of items                                             \
+     * @example                                                           \
+     *     decl_PriorityQueue$(i32); // Declare i32 queue union           \
+     */                                                                   \
+    comp_type_gen__decl_PriorityQueue$(T)
+#define impl_PriorityQueue$(T)                                                \
+    /**                                                                       \
+     * @brief Implement typed priority queue structure                        \
+     * @param T Type of items                                                 \
+     * @example                                                               \
+     *     impl_PriorityQueue$(i32); // Implement previously declared union   \
+     */                                                                       \
+    comp_type_gen__impl_PriorityQueue$(T)
+
+#define PriorityQueue$(T)                                                \
+    /**                                                                  \
+     * @brief Create a priority queue type                               \
+     * @param T Type of items                                            \
+     * @return Priority queue type alias                                 \
+     * @example                                                          \
+     *     PriorityQueue$(i32) queue; // Create a priority queue of i32  \
+     */                                                                  \
+    comp_type_alias__PriorityQueue$(T)
+
+/// Children per heap node
+typedef enum PriorityQueue_Arity {
+    PriorityQueue_Arity_binary     = 2, ///< Fewest comparisons per level
+    PriorityQueue_Arity_quaternary = 4  ///< Half the depth, children share a cache line for small items
+} PriorityQueue_Arity;
+
+/// @brief Priority queue structure
+/// @details `handles[i]` is the handle of item `i`, `positions[handle]` is the index of its item.
+///          Positions of released handles instead link them into a free list.
+typedef struct PriorityQueue {
+    ArrList             items;       ///< Heap-ordered items
+    ArrList             handles;     ///< Handle of each item (usize)
+    ArrList             positions;   ///< Item index of each handle (usize)
+    usize               free_handle; ///< Most recently released handle
+    sort_CmpFn          cmpFn;       ///< Ordering of items (least first)
+    PriorityQueue_Arity arity;       ///< Children per node
+} PriorityQueue;
+use_Opt$(PriorityQueue);
+use_Err$(PriorityQueue);
+use_ErrSet$(mem_Allocator_Err, PriorityQueue);
+
+/// Handle of queued item (valid until the item is popped or removed)
+typedef struct PriorityQueue_Handle {
+    usize id; ///< Index into positions
+} PriorityQueue_Handle;
+use_Err$(PriorityQueue_Handle);
+use_ErrSet$(mem_Allocator_Err, PriorityQueue_Handle);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty priority queue
+/// @param type Type information for the items
+/// @param cmpFn Ordering of items (least is popped first, reverse it for a max-queue)
+/// @param arity Children per heap node
+/// @param allocator Memory allocator to use
+/// @return Initialized priority queue
+extern fn_(PriorityQueue_init(TypeInfo type, sort_CmpFn cmpFn, PriorityQueue_Arity arity, mem_Allocator allocator), PriorityQueue);
+/// @brief Initialize priority queue from copies of items (heapified in O(n))
+/// @details Handle of `items[i]` is `{ .id = i }`
+extern fn_(PriorityQueue_initSli(meta_Sli_const items, sort_CmpFn cmpFn, PriorityQueue_Arity arity, mem_Allocator allocator), $must_check mem_Allocator_Err$PriorityQueue);
+/// @brief Free resources used by the priority queue
+extern fn_(PriorityQueue_fini(PriorityQueue* self), void);
+
+/// @brief Ensure the queue holds `additional` more items without growing
+extern fn_(PriorityQueue_ensureUnusedCap(PriorityQueue* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Get number of queued items
+extern fn_(PriorityQueue_len(const PriorityQueue* self), usize);
+/// @brief Get pointer to least item, or none if empty
+extern fn_(PriorityQueue_peek(const PriorityQueue* self), Opt$meta_Ptr);
+/// @brief Check if handle refers to a queued item
+extern fn_(PriorityQueue_isQueued(const PriorityQueue* self, PriorityQueue_Handle handle), bool);
+/// @brief Get pointer to queued item (read only, change it with update or decreaseKey)
+extern fn_(PriorityQueue_get(const PriorityQueue* self, PriorityQueue_Handle handle), meta_Ptr_const);
+
+/// @brief Add item
+/// @return Handle of the item
+extern fn_(PriorityQueue_push(PriorityQueue* self, meta_Ptr item), $must_check mem_Allocator_Err$PriorityQueue_Handle);
+/// @brief Remove least item
+/// @return Pointer to removed item (valid until next push), or none if empty
+/// @example
+///     while_some(PriorityQueue_pop(queue.base), node) { visit(*meta_castPtr$(Node*, node)); }
+extern fn_(PriorityQueue_pop(PriorityQueue* self), Opt$meta_Ptr);
+/// @brief Replace queued item with one that compares less or equal, moving it towards the front
+/// @example
+///     PriorityQueue_decreaseKey(queue.base, handles[node], meta_refPtr(&(Node){ .id = node, .dist = new_dist }));
+extern fn_(PriorityQueue_decreaseKey(PriorityQueue* self, PriorityQueue_Handle handle, meta_Ptr item), void);
+/// @brief Replace queued item with any item, restoring heap order
+extern fn_(PriorityQueue_update(PriorityQueue* self, PriorityQueue_Handle handle, meta_Ptr item), void);
+/// @brief Remove queued item
+extern fn_(PriorityQueue_remove(PriorityQueue* self, PriorityQueue_Handle handle), void);
+
+/// @brief Remove all items and retain the allocated capacity
+extern fn_(PriorityQueue_clearRetainingCap(PriorityQueue* self), void);
+/// @brief Remove all items and free all allocated memory
+extern fn_(PriorityQueue_clearAndFree(PriorityQueue* self), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_PriorityQueue$(T) \
+    decl_PriorityQueue$(T);                  \
+    impl_PriorityQueue$(T)
+#define comp_type_gen__decl_PriorityQueue$(T) \
+    typedef union PriorityQueue$(T) PriorityQueue$(T)
+#define comp_type_gen__impl_PriorityQueue$(T)  \
+    union PriorityQueue$(T) {                  \
+        PriorityQueue base[1];                 \
+        struct {                               \
+            union {                            \
+                ArrList base[1];               \
+                struct {                       \
+                    TypeInfo type;             \
+                    Sli$(T) items;             \
+                    usize         cap;         \
+                    mem_Allocator allocator;   \
+                };                             \
+            } items;                           \
+            ArrList             handles;       \
+            ArrList             positions;     \
+            usize               free_handle;   \
+            sort_CmpFn          cmpFn;         \
+            PriorityQueue_Arity arity;         \
+        };                                     \
+    }
+
+#define comp_type_alias__PriorityQueue$(T) \
+    pp_join($, PriorityQueue, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* PRIORITY_QUEUE_INCLUDED */
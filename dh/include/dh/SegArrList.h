@@ -0,0 +1,195 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    SegArrList.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-16 (date of creation)
+ * @updated 2025-04-16 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  SegArrList
+ *
+ * @brief   Segmented array list with stable addresses
+ * @details Items live in segments of 8, 16, 32, ... elements that are never moved,
+ *          so pointers to items stay valid until the items are removed.
+ *          Growing allocates one new segment and copies nothing. Segment and offset
+ *          of an index are found with a single leading-zero count.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+SegArrList     list = SegArrList_init(typeInfo$(i32), allocator);                        // Initialize empty list
+SegArrList$i32 list = type$(SegArrList$i32, SegArrList_init(typeInfo$(i32), allocator)); // Typed list
+
+/* Operations */
+SegArrList_append(list.base, meta_refPtr(&item));       // Add item to end (items never move)
+meta_Ptr item = try_(SegArrList_addBackOne(list.base)); // Add and get stable pointer to new item
+i32* item = SegArrList_at$(i32*, list.base, index);     // Access item by index in O(1)
+var iter  = SegArrList_iter(list.base);                 // Iterate items in order
+SegArrList_fini(list.base);                             // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef SEG_ARR_LIST_INCLUDED
+#define SEG_ARR_LIST_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+/// Log2 of number of items in the first segment
+#define SegArrList_first_seg_log2 (3)
+/// Maximum number of segments (enough to address every index)
+#define SegArrList_segs_max       (sizeof(usize) * 8 - SegArrList_first_seg_log2)
+
+#define use_SegArrList$(T)                                                   \
+    /**                                                                      \
+     * @brief Declare and implement typed segmented list                     \
+     * @param T Type of elements to store in the list                        \
+     * @example                                                              \
+     *     use_SegArrList$(i32); // Declare and implement i32 segmented list \
+     */                                                                      \
+    comp_type_gen__use_SegArrList$(T)
+#define decl_SegArrList$(T)                                               \
+    /**                                                                   \
+     * @brief Declare typed segmented list structure                      \
+     * @param T Type of elements to store in the list                     \
+     * @example                                                           \
+     *     decl_SegArrList$(i32); // Declare i32 segmented list structure \
+     */                                                                   \
+    comp_type_gen__decl_SegArrList$(T)
+#define impl_SegArrList$(T)                                                  \
+    /**                                                                      \
+     * @brief Implement typed segmented list structure                       \
+     * @param T Type of elements to store in the list                        \
+     * @example                                                              \
+     *     impl_SegArrList$(i32); // Implement previously declared structure \
+     */                                                                      \
+    comp_type_gen__impl_SegArrList$(T)
+
+#define SegArrList$(T)                                                       \
+    /**                                                                      \
+     * @brief Create a segmented list type                                   \
+     * @param T Type of elements to store in the list                        \
+     * @return Segmented list type alias                                     \
+     * @example                                                              \
+     *     SegArrList$(i32) list; // Create a segmented list of i32 elements \
+     */                                                                      \
+    comp_type_alias__SegArrList$(T)
+
+#define SegArrList_at$(T_Ptr, _self, _index)                           \
+    /**                                                                \
+     * @brief Get typed pointer to item at index                       \
+     * @param T_Ptr Pointer type of the items                          \
+     * @param _self Pointer to list                                    \
+     * @param _index Index of item                                     \
+     * @return Pointer to item (valid until the item is removed)       \
+     * @example                                                        \
+     *     i32* item = SegArrList_at$(i32*, list.base, 42);            \
+     */                                                                \
+    comp_op__SegArrList_at$(T_Ptr, _self, _index)
+
+/// @brief Segmented array list structure
+/// @details Segment `k` holds `8 << k` items, `segs[0 .. segs_len]` are allocated
+typedef struct SegArrList {
+    TypeInfo      type;                      ///< Type information for the items
+    u8*           segs[SegArrList_segs_max]; ///< Segments of items (never moved)
+    usize         segs_len;                  ///< Number of allocated segments
+    usize         len;                       ///< Number of items
+    mem_Allocator allocator;                 ///< Memory allocator to use
+} SegArrList;
+use_Opt$(SegArrList);
+use_Err$(SegArrList);
+use_ErrSet$(mem_Allocator_Err, SegArrList);
+
+/// Iterator over items in index order
+typedef struct SegArrList_Iter {
+    const SegArrList* list;     ///< List to iterate over
+    usize             index;    ///< Index of next item
+    usize             seg;      ///< Segment of next item
+    usize             seg_next; ///< Index of first item of following segment
+} SegArrList_Iter;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty list
+/// @param type Type information for the items
+/// @param allocator Memory allocator to use
+/// @return Initialized segmented list
+extern fn_(SegArrList_init(TypeInfo type, mem_Allocator allocator), SegArrList);
+/// @brief Initialize list with capacity for at least `cap` items
+extern fn_(SegArrList_initCap(TypeInfo type, mem_Allocator allocator, usize cap), $must_check mem_Allocator_Err$SegArrList);
+/// @brief Free resources used by the list
+extern fn_(SegArrList_fini(SegArrList* self), void);
+
+/// @brief Get number of items the allocated segments hold
+extern fn_(SegArrList_cap(const SegArrList* self), usize);
+/// @brief Ensure capacity for at least `new_cap` items (allocates segments, moves nothing)
+extern fn_(SegArrList_ensureTotalCap(SegArrList* self, usize new_cap), $must_check mem_Allocator_Err$void);
+/// @brief Ensure capacity for at least `additional` more items
+extern fn_(SegArrList_ensureUnusedCap(SegArrList* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Get pointer to item at index
+/// @return Pointer to item (valid until the item is removed)
+extern fn_(SegArrList_at(const SegArrList* self, usize index), meta_Ptr);
+/// @brief Add item to end
+extern fn_(SegArrList_append(SegArrList* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add one uninitialized item to end and get pointer to it
+/// @return Pointer to new item (valid until the item is removed)
+extern fn_(SegArrList_addBackOne(SegArrList* self), $must_check mem_Allocator_Err$meta_Ptr);
+/// @brief Remove last item
+/// @return Optional pointer to the removed item (valid until next modification)
+extern fn_(SegArrList_popOrNull(SegArrList* self), Opt$meta_Ptr);
+
+/// @brief Remove all items and retain the allocated segments
+extern fn_(SegArrList_clearRetainingCap(SegArrList* self), void);
+/// @brief Remove all items and free all segments
+extern fn_(SegArrList_clearAndFree(SegArrList* self), void);
+
+/// @brief Iterate over items in index order
+/// @example
+///     var iter = SegArrList_iter(list.base);
+///     for (var item = SegArrList_Iter_next(&iter); isSome(item); item = SegArrList_Iter_next(&iter)) { ... }
+extern fn_(SegArrList_iter(const SegArrList* self), SegArrList_Iter);
+/// @brief Advance iterator to next item
+extern fn_(SegArrList_Iter_next(SegArrList_Iter* self), Opt$meta_Ptr);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_SegArrList$(T) \
+    decl_SegArrList$(T);                  \
+    impl_SegArrList$(T)
+#define comp_type_gen__decl_SegArrList$(T) \
+    typedef union SegArrList$(T) SegArrList$(T)
+#define comp_type_gen__impl_SegArrList$(T)        \
+    union SegArrList$(T) {                        \
+        SegArrList base[1];                       \
+        struct {                                  \
+            TypeInfo type;                        \
+            rawptr$(T) segs[SegArrList_segs_max]; \
+            usize         segs_len;               \
+            usize         len;                    \
+            mem_Allocator allocator;              \
+        };                                        \
+    }
+
+#define comp_type_alias__SegArrList$(T) \
+    pp_join($, SegArrList, T)
+
+#define comp_op__SegArrList_at$(T_Ptr, _self, _index) \
+    meta_castPtr$(T_Ptr, SegArrList_at(_self, _index))
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* SEG_ARR_LIST_INCLUDED */
@@ -0,0 +1,189 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    SlotMap.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-18 (date of creation)
+ * @updated 2025-04-18 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  SlotMap
+ *
+ * @brief   Slot map with generational handles
+ * @details Items are packed densely in an ArrList and removed by swapping in the last item,
+ *          so iterating live items walks contiguous memory. Each item is reached through
+ *          a handle of slot index and generation: removing an item bumps the generation of
+ *          its slot, so stale handles are detected instead of silently hitting another item.
+ *          Insert, remove and lookup are O(1), and freed slots are reused.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+SlotMap     map = SlotMap_init(typeInfo$(i32), allocator);                     // Initialize empty map
+SlotMap$i32 map = type$(SlotMap$i32, SlotMap_init(typeInfo$(i32), allocator)); // Typed map
+
+/* Operations */
+SlotMap_Handle handle = try_(SlotMap_insert(map.base, meta_refPtr(&item))); // Add item and get its handle
+SlotMap_get(map.base, handle);                                              // Optional pointer to item (none if removed)
+SlotMap_remove(map.base, handle);                                           // Remove item (handle becomes stale)
+for_slice (map.items.items, item) { ... }                                   // Iterate live items densely
+SlotMap_fini(map.base);                                                     // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef SLOT_MAP_INCLUDED
+#define SLOT_MAP_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+#include "ArrList.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_SlotMap$(T)                                             \
+    /**                                                             \
+     * @brief Declare and implement typed slot map                  \
+     * @param T Type of items                                       \
+     * @example                                                     \
+     *     use_SlotMap$(i32); // Declare and implement i32 slot map \
+     */                                                             \
+    comp_type_gen__use_SlotMap$(T)
+#define decl_SlotMap$(T)                                     \
+    /**                                                      \
+     * @brief Declare typed slot map structure               \
+     * @param T Type of items                                \
+     * @example                                              \
+     *     decl_SlotMap$(i32); // Declare i32 slot map union \
+     */                                                      \
+    comp_type_gen__decl_SlotMap$(T)
+#define impl_SlotMap$(T)                                              \
+    /**                                                               \
+     * @brief Implement typed slot map structure                      \
+     * @param T Type of items                                         \
+     * @example                                                       \
+     *     impl_SlotMap$(i32); // Implement previously declared union \
+     */                                                               \
+    comp_type_gen__impl_SlotMap$(T)
+
+#define SlotMap$(T)                                       \
+    /**                                                   \
+     * @brief Create a slot map type                      \
+     * @param T Type of items                             \
+     * @return Slot map type alias                        \
+     * @example                                           \
+     *     SlotMap$(i32) map; // Create a slot map of i32 \
+     */                                                   \
+    comp_type_alias__SlotMap$(T)
+
+/// Handle of item (stale once the item is removed, even if its slot is reused)
+typedef struct SlotMap_Handle {
+    u32 index; ///< Slot of the item
+    u32 gen;   ///< Generation of the slot when the item was inserted (always odd)
+} SlotMap_Handle;
+use_Opt$(SlotMap_Handle);
+use_Err$(SlotMap_Handle);
+use_ErrSet$(mem_Allocator_Err, SlotMap_Handle);
+
+/// Handle that never refers to an item
+#define SlotMap_Handle_none ((SlotMap_Handle){ .index = u32_limit_max, .gen = 0 })
+
+/// Slot of item
+typedef struct SlotMap_Slot {
+    u32 gen;   ///< Generation (odd while occupied, even while free)
+    u32 index; ///< Index of item while occupied, next free slot while free
+} SlotMap_Slot;
+
+/// @brief Slot map structure
+/// @details `owners[i]` is the slot of `items[i]`, `slots[s].index` is the index of the item of slot `s`.
+///          Free slots link into a list through their index.
+typedef struct SlotMap {
+    ArrList items;     ///< Live items, densely packed
+    ArrList owners;    ///< Slot of each item (u32)
+    ArrList slots;     ///< Slots (SlotMap_Slot)
+    u32     free_slot; ///< Most recently freed slot
+} SlotMap;
+use_Opt$(SlotMap);
+use_Err$(SlotMap);
+use_ErrSet$(mem_Allocator_Err, SlotMap);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Pack handle into 64 bits (generation in the high half)
+extern fn_(SlotMap_Handle_toBits(SlotMap_Handle self), u64);
+/// @brief Unpack handle from 64 bits
+extern fn_(SlotMap_Handle_fromBits(u64 bits), SlotMap_Handle);
+/// @brief Check if handles refer to the same slot and generation
+extern fn_(SlotMap_Handle_eq(SlotMap_Handle self, SlotMap_Handle other), bool);
+
+/// @brief Initialize an empty slot map
+/// @param type Type information for the items
+/// @param allocator Memory allocator to use
+/// @return Initialized slot map
+extern fn_(SlotMap_init(TypeInfo type, mem_Allocator allocator), SlotMap);
+/// @brief Free resources used by the slot map
+extern fn_(SlotMap_fini(SlotMap* self), void);
+
+/// @brief Ensure the map holds `additional` more items without growing
+extern fn_(SlotMap_ensureUnusedCap(SlotMap* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Get number of live items
+extern fn_(SlotMap_len(const SlotMap* self), usize);
+/// @brief Check if handle refers to a live item
+extern fn_(SlotMap_contains(const SlotMap* self, SlotMap_Handle handle), bool);
+/// @brief Get pointer to item of handle, or none if it was removed
+/// @return Optional pointer to item (valid until next insert or remove)
+extern fn_(SlotMap_get(const SlotMap* self, SlotMap_Handle handle), Opt$meta_Ptr);
+/// @brief Get handle of item at dense index (for use while iterating `items`)
+extern fn_(SlotMap_handleAt(const SlotMap* self, usize index), SlotMap_Handle);
+
+/// @brief Add item
+/// @return Handle of the item
+extern fn_(SlotMap_insert(SlotMap* self, meta_Ptr item), $must_check mem_Allocator_Err$SlotMap_Handle);
+/// @brief Remove item of handle (the last item moves into its place)
+/// @return Whether the handle referred to a live item
+extern fn_(SlotMap_remove(SlotMap* self, SlotMap_Handle handle), bool);
+/// @brief Remove all items and retain the allocated capacity (all handles become stale)
+extern fn_(SlotMap_clearRetainingCap(SlotMap* self), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_SlotMap$(T) \
+    decl_SlotMap$(T);                  \
+    impl_SlotMap$(T)
+#define comp_type_gen__decl_SlotMap$(T) \
+    typedef union SlotMap$(T) SlotMap$(T)
+#define comp_type_gen__impl_SlotMap$(T)      \
+    union SlotMap$(T) {                      \
+        SlotMap base[1];                     \
+        struct {                             \
+            union {                          \
+                ArrList base[1];             \
+                struct {                     \
+                    TypeInfo type;           \
+                    Sli$(T) items;           \
+                    usize         cap;       \
+                    mem_Allocator allocator; \
+                };                           \
+            } items;                         \
+            ArrList owners;                  \
+            ArrList slots;                   \
+            u32     free_slot;               \
+        };                                   \
+    }
+
+#define comp_type_alias__SlotMap$(T) \
+    pp_join($, SlotMap, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* SLOT_MAP_INCLUDED */
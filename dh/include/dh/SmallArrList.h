@@ -0,0 +1,193 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    SmallArrList.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-15 (date of creation)
+ * @updated 2025-04-15 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  SmallArrList
+ *
+ * @brief   Array list with inline storage
+ * @details Keeps the first N elements in storage embedded in the list itself and only
+ *          allocates once it spills past N (then grows like ArrList).
+ *          While inline, `items` points into the list, so a list is initialized
+ *          in place and must not be copied or moved while it holds inline items.
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+use_SmallArrList$(8, i32);                                 // Declare and implement list of 8 inline i32
+var_(list, SmallArrList$8$i32) = {};                       // Storage of the list (inline items included)
+SmallArrList_init$(&list, allocator);                      // Initialize in place
+
+/* Operations */
+SmallArrList_append(list.base, meta_refPtr(&item));        // Add item to end (allocates only past 8 items)
+SmallArrList_insert(list.base, index, meta_refPtr(&item)); // Insert item at index
+SmallArrList_removeSwap(list.base, index);                 // Remove item in O(1)
+SmallArrList_isInline(list.base);                          // Check if items are still inline
+SmallArrList_toOwnedSli(list.base);                        // Move items into allocated slice
+SmallArrList_fini(list.base);                              // Free resources
+#endif /* CHEAT_SHEET */
+
+#ifndef SMALL_ARR_LIST_INCLUDED
+#define SMALL_ARR_LIST_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_SmallArrList$(N, T)                                                     \
+    /**                                                                             \
+     * @brief Declare and implement typed array list with inline storage            \
+     * @param N Number of inline elements                                           \
+     * @param T Type of elements to store in the list                               \
+     * @example                                                                     \
+     *     use_SmallArrList$(8, i32); // Declare and implement list of 8 inline i32 \
+     */                                                                             \
+    comp_type_gen__use_SmallArrList$(N, T)
+#define decl_SmallArrList$(N, T)                                        \
+    /**                                                                 \
+     * @brief Declare typed array list with inline storage              \
+     * @param N Number of inline elements                               \
+     * @param T Type of elements to store in the list                   \
+     * @example                                                         \
+     *     decl_SmallArrList$(8, i32); // Declare list union            \
+     */                                                                 \
+    comp_type_gen__decl_SmallArrList$(N, T)
+#define impl_SmallArrList$(N, T)                                              \
+    /**                                                                       \
+     * @brief Implement typed array list with inline storage                  \
+     * @param N Number of inline elements                                     \
+     * @param T Type of elements to store in the list                         \
+     * @example                                                               \
+     *     impl_SmallArrList$(8, i32); // Implement previously declared union \
+     */                                                                       \
+    comp_type_gen__impl_SmallArrList$(N, T)
+
+#define SmallArrList$(N, T)                                                  \
+    /**                                                                      \
+     * @brief Create an array list type with inline storage                  \
+     * @param N Number of inline elements                                    \
+     * @param T Type of elements to store in the list                        \
+     * @return Array list type alias                                         \
+     * @example                                                              \
+     *     SmallArrList$(8, i32) list; // List of i32 with 8 inline elements \
+     */                                                                      \
+    comp_type_alias__SmallArrList$(N, T)
+
+#define SmallArrList_init$(_self, _allocator)                              \
+    /**                                                                    \
+     * @brief Initialize typed list in place                               \
+     * @param _self Pointer to typed list                                  \
+     * @param _allocator Memory allocator to use once items spill          \
+     * @details Element type and inline capacity come from the list type   \
+     * @example                                                            \
+     *     var_(list, SmallArrList$8$i32) = {};                            \
+     *     SmallArrList_init$(&list, allocator);                           \
+     */                                                                    \
+    comp_op__SmallArrList_init$(_self, _allocator)
+
+/// @brief Array list structure with inline storage
+/// @details Inline storage of `inline_cap` elements follows this structure in typed lists
+///          (at the next multiple of the element alignment). `cap == inline_cap` while inline.
+typedef struct SmallArrList {
+    meta_Sli      items;      ///< Slice containing the elements with meta
+    usize         cap;        ///< Current capacity of the list
+    mem_Allocator allocator;  ///< Memory allocator to use once items spill
+    usize         inline_cap; ///< Number of inline elements
+} SmallArrList;
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize an empty list in place
+/// @param self Pointer to list followed by its inline storage
+/// @param type Type information for the elements
+/// @param inline_cap Number of inline elements
+/// @param allocator Memory allocator to use once items spill
+extern fn_(SmallArrList_init(SmallArrList* self, TypeInfo type, usize inline_cap, mem_Allocator allocator), void);
+/// @brief Free resources used by the list
+extern fn_(SmallArrList_fini(SmallArrList* self), void);
+
+/// @brief Check if items are still held in inline storage
+extern fn_(SmallArrList_isInline(const SmallArrList* self), bool);
+/// @brief Move items into a new owned slice (caller takes ownership of memory)
+/// @details Resets the list to its empty inline state
+extern fn_(SmallArrList_toOwnedSli(SmallArrList* self), $must_check mem_Allocator_Err$meta_Sli);
+
+/// @brief Ensure capacity for at least `new_cap` elements
+extern fn_(SmallArrList_ensureTotalCap(SmallArrList* self, usize new_cap), $must_check mem_Allocator_Err$void);
+/// @brief Ensure capacity for at least `additional` more elements
+extern fn_(SmallArrList_ensureUnusedCap(SmallArrList* self, usize additional), $must_check mem_Allocator_Err$void);
+
+/// @brief Add item to end
+extern fn_(SmallArrList_append(SmallArrList* self, meta_Ptr item), $must_check mem_Allocator_Err$void);
+/// @brief Add items to end
+extern fn_(SmallArrList_appendSli(SmallArrList* self, meta_Sli items), $must_check mem_Allocator_Err$void);
+/// @brief Add one uninitialized element to end and get pointer to it
+extern fn_(SmallArrList_addBackOne(SmallArrList* self), $must_check mem_Allocator_Err$meta_Ptr);
+/// @brief Insert item at index, shifting following items
+extern fn_(SmallArrList_insert(SmallArrList* self, usize index, meta_Ptr item), $must_check mem_Allocator_Err$void);
+
+/// @brief Remove last item
+/// @return Optional pointer to the removed item (valid until next modification)
+extern fn_(SmallArrList_popOrNull(SmallArrList* self), Opt$meta_Ptr);
+/// @brief Remove item at index, shifting following items
+/// @return Pointer to the removed item (valid until next modification)
+extern fn_(SmallArrList_removeOrdered(SmallArrList* self, usize index), meta_Ptr);
+/// @brief Remove item at index, replacing it with the last item
+/// @return Pointer to the removed item (valid until next modification)
+extern fn_(SmallArrList_removeSwap(SmallArrList* self, usize index), meta_Ptr);
+
+/// @brief Remove all items and retain the capacity
+extern fn_(SmallArrList_clearRetainingCap(SmallArrList* self), void);
+/// @brief Remove all items, free the allocation and return to inline storage
+extern fn_(SmallArrList_clearAndFree(SmallArrList* self), void);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_SmallArrList$(N, T) \
+    decl_SmallArrList$(N, T);                  \
+    impl_SmallArrList$(N, T)
+#define comp_type_gen__decl_SmallArrList$(N, T) \
+    typedef union SmallArrList$(N, T) SmallArrList$(N, T)
+#define comp_type_gen__impl_SmallArrList$(N, T) \
+    union SmallArrList$(N, T) {                 \
+        SmallArrList base[1];                   \
+        struct {                                \
+            TypeInfo type;                      \
+            Sli$(T) items;                      \
+            usize         cap;                  \
+            mem_Allocator allocator;            \
+            usize         inline_cap;           \
+            T             inline_items[N];      \
+        };                                      \
+    }
+
+#define comp_type_alias__SmallArrList$(N, T) \
+    pp_join3($, SmallArrList, N, T)
+
+#define comp_op__SmallArrList_init$(_self, _allocator) \
+    SmallArrList_init(                                  \
+        (_self)->base,                                  \
+        typeInfo$(TypeOf(*(_self)->inline_items)),      \
+        countOf((_self)->inline_items),                 \
+        _allocator                                      \
+    )
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* SMALL_ARR_LIST_INCLUDED */
@@ -0,0 +1,171 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    SpscRing.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-21 (date of creation)
+ * @updated 2025-04-21 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)
+ * @prefix  SpscRing
+ *
+ * @brief   Wait-free single-producer/single-consumer ring buffer
+ * @details Exactly one thread writes and exactly one thread reads. The producer reserves
+ *          a contiguous run of slots, fills it in place and commits it with one release
+ *          store; the consumer peeks and consumes runs the same way, so batches cost one
+ *          atomic operation each. Each side keeps a cached copy of the other side's index
+ *          on its own cache line and rereads the shared index only when the cache says
+ *          the ring is full (or empty).
+ */
+
+/*========== Cheat Sheet ====================================================*/
+
+#if CHEAT_SHEET
+/* Type Declarations */
+SpscRing     ring = try_(SpscRing_init(typeInfo$(i32), 1024, allocator));                       // Capacity rounded up to a power of 2
+SpscRing$i32 ring = type$(SpscRing$i32, try_(SpscRing_init(typeInfo$(i32), 1024, allocator))); // Typed ring
+
+/* Producer thread */
+let dst = meta_castSli$(Sli$i32, SpscRing_reserve(ring.base, 64)); // Up to 64 writable slots (shorter at wrap or when full)
+SpscRing_commit(ring.base, dst.len);                               // Publish filled slots
+SpscRing_tryPush(ring.base, meta_refPtr(&item));                   // Copy single item, false if full
+
+/* Consumer thread */
+let src = meta_castSli$(Sli$i32, SpscRing_peek(ring.base, 64)); // Up to 64 readable items (shorter at wrap or when empty)
+SpscRing_consume(ring.base, src.len);                           // Release read slots to the producer
+SpscRing_tryPop(ring.base, meta_refPtr(&item));                 // Copy single item out, false if empty
+#endif /* CHEAT_SHEET */
+
+#ifndef SPSC_RING_INCLUDED
+#define SPSC_RING_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "core.h"
+#include "opt.h"
+#include "err_res.h"
+#include "atomic.h"
+#include "mem/Allocator.h"
+
+/*========== Macros and Declarations ========================================*/
+
+#define use_SpscRing$(T)                                         \
+    /**                                                          \
+     * @brief Declare and implement typed SPSC ring              \
+     * @param T Type of items                                    \
+     * @example                                                  \
+     *     use_SpscRing$(i32); // Declare and implement i32 ring \
+     */                                                          \
+    comp_type_gen__use_SpscRing$(T)
+#define decl_SpscRing$(T)                                 \
+    /**                                                   \
+     * @brief Declare typed SPSC ring structure           \
+     * @param T Type of items                             \
+     * @example                                           \
+     *     decl_SpscRing$(i32); // Declare i32 ring union \
+     */                                                   \
+    comp_type_gen__decl_SpscRing$(T)
+#define impl_SpscRing$(T)                                              \
+    /**                                                                \
+     * @brief Implement typed SPSC ring structure                      \
+     * @param T Type of items                                          \
+     * @example                                                        \
+     *     impl_SpscRing$(i32); // Implement previously declared union \
+     */                                                                \
+    comp_type_gen__impl_SpscRing$(T)
+
+#define SpscRing$(T)                                          \
+    /**                                                       \
+     * @brief Create an SPSC ring type                        \
+     * @param T Type of items                                 \
+     * @return SPSC ring type alias                           \
+     * @example                                               \
+     *     SpscRing$(i32) ring; // Create an SPSC ring of i32 \
+     */                                                       \
+    comp_type_alias__SpscRing$(T)
+
+/// @brief SPSC ring structure
+/// @details Positions grow without bound and are masked into the ring, so `head - tail`
+///          is the number of committed items that have not been consumed yet.
+typedef struct SpscRing {
+    atomic_Value$(usize) head $align(atomic_cache_line); ///< Next position to write (stored by producer)
+    usize                tail_cached;                    ///< Producer's copy of tail
+    atomic_Value$(usize) tail $align(atomic_cache_line); ///< Next position to read (stored by consumer)
+    usize                head_cached;                    ///< Consumer's copy of head
+    TypeInfo             type $align(atomic_cache_line); ///< Type information for the items
+    usize                mask;                           ///< Capacity minus one (capacity is a power of 2)
+    u8*                  items;                          ///< Ring of items
+    mem_Allocator        allocator;                      ///< Memory allocator to use
+} SpscRing;
+use_Opt$(SpscRing);
+use_Err$(SpscRing);
+use_ErrSet$(mem_Allocator_Err, SpscRing);
+
+/*========== Function Prototypes ============================================*/
+
+/// @brief Initialize ring with room for at least `cap` items
+/// @param type Type information for the items
+/// @param cap Minimum capacity (rounded up to a power of 2, at least 2)
+/// @param allocator Memory allocator to use (only used here and in fini)
+/// @return Initialized ring (must not be moved once shared between threads)
+extern fn_(SpscRing_init(TypeInfo type, usize cap, mem_Allocator allocator), $must_check mem_Allocator_Err$SpscRing);
+/// @brief Free resources used by the ring (neither thread may use it anymore)
+extern fn_(SpscRing_fini(SpscRing* self), void);
+
+/// @brief Get number of items the ring holds
+extern fn_(SpscRing_cap(const SpscRing* self), usize);
+/// @brief Get number of committed, unconsumed items (exact only from a quiescent ring)
+extern fn_(SpscRing_lenApprox(const SpscRing* self), usize);
+
+/// @brief Reserve up to `n` contiguous slots to write in place (producer only)
+/// @return Writable slots, shorter than `n` at the ring's end or when nearly full (empty when full)
+extern fn_(SpscRing_reserve(SpscRing* self, usize n), meta_Sli);
+/// @brief Publish the first `n` slots of the last reservation to the consumer (producer only)
+extern fn_(SpscRing_commit(SpscRing* self, usize n), void);
+/// @brief Copy item into the ring unless it is full (producer only)
+/// @return Whether the item was pushed
+extern fn_(SpscRing_tryPush(SpscRing* self, meta_Ptr item), bool);
+
+/// @brief Get up to `n` contiguous committed items to read in place (consumer only)
+/// @return Readable items, shorter than `n` at the ring's end or when nearly empty (empty when empty)
+extern fn_(SpscRing_peek(SpscRing* self, usize n), meta_Sli);
+/// @brief Release the first `n` items of the last peek back to the producer (consumer only)
+extern fn_(SpscRing_consume(SpscRing* self, usize n), void);
+/// @brief Copy oldest item into `out` unless the ring is empty (consumer only)
+/// @return Whether an item was popped
+extern fn_(SpscRing_tryPop(SpscRing* self, meta_Ptr out), bool);
+
+/*========== Macros and Definitions =========================================*/
+
+#define comp_type_gen__use_SpscRing$(T) \
+    decl_SpscRing$(T);                  \
+    impl_SpscRing$(T)
+#define comp_type_gen__decl_SpscRing$(T) \
+    typedef union SpscRing$(T) SpscRing$(T)
+#define comp_type_gen__impl_SpscRing$(T)                         \
+    union SpscRing$(T) {                                         \
+        SpscRing base[1];                                        \
+        struct {                                                 \
+            atomic_Value$(usize) head $align(atomic_cache_line); \
+            usize                tail_cached;                    \
+            atomic_Value$(usize) tail $align(atomic_cache_line); \
+            usize                head_cached;                    \
+            TypeInfo             type $align(atomic_cache_line); \
+            usize                mask;                           \
+            u8*                  items;                          \
+            mem_Allocator        allocator;                      \
+            rawptr$(T) __item_type_hint[0];                      \
+        };                                                       \
+    }
+
+#define comp_type_alias__SpscRing$(T) \
+    pp_join($, SpscRing, T)
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* SPSC_RING_INCLUDED */
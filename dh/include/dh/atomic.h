@@ -5,7 +5,7 @@
  * @file    atomic.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-22 (date of creation)
- * @updated 2025-02-01 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.1
  * @ingroup dasae-headers(dh)/atomic
  * @prefix  atomic
@@ -123,27 +123,19 @@ typedef enum atomic_MemOrd {
 
 /**
  * Atomically compare and exchange value if expected matches
- * Returns the previous value
+ * Returns whether the value was exchanged, on failure the current value is stored to expected.
+ * May fail spuriously, so use it in a retry loop.
  */
-#define atomic_cmpxchgWeak$(T, _ptr, _expected_ptr, _desired_val, _success_order, _fail_order) ({ \
-    T          __expected = *(_expected_ptr);                                                     \
-    const bool __success  = __atomic_compare_exchange_n(                                          \
-        (_ptr), (_expected_ptr), (_desired_val), true, (_success_order), (_fail_order)           \
-    );                                                                                           \
-    eval_return __success ? null : __expected;                                                    \
-})
+#define atomic_cmpxchgWeak$(T, _ptr, _expected_ptr, val_desired, val_success_order, val_fail_order) \
+    _Generic((_ptr), volatile rawptr$(T): __atomic_compare_exchange_n((_ptr), (_expected_ptr), (val_desired), true, (val_success_order), (val_fail_order)))
 
 /**
  * Atomically compare and exchange value if expected matches
- * Returns the previous value. Retries on weak failures.
+ * Returns whether the value was exchanged, on failure the current value is stored to expected.
+ * Never fails spuriously.
  */
-#define atomic_cmpxchgStrong$(T, _ptr, _expected_ptr, _desired_val, _success_order, _fail_order) ({ \
-    T          __expected = *(_expected_ptr);                                                       \
-    const bool __success  = __atomic_compare_exchange_n(                                            \
-        (_ptr), (_expected_ptr), (_desired_val), false, (_success_order), (_fail_order)            \
-    );                                                                                             \
-    eval_return __success ? null : __expected;                                                      \
-})
+#define atomic_cmpxchgStrong$(T, _ptr, _expected_ptr, val_desired, val_success_order, val_fail_order) \
+    _Generic((_ptr), volatile rawptr$(T): __atomic_compare_exchange_n((_ptr), (_expected_ptr), (val_desired), false, (val_success_order), (val_fail_order)))
 
 /**
  * Atomically add a value and return previous value
@@ -5,7 +5,7 @@
  * @file    comp.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2024-11-03 (date of creation)
- * @updated 2025-03-27 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.4
  * @ingroup dasae-headers(dh)/bti
  * @prefix  NONE
@@ -62,6 +62,19 @@ extern "C" {
      *          not return a value                                        \
      */                                                                   \
     comp_attr__$no_return
+#define $thread_local                                                     \
+    /**                                                                   \
+     * @brief Attribute gives a static variable one instance per thread   \
+     * @details Each thread observes its own copy of the variable         \
+     */                                                                   \
+    comp_attr__$thread_local
+#define $align(_Align)                                                    \
+    /**                                                                   \
+     * @brief Attribute aligns a type or variable to at least `_Align`    \
+     * @details Used e.g. to keep data written by different threads on   \
+     *          separate cache lines                                      \
+     */                                                                   \
+    comp_attr__$align(_Align)
 #define $ignore                                                           \
     /**                                                                   \
      * @brief Attribute explicitly $ignores an expression or return value \
@@ -153,9 +166,11 @@ extern "C" {
 #define comp_attr__$on_load __attribute__((constructor))
 #define comp_attr__$on_exit __attribute__((destructor))
 
-#define comp_attr__$must_check BUILTIN_COMP_MUST_CHECK
-#define comp_attr__$no_return  BUILTIN_COMP_NO_RETURN
-#define comp_attr__$ignore     (void)
+#define comp_attr__$must_check    BUILTIN_COMP_MUST_CHECK
+#define comp_attr__$no_return     BUILTIN_COMP_NO_RETURN
+#define comp_attr__$thread_local  BUILTIN_COMP_THREAD_LOCAL
+#define comp_attr__$align(_Align) BUILTIN_COMP_ALIGN(_Align)
+#define comp_attr__$ignore        (void)
 
 #define comp_attr__$used(_Expr...) _Expr
 /* begin unused */
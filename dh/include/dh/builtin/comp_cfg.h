@@ -81,6 +81,7 @@ extern "C" {
 #define BUILTIN_COMP_DEPRECATED_INSTEAD(_msg, _replacement) __declspec(deprecated(_msg, _replacement))
 #define BUILTIN_COMP_NO_RETURN                              __declspec(noreturn)
 #define BUILTIN_COMP_MUST_CHECK                             _Must_inspect_result_
+#define BUILTIN_COMP_THREAD_LOCAL                           __declspec(thread)
 #elif BUILTIN_COMP_GCC || BUILTIN_COMP_CLANG
 #define BUILTIN_COMP_INLINE                                 inline
 #define BUILTIN_COMP_FORCE_INLINE                           __attribute__((always_inline)) inline
@@ -91,6 +92,7 @@ extern "C" {
 #define BUILTIN_COMP_DEPRECATED_INSTEAD(_msg, _replacement) __attribute__((deprecated(_msg, _replacement)))
 #define BUILTIN_COMP_NO_RETURN                              __attribute__((noreturn))
 #define BUILTIN_COMP_MUST_CHECK                             __attribute__((warn_unused_result))
+#define BUILTIN_COMP_THREAD_LOCAL                           __thread
 #else
 #define BUILTIN_COMP_INLINE
 #define BUILTIN_COMP_FORCE_INLINE
@@ -100,6 +102,7 @@ extern "C" {
 #define BUILTIN_COMP_DEPRECATED_MSG(_msg)
 #define BUILTIN_COMP_NO_RETURN
 #define BUILTIN_COMP_MUST_CHECK
+#define BUILTIN_COMP_THREAD_LOCAL                           _Thread_local
 #endif
 
 /*========== Calling Conventions ============================================*/
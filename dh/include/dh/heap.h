@@ -16,6 +16,10 @@
  *          - Page: Page-aligned memory allocation for large blocks
  *          - Fixed: Fixed-size block allocator for efficient memory reuse
  *          - Arena: Region-based memory allocation for bulk operations
+ *          - Pool: Slab-backed allocator for same-sized objects with O(1) free
+ *          - Gpa: General purpose size-class allocator with per-thread caches
+ *          - StackFallback: Inline buffer allocator spilling to another allocator
+ *          - Buddy: Power-of-two block allocator over a fixed region with real free
  *
  *          All implementations follow strict memory safety practices and
  *          include built-in error detection. Memory leaks are prevented
@@ -35,6 +39,10 @@ extern "C" {
 #include "heap/Page.h"
 #include "heap/Fixed.h"
 #include "heap/Arena.h"
+#include "heap/Pool.h"
+#include "heap/Gpa.h"
+#include "heap/StackFallback.h"
+#include "heap/Buddy.h"
 
 #if defined(__cplusplus)
 } /* extern "C" */
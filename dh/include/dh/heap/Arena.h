@@ -5,7 +5,7 @@
  * @file    Arena.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-03-26 (date of creation)
- * @updated 2025-03-26 (date of last update)
+ * @updated 2025-04-04 (date of last update)
  * @version v0.1-alpha.1
  * @ingroup dasae-headers(dh)/heap
  * @prefix  heap_Arena
@@ -13,6 +13,10 @@
  * @brief   Arena allocator that wraps another allocator for bulk freeing
  * @details Takes an existing allocator, wraps it, and provides an interface
  *          where you can allocate without freeing, and then free it all together.
+ *          Savepoints (mark/restore) roll back any nested allocations at once,
+ *          and each thread owns a pair of scratch arenas for temporaries.
+ *          heap_Arena_ThrdSafe is a variant shared by many threads, bumping
+ *          with atomic fetch-add and chaining new buffers without a lock.
  */
 
 #ifndef HEAP_ARENA_INCLUDED
@@ -25,6 +29,7 @@ extern "C" {
 
 #include "cfg.h"
 #include "dh/list.h"
+#include "dh/atomic.h"
 
 /*========== Arena Allocator ===============================================*/
 
@@ -38,6 +43,14 @@ typedef struct heap_Arena_State {
 /// Inner state of ArenaAllocator
 extern fn_(heap_Arena_State_promote(heap_Arena_State* self, mem_Allocator child_allocator), heap_Arena);
 
+/// Savepoint of arena state
+typedef struct heap_Arena_Mark {
+    Opt$Ptr$ListSgl_Node$usize node;      ///< Newest buffer at time of mark
+    usize                      end_index; ///< End index within that buffer
+} heap_Arena_Mark;
+/// Take savepoint of current state
+extern fn_(heap_Arena_State_mark(const heap_Arena_State* self), heap_Arena_Mark);
+
 struct heap_Arena {
     mem_Allocator    child_allocator;
     heap_Arena_State state;
@@ -63,6 +76,63 @@ extern fn_(heap_Arena_queryCap(const heap_Arena* self), usize);
 /// Reset arena with specified mode
 extern fn_(heap_Arena_reset(heap_Arena* self, heap_Arena_ResetMode mode), bool);
 
+/// Take savepoint of current state
+extern fn_(heap_Arena_mark(const heap_Arena* self), heap_Arena_Mark);
+/// Roll back every allocation made since savepoint (buffers acquired after it are freed)
+/// Savepoints must be restored in LIFO order and are invalidated by reset
+extern fn_(heap_Arena_restore(heap_Arena* self, heap_Arena_Mark mark), void);
+
+/*========== Scratch Arenas =================================================*/
+
+/// Temporary region of a thread-local scratch arena
+typedef struct heap_Arena_Scratch {
+    heap_Arena*     arena;
+    heap_Arena_Mark mark;
+} heap_Arena_Scratch;
+
+/// Begin temporary region on calling thread's scratch arena that is not `conflict`
+/// Pass the arena backing an output allocator as `conflict` (or null) so results survive the region
+extern fn_(heap_Arena_scratchBegin(anyptr_const conflict), heap_Arena_Scratch);
+/// End temporary region, freeing everything allocated in it
+extern fn_(heap_Arena_scratchEnd(heap_Arena_Scratch scratch), void);
+/// Get allocator interface for temporary region
+extern fn_(heap_Arena_Scratch_allocator(heap_Arena_Scratch scratch), mem_Allocator);
+/// Release calling thread's scratch arenas (call before thread exit)
+extern fn_(heap_Arena_scratchFini(void), void);
+
+/// Begin scratch region bound to `_Capture` and end it at scope exit (requires fn_scope_ext/block_defer)
+#define heap_Arena_scratch_defer(_Capture, val_conflict...) \
+    let _Capture = heap_Arena_scratchBegin(val_conflict);   \
+    defer_(heap_Arena_scratchEnd(_Capture))
+
+/*========== Thread-Safe Arena ==============================================*/
+
+/// Buffer header of thread-safe arena (bump index lives in each buffer)
+typedef struct heap_Arena_ThrdSafe_Chunk heap_Arena_ThrdSafe_Chunk;
+struct heap_Arena_ThrdSafe_Chunk {
+    heap_Arena_ThrdSafe_Chunk* next;      ///< Older buffer
+    usize                      len;       ///< Total length of buffer including header
+    atomic_Value$(usize)       end_index; ///< Bytes reserved within buffer (may exceed capacity when full)
+};
+
+/// Arena that many threads may allocate from concurrently without a mutex
+typedef struct heap_Arena_ThrdSafe {
+    mem_Allocator        child_allocator; ///< Must itself be thread-safe
+    atomic_Value$(usize) current;         ///< Address of newest buffer (0 if none)
+} heap_Arena_ThrdSafe;
+
+/// Get allocator interface for instance (alloc is lock-free, free/resize only shrink in place)
+extern fn_(heap_Arena_ThrdSafe_allocator(heap_Arena_ThrdSafe* self), mem_Allocator);
+
+/// Initialize with child allocator
+extern fn_(heap_Arena_ThrdSafe_init(mem_Allocator child_allocator), heap_Arena_ThrdSafe);
+/// Deinitialize and free all memory (no thread may use the arena anymore)
+extern fn_(heap_Arena_ThrdSafe_fini(heap_Arena_ThrdSafe self), void);
+/// Query current memory capacity of arena
+extern fn_(heap_Arena_ThrdSafe_queryCap(const heap_Arena_ThrdSafe* self), usize);
+/// Free all memory (no thread may use the arena concurrently)
+extern fn_(heap_Arena_ThrdSafe_reset(heap_Arena_ThrdSafe* self), void);
+
 #if defined(__cplusplus)
 } /* extern "C" */
 #endif /* defined(__cplusplus) */
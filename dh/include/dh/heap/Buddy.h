@@ -0,0 +1,80 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Buddy.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-05 (date of creation)
+ * @updated 2025-04-05 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)/heap
+ * @prefix  heap_Buddy
+ *
+ * @brief   Buddy system allocator over a fixed memory region
+ * @details Manages a predefined buffer as power-of-two blocks. Allocation splits
+ *          the smallest fitting free block in halves, and free merges a block with
+ *          its buddy for as long as the buddy is free, both in O(log n).
+ *          Unlike heap_Fixed any allocation can be freed, and resize shrinks or
+ *          grows in place by splitting or absorbing buddies.
+ *          A small bitmap marking free blocks is kept at the end of the buffer.
+ */
+
+#ifndef HEAP_BUDDY_INCLUDED
+#define HEAP_BUDDY_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+
+/*========== Buddy Allocator ================================================*/
+
+/// Smallest block size (log2), large enough to hold a free block header
+#define heap_Buddy_min_block_log2 (5)
+/// Smallest block size
+#define heap_Buddy_min_block_size (as$(usize, 1) << heap_Buddy_min_block_log2)
+/// Number of block orders (largest block is min_block_size << (order_count - 1))
+#define heap_Buddy_order_count    (48)
+
+/// Free block header (stored in-place inside each free block)
+typedef struct heap_Buddy_Block heap_Buddy_Block;
+
+/// Buddy allocator instance
+typedef struct heap_Buddy {
+    Sli$u8            buffer;                                ///< Managed region (multiple of min block size)
+    Sli$u8            free_map;                              ///< One bit per min block, set where a free block starts
+    heap_Buddy_Block* free_lists[heap_Buddy_order_count];    ///< Doubly linked free blocks of each order
+    usize             used_len;                              ///< Bytes held by allocated blocks
+    usize             requested_len;                         ///< Bytes requested by callers
+    usize             alloc_count;                           ///< Number of live allocations
+} heap_Buddy;
+
+/// Occupancy statistics
+typedef struct heap_Buddy_Stats {
+    usize capacity;         ///< Managed bytes
+    usize used_len;         ///< Bytes held by allocated blocks
+    usize requested_len;    ///< Bytes requested by callers (used_len minus internal fragmentation)
+    usize free_len;         ///< Bytes in free blocks
+    usize largest_free_len; ///< Largest block that can be allocated right now
+    usize free_block_count; ///< Number of free blocks (external fragmentation)
+    usize alloc_count;      ///< Number of live allocations
+} heap_Buddy_Stats;
+
+/// Get allocator interface for instance
+extern fn_(heap_Buddy_allocator(heap_Buddy* self), mem_Allocator);
+
+/// Initialize with buffer (buffer must outlive allocator)
+extern fn_(heap_Buddy_init(Sli$u8 buf), heap_Buddy);
+/// Reset allocator state (frees all allocations)
+extern fn_(heap_Buddy_reset(heap_Buddy* self), void);
+/// Check if allocator owns a pointer
+extern fn_(heap_Buddy_ownsPtr(const heap_Buddy* self, Ptr_const$u8 ptr), bool);
+/// Query occupancy statistics
+extern fn_(heap_Buddy_queryStats(const heap_Buddy* self), heap_Buddy_Stats);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HEAP_BUDDY_INCLUDED */
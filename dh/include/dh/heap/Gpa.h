@@ -0,0 +1,56 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Gpa.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-03 (date of creation)
+ * @updated 2025-04-03 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)/heap
+ * @prefix  heap_Gpa
+ *
+ * @brief   General purpose allocator with size classes and per-thread caches
+ * @details Small requests are rounded up to a power-of-two size class and served
+ *          from spans obtained through heap_Page. Each thread works on its own
+ *          cache of free lists (protected by an uncontended spin flag, rotating
+ *          to another cache on contention), so the common path takes no shared
+ *          lock. Requests larger than the biggest size class go straight to
+ *          heap_Page. Span memory is recycled but never returned to the OS.
+ */
+
+#ifndef HEAP_GPA_INCLUDED
+#define HEAP_GPA_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+
+/*========== General Purpose Allocator ======================================*/
+
+/// Smallest size class (log2)
+#define heap_Gpa_min_class_log2   (4)
+/// Largest size class (log2), larger requests are passed to heap_Page
+#define heap_Gpa_max_class_log2   (13)
+/// Number of small size classes
+#define heap_Gpa_size_class_count (heap_Gpa_max_class_log2 - heap_Gpa_min_class_log2 + 1)
+/// Size of a span requested from heap_Page for small size classes
+#define heap_Gpa_span_size        (mem_page_size < (64ull * 1024ull) ? (64ull * 1024ull) : mem_page_size)
+/// Number of thread caches shared by all threads
+#define heap_Gpa_cache_count      (64)
+
+/// General purpose allocator instance (minimal state, caches are process-wide)
+typedef struct heap_Gpa {
+    Void unused_[0]; /* Empty struct not allowed in C */
+} heap_Gpa;
+
+/// Get allocator interface for instance
+extern fn_(heap_Gpa_allocator(heap_Gpa* self), mem_Allocator);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HEAP_GPA_INCLUDED */
@@ -5,7 +5,7 @@
  * @file    Page.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-15 (date of creation)
- * @updated 2025-03-20 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.1
  * @ingroup dasae-headers(dh)/heap
  * @prefix  heap_Page
@@ -13,6 +13,10 @@
  * @brief   Page allocator using OS virtual memory APIs
  * @details Uses OS-level virtual memory APIs to allocate memory in page-sized blocks.
  *          Provides a simple interface for allocating and freeing memory.
+ *          Options enable huge pages, transparent huge page hints, prefaulting and
+ *          retaining freed mappings with their pages handed back to the OS.
+ *          heap_Page_Reserve reserves a fixed virtual range per allocation and
+ *          commits pages on demand, so buffers grow in place without copying.
  */
 
 #ifndef HEAP_PAGE_INCLUDED
@@ -24,16 +28,51 @@ extern "C" {
 /*========== Includes =======================================================*/
 
 #include "cfg.h"
+#include "dh/atomic.h"
 
 /*========== Page Allocator =================================================*/
 
+/// Huge page size assumed when the system does not report one
+#define heap_Page_huge_page_size_fallback (2ull * 1024ull * 1024ull)
+
+/// Options for page allocator (all disabled when zero-initialized)
+typedef struct heap_Page_Opts {
+    bool  huge_pages;             ///< Map explicit huge pages (MAP_HUGETLB/MEM_LARGE_PAGES), falls back to normal pages
+    bool  transparent_huge_pages; ///< Hint kernel to back mappings with transparent huge pages (MADV_HUGEPAGE)
+    bool  populate;               ///< Prefault pages when mapping (MAP_POPULATE)
+    usize huge_page_size;         ///< Huge page size to map (power of 2, zero uses heap_Page_hugePageSize)
+    bool  retain_freed;           ///< Keep freed mappings for reuse with their pages discarded (MADV_DONTNEED), normal pages only
+} heap_Page_Opts;
+
 /// Page allocator instance (minimal state, following Zig's pattern)
 typedef struct heap_Page {
-    Void unused_[0]; /* Empty struct not allowed in C */
+    heap_Page_Opts      opts;
+    atomic_Value$(bool) retained_locked; ///< Guards retained mappings
+    anyptr              retained;        ///< Freed mappings kept for reuse (linked through their first page)
 } heap_Page;
 
-/// Get allocator interface for instance
+/// Initialize with options
+extern fn_(heap_Page_init(heap_Page_Opts opts), heap_Page);
+/// Get allocator interface for instance (instance is only referenced when options are set)
 extern fn_(heap_Page_allocator(heap_Page* self), mem_Allocator);
+/// Unmap every mapping retained by `retain_freed`
+extern fn_(heap_Page_trim(heap_Page* self), void);
+/// Return physical pages of buffer to OS while keeping address range mapped (contents are lost)
+extern fn_(heap_Page_discard(Sli$u8 buf), void);
+/// Get default huge page size of the system (queried once: /proc/meminfo Hugepagesize, GetLargePageMinimum)
+extern fn_(heap_Page_hugePageSize(void), usize);
+
+/*========== Reserving Page Allocator =======================================*/
+
+/// Page allocator that reserves address space up front and commits on demand
+typedef struct heap_Page_Reserve {
+    usize reserve_len; ///< Virtual range reserved for every allocation (page aligned)
+} heap_Page_Reserve;
+
+/// Initialize with size of virtual range reserved per allocation (upper bound of growth)
+extern fn_(heap_Page_Reserve_init(usize reserve_len), heap_Page_Reserve);
+/// Get allocator interface for instance (resize grows in place up to reserve_len, addresses stay stable)
+extern fn_(heap_Page_Reserve_allocator(heap_Page_Reserve* self), mem_Allocator);
 
 /*========== Implementation Details =========================================*/
 
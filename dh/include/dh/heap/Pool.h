@@ -0,0 +1,86 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    Pool.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-02 (date of creation)
+ * @updated 2025-04-02 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)/heap
+ * @prefix  heap_Pool
+ *
+ * @brief   Pool allocator that hands out fixed-size slots carved from slabs
+ * @details Takes an existing allocator, requests slabs from it, and splits each
+ *          slab into equally sized slots. Freed slots are threaded onto an
+ *          intrusive free list, so both allocation and free are O(1).
+ *          Requests larger than a slot (or with stricter alignment) fail.
+ */
+
+#ifndef HEAP_POOL_INCLUDED
+#define HEAP_POOL_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+
+/*========== Pool Allocator =================================================*/
+
+/// Minimum number of slots in the first slab
+#define heap_Pool_min_slots_per_slab (64)
+
+/// Free slot header (stored in-place inside each free slot)
+typedef struct heap_Pool_Slot heap_Pool_Slot;
+use_Ptr$(heap_Pool_Slot);
+use_Opt$(Ptr$heap_Pool_Slot);
+struct heap_Pool_Slot {
+    Opt$Ptr$heap_Pool_Slot next;
+};
+
+/// Slab header (stored at the start of each slab requested from child allocator)
+typedef struct heap_Pool_Slab heap_Pool_Slab;
+use_Ptr$(heap_Pool_Slab);
+use_Opt$(Ptr$heap_Pool_Slab);
+struct heap_Pool_Slab {
+    Opt$Ptr$heap_Pool_Slab next;
+    usize                  len; ///< Total length of slab including header
+};
+
+typedef struct heap_Pool {
+    mem_Allocator          child_allocator;
+    usize                  slot_size;  ///< Size of each slot (at least the size of a free slot header)
+    u32                    slot_align; ///< Alignment of each slot
+    Opt$Ptr$heap_Pool_Slab slabs;      ///< Slabs owned by pool (newest first)
+    usize                  end_index;  ///< Number of slots handed out from newest slab
+    Opt$Ptr$heap_Pool_Slot free_list;  ///< Intrusive list of freed slots
+} heap_Pool;
+
+/// Get allocator interface for instance
+extern fn_(heap_Pool_allocator(heap_Pool* self), mem_Allocator);
+
+/// Initialize with child allocator and type of slot
+extern fn_(heap_Pool_init(mem_Allocator child_allocator, TypeInfo slot_type), heap_Pool);
+/// Deinitialize and free all memory
+extern fn_(heap_Pool_fini(heap_Pool self), void);
+
+/// Reset mode for pool reset operation
+config_UnionEnum(heap_Pool_ResetMode,
+    (heap_Pool_ResetMode_free_all, Void),
+    (heap_Pool_ResetMode_retain_capacity, Void)
+);
+
+/// Query current number of slots owned by pool
+extern fn_(heap_Pool_queryCap(const heap_Pool* self), usize);
+/// Reset pool with specified mode (all slots become free)
+extern fn_(heap_Pool_reset(heap_Pool* self, heap_Pool_ResetMode mode), void);
+
+/// Check if pool owns a pointer
+extern fn_(heap_Pool_ownsPtr(const heap_Pool* self, Ptr_const$u8 ptr), bool);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HEAP_POOL_INCLUDED */
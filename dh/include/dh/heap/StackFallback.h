@@ -0,0 +1,53 @@
+/**
+ * @copyright Copyright (c) 2025 Gyeongtae Kim
+ * @license   MIT License - see LICENSE file for details
+ *
+ * @file    StackFallback.h
+ * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
+ * @date    2025-04-06 (date of creation)
+ * @updated 2025-04-06 (date of last update)
+ * @version v0.1-alpha.1
+ * @ingroup dasae-headers(dh)/heap
+ * @prefix  heap_StackFallback
+ *
+ * @brief   Allocator serving from an inline buffer, spilling to a fallback allocator
+ * @details Allocates from a caller-provided (typically stack) buffer the same way
+ *          heap_Fixed does, and transparently falls back to another allocator once
+ *          the buffer runs out. Resize, remap and free are routed to whichever side
+ *          owns the memory, so buffers that outgrow the inline storage move to the
+ *          fallback allocator through the usual realloc path.
+ */
+
+#ifndef HEAP_STACK_FALLBACK_INCLUDED
+#define HEAP_STACK_FALLBACK_INCLUDED (1)
+#if defined(__cplusplus)
+extern "C" {
+#endif /* defined(__cplusplus) */
+
+/*========== Includes =======================================================*/
+
+#include "cfg.h"
+#include "Fixed.h"
+
+/*========== Stack Fallback Allocator =======================================*/
+
+/// Stack fallback allocator instance
+typedef struct heap_StackFallback {
+    heap_Fixed    fixed;              ///< Allocator over inline buffer
+    mem_Allocator fallback_allocator; ///< Allocator used once inline buffer is exhausted
+} heap_StackFallback;
+
+/// Get allocator interface for instance
+extern fn_(heap_StackFallback_allocator(heap_StackFallback* self), mem_Allocator);
+
+/// Initialize with inline buffer and fallback allocator
+extern fn_(heap_StackFallback_init(Sli$u8 buf, mem_Allocator fallback_allocator), heap_StackFallback);
+/// Reset inline buffer (frees all inline allocations, fallback allocations must be freed separately)
+extern fn_(heap_StackFallback_reset(heap_StackFallback* self), void);
+/// Check if pointer lives in inline buffer
+extern fn_(heap_StackFallback_ownsInline(const heap_StackFallback* self, Ptr_const$u8 ptr), bool);
+
+#if defined(__cplusplus)
+} /* extern "C" */
+#endif /* defined(__cplusplus) */
+#endif /* HEAP_STACK_FALLBACK_INCLUDED */
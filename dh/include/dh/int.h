@@ -5,7 +5,7 @@
  * @file    int.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-03-02 (date of creation)
- * @updated 2025-03-02 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha
  * @ingroup dasae-headers(dh)
  * @prefix  NONE
@@ -110,6 +110,8 @@ force_inline Opt$usize usize_chkdDiv(usize lhs, usize rhs);
 force_inline Opt$usize usize_chkdMod(usize lhs, usize rhs);
 // force_inline Opt$usize usize_chkdInc(usize x);
 // force_inline Opt$usize usize_chkdDec(usize x);
+/// Smallest power of two not less than x (none if it does not fit in usize)
+force_inline Opt$usize usize_chkdNextPow2(usize x);
 
 /*========== Macros and Implementations =====================================*/
 
@@ -376,6 +378,14 @@ force_inline Opt$usize usize_chkdMod(usize lhs, usize rhs) {
 }
 // force_inline Opt$usize usize_chkdInc(usize x) { return usize_chkdAdd(x, 1); }
 // force_inline Opt$usize usize_chkdDec(usize x) { return usize_chkdSub(x, 1); }
+force_inline Opt$usize usize_chkdNextPow2(usize x) {
+    usize result = 1;
+    while (result < x) {
+        if (usize_limit / 2 < result) { return none$(Opt$usize); }
+        result <<= 1;
+    }
+    return some$(Opt$usize, result);
+}
 
 #if defined(__cplusplus)
 } /* extern "C" */
@@ -5,7 +5,7 @@
  * @file    Allocator.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2024-12-07 (date of creation)
- * @updated 2025-03-20 (date of last update)
+ * @updated 2025-04-06 (date of last update)
  * @version v0.1-alpha.2
  * @ingroup dasae-headers(dh)/mem
  * @prefix  mem_Allocator
@@ -32,12 +32,18 @@ config_ErrSet(mem_Allocator_Err, OutOfMemory);
 
 /*========== Allocator Interface ============================================*/
 
+use_Sli$(Ptr$u8);
+
 /// Allocator vtable
 typedef struct mem_Allocator_VT {
     fn_((*alloc)(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
     fn_((*resize)(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_len), bool);
     fn_((*remap)(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_len), Opt$Ptr$u8);
     fn_((*free)(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+    /// Optional: allocate `out.len` buffers of `len` bytes at once (all or nothing), null loops over alloc
+    fn_((*allocMany)(anyptr ctx, usize len, u32 align, Sli$Ptr$u8 out), bool);
+    /// Optional: free buffers of `len` bytes at once, null loops over free
+    fn_((*freeMany)(anyptr ctx, Sli$Ptr$u8 bufs, usize len, u32 align), void);
 } mem_Allocator_VT;
 
 /// Allocator instance
@@ -72,6 +78,10 @@ extern fn_(mem_Allocator_rawResize(mem_Allocator self, Sli$u8 buf, u32 buf_align
 extern fn_(mem_Allocator_rawRemap(mem_Allocator self, Sli$u8 buf, u32 buf_align, usize new_len), Opt$Ptr$u8);
 /// Free mem
 extern fn_(mem_Allocator_rawFree(mem_Allocator self, Sli$u8 buf, u32 buf_align), void);
+/// Raw batched allocation of `out.len` buffers (all or nothing)
+extern fn_(mem_Allocator_rawAllocMany(mem_Allocator self, usize len, u32 align, Sli$Ptr$u8 out), bool);
+/// Free buffers from batched allocation
+extern fn_(mem_Allocator_rawFreeMany(mem_Allocator self, Sli$Ptr$u8 bufs, usize len, u32 align), void);
 
 /*========== High-level Allocator Functions =================================*/
 
@@ -79,6 +89,10 @@ extern fn_(mem_Allocator_rawFree(mem_Allocator self, Sli$u8 buf, u32 buf_align),
 extern fn_(mem_Allocator_create(mem_Allocator self, TypeInfo type), $must_check mem_Allocator_Err$meta_Ptr);
 /// Free single-item
 extern fn_(mem_Allocator_destroy(mem_Allocator self, AnyType ptr), void);
+/// Multiple single-item allocation in one call (fills `out`, all or nothing)
+extern fn_(mem_Allocator_createMany(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 out), $must_check mem_Allocator_Err$void);
+/// Free multiple single-items from createMany
+extern fn_(mem_Allocator_destroyMany(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 ptrs), void);
 /// Slice allocation
 extern fn_(mem_Allocator_alloc(mem_Allocator self, TypeInfo type, usize count), $must_check mem_Allocator_Err$meta_Sli);
 /// Try to resize slice in-place
@@ -103,9 +117,13 @@ extern fn_(mem_Allocator_rawAlloc_debug(mem_Allocator self, usize len, u32 align
 extern fn_(mem_Allocator_rawResize_debug(mem_Allocator self, Sli$u8 buf, u32 buf_align, usize new_len, SrcLoc src_loc), bool);
 extern fn_(mem_Allocator_rawRemap_debug(mem_Allocator self, Sli$u8 buf, u32 buf_align, usize new_len, SrcLoc src_loc), Opt$Ptr$u8);
 extern fn_(mem_Allocator_rawFree_debug(mem_Allocator self, Sli$u8 buf, u32 buf_align, SrcLoc src_loc), void);
+extern fn_(mem_Allocator_rawAllocMany_debug(mem_Allocator self, usize len, u32 align, Sli$Ptr$u8 out, SrcLoc src_loc), bool);
+extern fn_(mem_Allocator_rawFreeMany_debug(mem_Allocator self, Sli$Ptr$u8 bufs, usize len, u32 align, SrcLoc src_loc), void);
 
 extern fn_(mem_Allocator_create_debug(mem_Allocator self, TypeInfo type, SrcLoc src_loc), $must_check mem_Allocator_Err$meta_Ptr);
 extern fn_(mem_Allocator_destroy_debug(mem_Allocator self, AnyType ptr, SrcLoc src_loc), void);
+extern fn_(mem_Allocator_createMany_debug(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 out, SrcLoc src_loc), $must_check mem_Allocator_Err$void);
+extern fn_(mem_Allocator_destroyMany_debug(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 ptrs, SrcLoc src_loc), void);
 extern fn_(mem_Allocator_alloc_debug(mem_Allocator self, TypeInfo type, usize count, SrcLoc src_loc), $must_check mem_Allocator_Err$meta_Sli);
 extern fn_(mem_Allocator_resize_debug(mem_Allocator self, AnyType old_mem, usize new_len, SrcLoc src_loc), bool);
 extern fn_(mem_Allocator_remap_debug(mem_Allocator self, AnyType old_mem, usize new_len, SrcLoc src_loc), Opt$meta_Sli);
@@ -122,10 +140,14 @@ extern fn_(mem_Allocator_dupeZ_debug(mem_Allocator self, meta_Sli src, SrcLoc sr
 #define mem_Allocator_rawResize(_self, _buf, _buf_align, _new_len...) mem_Allocator_rawResize_callDebug((_self), (_buf), (_buf_align), (_new_len), srcLoc())
 #define mem_Allocator_rawRemap(_self, _buf, _buf_align, _new_len...)  mem_Allocator_rawRemap_callDebug((_self), (_buf), (_buf_align), (_new_len), srcLoc())
 #define mem_Allocator_rawFree(_self, _buf, _buf_align...)             mem_Allocator_rawFree_callDebug((_self), (_buf), (_buf_align), srcLoc())
+#define mem_Allocator_rawAllocMany(_self, _len, _align, _out...)      mem_Allocator_rawAllocMany_callDebug((_self), (_len), (_align), (_out), srcLoc())
+#define mem_Allocator_rawFreeMany(_self, _bufs, _len, _align...)      mem_Allocator_rawFreeMany_callDebug((_self), (_bufs), (_len), (_align), srcLoc())
 
 /* Debug versions of high-level operations */
 #define mem_Allocator_create(_self, _type...)                         mem_Allocator_create_callDebug((_self), (_type), srcLoc())
 #define mem_Allocator_destroy(_self, _ptr...)                         mem_Allocator_destroy_callDebug((_self), (_ptr), srcLoc())
+#define mem_Allocator_createMany(_self, _type, _out...)               mem_Allocator_createMany_callDebug((_self), (_type), (_out), srcLoc())
+#define mem_Allocator_destroyMany(_self, _type, _ptrs...)             mem_Allocator_destroyMany_callDebug((_self), (_type), (_ptrs), srcLoc())
 #define mem_Allocator_alloc(_self, _type, _count...)                  mem_Allocator_alloc_callDebug((_self), (_type), (_count), srcLoc())
 #define mem_Allocator_resize(_self, _old_mem, _new_len...)            mem_Allocator_resize_callDebug((_self), (_old_mem), (_new_len), srcLoc())
 #define mem_Allocator_remap(_self, _old_mem, _new_len...)             mem_Allocator_remap_callDebug((_self), (_old_mem), (_new_len), srcLoc())
@@ -142,9 +164,13 @@ extern fn_(mem_Allocator_dupeZ_debug(mem_Allocator self, meta_Sli src, SrcLoc sr
 #define mem_Allocator_rawResize_callDebug(_self, _buf, _buf_align, _new_len, _src_loc) mem_Allocator_rawResize_debug(_self, _buf, _buf_align, _new_len, _src_loc)
 #define mem_Allocator_rawRemap_callDebug(_self, _buf, _buf_align, _new_len, _src_loc)  mem_Allocator_rawRemap_debug(_self, _buf, _buf_align, _new_len, _src_loc)
 #define mem_Allocator_rawFree_callDebug(_self, _buf, _buf_align, _src_loc)             mem_Allocator_rawFree_debug(_self, _buf, _buf_align, _src_loc)
+#define mem_Allocator_rawAllocMany_callDebug(_self, _len, _align, _out, _src_loc)      mem_Allocator_rawAllocMany_debug(_self, _len, _align, _out, _src_loc)
+#define mem_Allocator_rawFreeMany_callDebug(_self, _bufs, _len, _align, _src_loc)      mem_Allocator_rawFreeMany_debug(_self, _bufs, _len, _align, _src_loc)
 
 #define mem_Allocator_create_callDebug(_self, _type, _src_loc)               mem_Allocator_create_debug(_self, _type, _src_loc)
 #define mem_Allocator_destroy_callDebug(_self, _ptr, _src_loc)               mem_Allocator_destroy_debug(_self, _ptr, _src_loc)
+#define mem_Allocator_createMany_callDebug(_self, _type, _out, _src_loc)     mem_Allocator_createMany_debug(_self, _type, _out, _src_loc)
+#define mem_Allocator_destroyMany_callDebug(_self, _type, _ptrs, _src_loc)   mem_Allocator_destroyMany_debug(_self, _type, _ptrs, _src_loc)
 #define mem_Allocator_alloc_callDebug(_self, _type, _count, _src_loc)        mem_Allocator_alloc_debug(_self, _type, _count, _src_loc)
 #define mem_Allocator_resize_callDebug(_self, _old_mem, _new_len, _src_loc)  mem_Allocator_resize_debug(_self, _old_mem, _new_len, _src_loc)
 #define mem_Allocator_remap_callDebug(_self, _old_mem, _new_len, _src_loc)   mem_Allocator_remap_debug(_self, _old_mem, _new_len, _src_loc)
@@ -5,7 +5,7 @@
  * @file    Tracker.h
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2025-03-22 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.2
  * @ingroup dasae-headers(dh)/mem
  * @prefix  mem_Tracker
@@ -14,6 +14,16 @@
  * @details Tracks memory allocations, frees, remaps, and detects issues like
  *          memory leaks, double frees, and invalid frees. Provides detailed
  *          reports with allocation source locations and timestamps.
+ *          Live allocations are kept in open-addressing tables keyed by pointer,
+ *          sharded by pointer hash with one spin lock per shard, so concurrent
+ *          threads rarely contend. Each thread records events into its own binary
+ *          buffer, which is merged into a shared spill in bulk once full and only
+ *          formatted into the log, in global event order, when the report is
+ *          generated. A thread's buffer is released when the thread exits.
+ *          Optional heap profiling samples allocations about every N bytes,
+ *          captures a short backtrace for each sample, and writes snapshots of
+ *          the sampled live heap as collapsed stacks ("a;b;c bytes" per line)
+ *          that flamegraph tooling (flamegraph.pl, inferno, speedscope) reads.
  */
 
 #ifndef MEM_TRACKER_INCLUDED
@@ -28,23 +38,57 @@ extern "C" {
 #include "dh/Str.h"
 #include "dh/err_res.h"
 #include "dh/core/src_loc.h"
+#include "dh/atomic.h"
 
 /* TODO: Add option 'trace alloc and free no disable release'  */
 #if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
 #else
 
+/*========== Macros and Definitions =========================================*/
+
+/// Number of events buffered per thread before they are merged in bulk
+#if !defined(MEM_TRACKER_EVENT_BUF_LEN)
+#define MEM_TRACKER_EVENT_BUF_LEN (1024)
+#endif /* !defined(MEM_TRACKER_EVENT_BUF_LEN) */
+#define mem_Tracker_event_buf_len (MEM_TRACKER_EVENT_BUF_LEN)
+/// Number of independently locked allocation tables (power of two)
+#if !defined(MEM_TRACKER_SHARD_COUNT)
+#define MEM_TRACKER_SHARD_COUNT (64)
+#endif /* !defined(MEM_TRACKER_SHARD_COUNT) */
+#define mem_Tracker_shard_count   (MEM_TRACKER_SHARD_COUNT)
+
+/// Maximum number of backtrace frames kept per sampled allocation
+#if !defined(MEM_TRACKER_PROFILE_MAX_FRAMES)
+#define MEM_TRACKER_PROFILE_MAX_FRAMES (16)
+#endif /* !defined(MEM_TRACKER_PROFILE_MAX_FRAMES) */
+#define mem_Tracker_profile_max_frames             (MEM_TRACKER_PROFILE_MAX_FRAMES)
+/// Default average bytes allocated between two samples
+#define mem_Tracker_profile_default_sample_interval (512ull * 1024ull)
+
 /*========== Memory Tracking Types =========================================*/
 
 typedef struct mem_Tracker {
-    struct mem_Allocation* allocations;     /* Linked list of allocations */
-    FILE*                  log_file;        /* Log file handle */
-    usize                  total_allocated; /* Total bytes allocated */
-    usize                  active_allocs;   /* Number of active allocations */
+    atomic_Value$(bool)         enabled;         /* Set from init until the report is generated */
+    struct mem_Tracker_Shard*   shards;          /* Allocation tables, each guarded by its own lock */
+    struct mem_Tracker_ThrdBuf* thrd_bufs;       /* Most recently registered per-thread event buffer (guarded by spill lock) */
+    atomic_Value$(bool)         spill_locked;    /* Guards merging of thread buffers into spill and their registration */
+    atomic_Value$(u64)          next_seq;        /* Global event order across threads */
+    FILE*                       events_spill;    /* Temporary file holding merged events */
+    FILE*                       log_file;        /* Log file handle */
+    atomic_Value$(usize)        total_allocated; /* Total bytes allocated */
+    atomic_Value$(usize)        active_allocs;   /* Number of active allocations */
 } mem_Tracker;
 
+/// Heap profiling configuration
+typedef struct mem_Tracker_ProfileCfg {
+    usize     sample_interval;      /* Bytes allocated between samples (0 uses default, 1 samples every allocation) */
+    usize     snapshot_interval;    /* Estimated bytes allocated between periodic snapshots (0 disables automatic snapshots) */
+    Str_const snapshot_path_prefix; /* Snapshots are written to "<prefix>-<n>.folded" and "<prefix>-peak.folded" */
+} mem_Tracker_ProfileCfg;
+
 /*========== Memory Tracker Interface ======================================*/
 
-/// Initialize memory tracker with custom log path
+/// Initialize memory tracker with custom log path (shorter than 256 bytes)
 extern fn_(mem_Tracker_initWithPath(Str_const log_path), $must_check Err$void);
 /// Generate final report and cleanup
 extern fn_(mem_Tracker_finiAndGenerateReport(void), void);
@@ -68,6 +112,13 @@ extern fn_(mem_Tracker_registerFree(
     SrcLoc      src_loc
 ), bool);
 
+/// Start sampling allocations for heap profiling (snapshot path prefix shorter than 192 bytes)
+extern fn_(mem_Tracker_startProfile(mem_Tracker_ProfileCfg cfg), $must_check Err$void);
+/// Stop sampling (live samples stay attributed until freed)
+extern fn_(mem_Tracker_stopProfile(void), void);
+/// Write sampled live heap as collapsed stacks (path shorter than 256 bytes)
+extern fn_(mem_Tracker_writeProfile(Str_const path), $must_check Err$void);
+
 /// Get singleton instance
 extern fn_(mem_Tracker_instance(void), mem_Tracker*);
 
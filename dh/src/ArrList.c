@@ -1,8 +1,7 @@
 #include "dh/ArrList.h"
 #include "dh/debug/assert.h"
 
-// Utility functions
-static fn_(ArrList_growCap(usize current, usize minimum), usize) {
+fn_(ArrList_growCap(usize current, usize minimum), usize) {
     debug_assert_fmt(0 < minimum, "Minimum capacity must be positive");
 
     if (usize_limit / 2 < minimum) {
@@ -0,0 +1,685 @@
+#include "dh/BTreeMap.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+
+/// Minimum capacity of nodes (keeps splits and merges within bounds)
+#define BTreeMap_cap_min    (5)
+/// Maximum number of levels (non-root inner nodes have at least 3 children)
+#define BTreeMap_height_max (48)
+
+/// Header of every node, followed by keys and then values (leaves) or children (inner nodes)
+struct BTreeMap_Node {
+    u32            len;     ///< Number of keys
+    bool           is_leaf; ///< Whether node is a leaf
+    BTreeMap_Node* next;    ///< Next leaf in key order (leaves only)
+};
+
+/// Inner node and child index visited on the way down
+typedef struct BTreeMap_PathStep {
+    BTreeMap_Node* node;  ///< Inner node
+    usize          index; ///< Index of child taken
+} BTreeMap_PathStep;
+
+// Internal helper functions
+static fn_(BTreeMap_cmp(const BTreeMap* self, anyptr_const lhs, anyptr_const rhs), cmp_Ord);
+static fn_(BTreeMap_key(const BTreeMap* self, const BTreeMap_Node* node, usize index), u8*);
+static fn_(BTreeMap_val(const BTreeMap* self, const BTreeMap_Node* node, usize index), u8*);
+static fn_(BTreeMap_kids(const BTreeMap* self, const BTreeMap_Node* node), BTreeMap_Node**);
+static fn_(BTreeMap_minLen(const BTreeMap* self, const BTreeMap_Node* node), usize);
+static fn_(BTreeMap_moveKeys(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void);
+static fn_(BTreeMap_moveVals(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void);
+static fn_(BTreeMap_moveKids(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void);
+static fn_(BTreeMap_lowerIndex(const BTreeMap* self, const BTreeMap_Node* node, anyptr_const key), usize);
+static fn_(BTreeMap_upperIndex(const BTreeMap* self, const BTreeMap_Node* node, anyptr_const key), usize);
+static fn_(BTreeMap_findLeaf(const BTreeMap* self, anyptr_const key, BTreeMap_PathStep* path), BTreeMap_Node*);
+static fn_(BTreeMap_allocNode(BTreeMap* self, bool is_leaf), mem_Allocator_Err$meta_Sli);
+static fn_(BTreeMap_freeNode(BTreeMap* self, BTreeMap_Node* node), void);
+static fn_(BTreeMap_freeTree(BTreeMap* self, BTreeMap_Node* node), void);
+static fn_(BTreeMap_reserveNodes(BTreeMap* self, usize splits, BTreeMap_Node** spares, usize* spares_len), mem_Allocator_Err$void);
+static fn_(BTreeMap_leafInsert(BTreeMap* self, BTreeMap_Node* leaf, usize index, anyptr_const key), void);
+static fn_(BTreeMap_innerInsert(BTreeMap* self, BTreeMap_Node* node, usize index, anyptr_const key, BTreeMap_Node* kid), void);
+static fn_(BTreeMap_innerRemove(BTreeMap* self, BTreeMap_Node* node, usize index), void);
+static fn_(BTreeMap_insertAt(BTreeMap* self, BTreeMap_PathStep* path, BTreeMap_Node* leaf, usize index, anyptr_const key), mem_Allocator_Err$meta_Ptr);
+static fn_(BTreeMap_appendMax(BTreeMap* self, anyptr_const key, anyptr_const val), mem_Allocator_Err$void);
+static fn_(BTreeMap_fixRightSpine(BTreeMap* self), void);
+static fn_(BTreeMap_rotateRight(BTreeMap* self, BTreeMap_Node* parent, usize index), void);
+static fn_(BTreeMap_rotateLeft(BTreeMap* self, BTreeMap_Node* parent, usize index), void);
+static fn_(BTreeMap_merge(BTreeMap* self, BTreeMap_Node* parent, usize index), void);
+static fn_(BTreeMap_rebalance(BTreeMap* self, BTreeMap_PathStep* path, BTreeMap_Node* node), void);
+static fn_(BTreeMap_cursorAt(const BTreeMap* self, BTreeMap_Node* leaf, usize index), BTreeMap_Cursor);
+static fn_(BTreeMap_skipExhausted(BTreeMap_Node** leaf, usize* index), void);
+
+/*========== Implementation =================================================*/
+
+fn_(BTreeMap_init(TypeInfo key_type, TypeInfo val_type, sort_CmpFn cmpFn, mem_Allocator allocator), BTreeMap) {
+    debug_assert_fmt(0 < key_type.size, "Key type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    let ptr_size    = sizeOf$(BTreeMap_Node*);
+    let node_align  = prim_max(prim_max(as$(u32, alignOf$(BTreeMap_Node)), key_type.align), val_type.align);
+    let keys_offset = mem_alignForward(sizeOf$(BTreeMap_Node), key_type.align);
+    let room        = BTreeMap_node_size - prim_min(keys_offset, as$(usize, BTreeMap_node_size));
+
+    // As many entries as fit in the target node size
+    let leaf_cap    = prim_max(room / (key_type.size + val_type.size), as$(usize, BTreeMap_cap_min));
+    let inner_cap   = prim_max((room - prim_min(ptr_size, room)) / (key_type.size + ptr_size), as$(usize, BTreeMap_cap_min));
+    let vals_offset = mem_alignForward(keys_offset + leaf_cap * key_type.size, val_type.align);
+    let kids_offset = mem_alignForward(keys_offset + inner_cap * key_type.size, alignOf$(BTreeMap_Node*));
+
+    return (BTreeMap){
+        .key_type    = key_type,
+        .val_type    = val_type,
+        .leaf_cap    = as$(u32, leaf_cap),
+        .inner_cap   = as$(u32, inner_cap),
+        .node_align  = node_align,
+        .keys_offset = keys_offset,
+        .vals_offset = vals_offset,
+        .kids_offset = kids_offset,
+        .leaf_size   = mem_alignForward(vals_offset + leaf_cap * val_type.size, node_align),
+        .inner_size  = mem_alignForward(kids_offset + (inner_cap + 1) * ptr_size, node_align),
+        .root        = null,
+        .height      = 0,
+        .len         = 0,
+        .cmpFn       = cmpFn,
+        .allocator   = allocator,
+    };
+}
+
+fn_scope_ext(BTreeMap_initSorted(meta_Sli_const keys, meta_Sli_const vals, sort_CmpFn cmpFn, mem_Allocator allocator), mem_Allocator_Err$BTreeMap) {
+    debug_assert_fmt(keys.len == vals.len, "Keys and values must have the same length");
+
+    var map = BTreeMap_init(keys.type, vals.type, cmpFn, allocator);
+    errdefer_(BTreeMap_fini(&map));
+
+    // Append to the rightmost leaf, filling every node it leaves behind
+    for (usize i = 0; i < keys.len; ++i) {
+        let key = as$(const u8*, keys.addr) + i * keys.type.size;
+        debug_assert_fmt(
+            i == 0 || BTreeMap_cmp(&map, key - keys.type.size, key) == cmp_Ord_lt,
+            "Keys must be in strictly ascending order"
+        );
+        try_(BTreeMap_appendMax(&map, key, as$(const u8*, vals.addr) + i * vals.type.size));
+    }
+    BTreeMap_fixRightSpine(&map);
+    return_ok(map);
+} unscoped_ext;
+
+fn_(BTreeMap_fini(BTreeMap* self), void) {
+    debug_assert_nonnull(self);
+
+    if (self->root == null) { return; }
+    BTreeMap_freeTree(self, self->root);
+}
+
+fn_(BTreeMap_contains(const BTreeMap* self, meta_Ptr key), bool) {
+    return isSome(BTreeMap_getPtr(self, key));
+}
+
+fn_scope(BTreeMap_getPtr(const BTreeMap* self, meta_Ptr key), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert(key.type.size == self->key_type.size);
+
+    if (self->root == null) {
+        return_none();
+    }
+    let leaf  = BTreeMap_findLeaf(self, key.addr, null);
+    let index = BTreeMap_lowerIndex(self, leaf, key.addr);
+    if (index == leaf->len || BTreeMap_cmp(self, BTreeMap_key(self, leaf, index), key.addr) != cmp_Ord_eq) {
+        return_none();
+    }
+    return_some((meta_Ptr){ .type = self->val_type, .addr = BTreeMap_val(self, leaf, index) });
+} unscoped;
+
+fn_scope(BTreeMap_put(BTreeMap* self, meta_Ptr key, meta_Ptr val), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert(val.type.size == self->val_type.size);
+
+    let result = try_(BTreeMap_getOrPut(self, key));
+    bti_memcpy(result.val.addr, val.addr, self->val_type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(BTreeMap_getOrPut(BTreeMap* self, meta_Ptr key), mem_Allocator_Err$BTreeMap_GetOrPutResult) {
+    debug_assert_nonnull(self);
+    debug_assert(key.type.size == self->key_type.size);
+
+    if (self->root == null) {
+        self->root   = try_(BTreeMap_allocNode(self, true)).addr;
+        self->height = 1;
+    }
+    BTreeMap_PathStep path[BTreeMap_height_max];
+    let leaf  = BTreeMap_findLeaf(self, key.addr, path);
+    let index = BTreeMap_lowerIndex(self, leaf, key.addr);
+    if (index < leaf->len && BTreeMap_cmp(self, BTreeMap_key(self, leaf, index), key.addr) == cmp_Ord_eq) {
+        return_ok((BTreeMap_GetOrPutResult){
+            .val            = { .type = self->val_type, .addr = BTreeMap_val(self, leaf, index) },
+            .found_existing = true,
+        });
+    }
+    let val = try_(BTreeMap_insertAt(self, path, leaf, index, key.addr));
+    return_ok((BTreeMap_GetOrPutResult){
+        .val            = val,
+        .found_existing = false,
+    });
+} unscoped;
+
+fn_(BTreeMap_remove(BTreeMap* self, meta_Ptr key), bool) {
+    debug_assert_nonnull(self);
+    debug_assert(key.type.size == self->key_type.size);
+
+    if (self->root == null) { return false; }
+    BTreeMap_PathStep path[BTreeMap_height_max];
+    let leaf  = BTreeMap_findLeaf(self, key.addr, path);
+    let index = BTreeMap_lowerIndex(self, leaf, key.addr);
+    if (index == leaf->len || BTreeMap_cmp(self, BTreeMap_key(self, leaf, index), key.addr) != cmp_Ord_eq) {
+        return false;
+    }
+    BTreeMap_moveKeys(self, leaf, index, leaf, index + 1, leaf->len - index - 1);
+    BTreeMap_moveVals(self, leaf, index, leaf, index + 1, leaf->len - index - 1);
+    leaf->len -= 1;
+    self->len -= 1;
+    BTreeMap_rebalance(self, path, leaf);
+    return true;
+}
+
+fn_(BTreeMap_clearAndFree(BTreeMap* self), void) {
+    debug_assert_nonnull(self);
+
+    BTreeMap_fini(self);
+    self->root   = null;
+    self->height = 0;
+    self->len    = 0;
+}
+
+fn_(BTreeMap_iter(const BTreeMap* self), BTreeMap_Cursor) {
+    debug_assert_nonnull(self);
+
+    var leaf = self->root;
+    while (leaf != null && !leaf->is_leaf) {
+        leaf = BTreeMap_kids(self, leaf)[0];
+    }
+    return BTreeMap_cursorAt(self, leaf, 0);
+}
+
+fn_(BTreeMap_lowerBound(const BTreeMap* self, meta_Ptr key), BTreeMap_Cursor) {
+    debug_assert_nonnull(self);
+    debug_assert(key.type.size == self->key_type.size);
+
+    if (self->root == null) { return BTreeMap_cursorAt(self, null, 0); }
+    let leaf = BTreeMap_findLeaf(self, key.addr, null);
+    return BTreeMap_cursorAt(self, leaf, BTreeMap_lowerIndex(self, leaf, key.addr));
+}
+
+fn_(BTreeMap_upperBound(const BTreeMap* self, meta_Ptr key), BTreeMap_Cursor) {
+    debug_assert_nonnull(self);
+    debug_assert(key.type.size == self->key_type.size);
+
+    if (self->root == null) { return BTreeMap_cursorAt(self, null, 0); }
+    let leaf = BTreeMap_findLeaf(self, key.addr, null);
+    return BTreeMap_cursorAt(self, leaf, BTreeMap_upperIndex(self, leaf, key.addr));
+}
+
+fn_(BTreeMap_range(const BTreeMap* self, meta_Ptr lo, meta_Ptr hi), BTreeMap_Cursor) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(BTreeMap_cmp(self, lo.addr, hi.addr) != cmp_Ord_gt, "Range bounds must be ordered");
+
+    var cursor       = BTreeMap_lowerBound(self, lo);
+    let end          = BTreeMap_lowerBound(self, hi);
+    cursor.end_leaf  = end.leaf;
+    cursor.end_index = end.index;
+    return cursor;
+}
+
+fn_scope(BTreeMap_Cursor_peek(const BTreeMap_Cursor* self), Opt$BTreeMap_Entry) {
+    debug_assert_nonnull(self);
+
+    if (self->leaf == null || (self->leaf == self->end_leaf && self->index == self->end_index)) {
+        return_none();
+    }
+    return_some((BTreeMap_Entry){
+        .key = { .type = self->map->key_type, .addr = BTreeMap_key(self->map, self->leaf, self->index) },
+        .val = { .type = self->map->val_type, .addr = BTreeMap_val(self->map, self->leaf, self->index) },
+    });
+} unscoped;
+
+fn_(BTreeMap_Cursor_next(BTreeMap_Cursor* self), Opt$BTreeMap_Entry) {
+    debug_assert_nonnull(self);
+
+    let entry = BTreeMap_Cursor_peek(self);
+    if (isSome(entry)) {
+        self->index += 1;
+        BTreeMap_skipExhausted(&self->leaf, &self->index);
+    }
+    return entry;
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(BTreeMap_cmp(const BTreeMap* self, anyptr_const lhs, anyptr_const rhs), cmp_Ord) {
+    return invoke(self->cmpFn, lhs, rhs);
+}
+
+static fn_(BTreeMap_key(const BTreeMap* self, const BTreeMap_Node* node, usize index), u8*) {
+    return as$(u8*, node) + self->keys_offset + index * self->key_type.size;
+}
+
+static fn_(BTreeMap_val(const BTreeMap* self, const BTreeMap_Node* node, usize index), u8*) {
+    return as$(u8*, node) + self->vals_offset + index * self->val_type.size;
+}
+
+static fn_(BTreeMap_kids(const BTreeMap* self, const BTreeMap_Node* node), BTreeMap_Node**) {
+    return as$(BTreeMap_Node**, as$(u8*, node) + self->kids_offset);
+}
+
+/// Fewest keys a non-root node may hold (both halves of a split keep at least this many)
+static fn_(BTreeMap_minLen(const BTreeMap* self, const BTreeMap_Node* node), usize) {
+    return node->is_leaf ? self->leaf_cap / 2 : (self->inner_cap - 1) / 2;
+}
+
+static fn_(BTreeMap_moveKeys(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void) {
+    if (n == 0) { return; }
+    bti_memmove(BTreeMap_key(self, dst, dst_index), BTreeMap_key(self, src, src_index), n * self->key_type.size);
+}
+
+static fn_(BTreeMap_moveVals(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void) {
+    if (n == 0 || self->val_type.size == 0) { return; }
+    bti_memmove(BTreeMap_val(self, dst, dst_index), BTreeMap_val(self, src, src_index), n * self->val_type.size);
+}
+
+static fn_(BTreeMap_moveKids(const BTreeMap* self, BTreeMap_Node* dst, usize dst_index, const BTreeMap_Node* src, usize src_index, usize n), void) {
+    if (n == 0) { return; }
+    bti_memmove(BTreeMap_kids(self, dst) + dst_index, BTreeMap_kids(self, src) + src_index, n * sizeOf$(BTreeMap_Node*));
+}
+
+/// Index of first key not less than `key`
+static fn_(BTreeMap_lowerIndex(const BTreeMap* self, const BTreeMap_Node* node, anyptr_const key), usize) {
+    var lo = as$(usize, 0);
+    var hi = as$(usize, node->len);
+    while (lo < hi) {
+        let mid = lo + (hi - lo) / 2;
+        if (BTreeMap_cmp(self, BTreeMap_key(self, node, mid), key) == cmp_Ord_lt) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/// Index of first key greater than `key` (also the child of an inner node that may hold `key`)
+static fn_(BTreeMap_upperIndex(const BTreeMap* self, const BTreeMap_Node* node, anyptr_const key), usize) {
+    var lo = as$(usize, 0);
+    var hi = as$(usize, node->len);
+    while (lo < hi) {
+        let mid = lo + (hi - lo) / 2;
+        if (BTreeMap_cmp(self, key, BTreeMap_key(self, node, mid)) != cmp_Ord_lt) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/// Descend to the leaf that holds or would hold `key`, recording inner nodes in `path` (optional)
+static fn_(BTreeMap_findLeaf(const BTreeMap* self, anyptr_const key, BTreeMap_PathStep* path), BTreeMap_Node*) {
+    var node = self->root;
+    for (usize depth = 0; !node->is_leaf; ++depth) {
+        let index = BTreeMap_upperIndex(self, node, key);
+        if (path != null) {
+            path[depth] = (BTreeMap_PathStep){ .node = node, .index = index };
+        }
+        node = BTreeMap_kids(self, node)[index];
+    }
+    return node;
+}
+
+static fn_scope(BTreeMap_allocNode(BTreeMap* self, bool is_leaf), mem_Allocator_Err$meta_Sli) {
+    let mem = try_(mem_Allocator_alloc(
+        self->allocator,
+        ((TypeInfo){ .size = 1, .align = self->node_align }),
+        is_leaf ? self->leaf_size : self->inner_size
+    ));
+    let node      = as$(BTreeMap_Node*, mem.addr);
+    node->len     = 0;
+    node->is_leaf = is_leaf;
+    node->next    = null;
+    return_ok(mem);
+} unscoped;
+
+static fn_(BTreeMap_freeNode(BTreeMap* self, BTreeMap_Node* node), void) {
+    let mem = (meta_Sli){
+        .type = { .size = 1, .align = self->node_align },
+        .addr = node,
+        .len  = node->is_leaf ? self->leaf_size : self->inner_size,
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(mem));
+}
+
+static fn_(BTreeMap_freeTree(BTreeMap* self, BTreeMap_Node* node), void) {
+    if (!node->is_leaf) {
+        let kids = BTreeMap_kids(self, node);
+        for (usize i = 0; i <= node->len; ++i) {
+            BTreeMap_freeTree(self, kids[i]);
+        }
+    }
+    BTreeMap_freeNode(self, node);
+}
+
+/// Allocate a leaf and `splits` inner nodes before the tree is touched, so a failed
+/// allocation leaves it unchanged
+static fn_scope_ext(BTreeMap_reserveNodes(BTreeMap* self, usize splits, BTreeMap_Node** spares, usize* spares_len), mem_Allocator_Err$void) {
+    *spares_len = 0;
+    errdefer_(for (usize i = 0; i < *spares_len; ++i) { BTreeMap_freeNode(self, spares[i]); });
+
+    for (usize i = 0; i <= splits; ++i) {
+        let node            = as$(BTreeMap_Node*, try_(BTreeMap_allocNode(self, i == 0)).addr);
+        spares[*spares_len] = node;
+        *spares_len += 1;
+    }
+    return_ok({});
+} unscoped_ext;
+
+/// Insert key at index of a leaf with room (value is left uninitialized)
+static fn_(BTreeMap_leafInsert(BTreeMap* self, BTreeMap_Node* leaf, usize index, anyptr_const key), void) {
+    BTreeMap_moveKeys(self, leaf, index + 1, leaf, index, leaf->len - index);
+    BTreeMap_moveVals(self, leaf, index + 1, leaf, index, leaf->len - index);
+    bti_memcpy(BTreeMap_key(self, leaf, index), key, self->key_type.size);
+    leaf->len += 1;
+}
+
+/// Insert separator at index and its right child at index + 1 of an inner node with room
+static fn_(BTreeMap_innerInsert(BTreeMap* self, BTreeMap_Node* node, usize index, anyptr_const key, BTreeMap_Node* kid), void) {
+    BTreeMap_moveKeys(self, node, index + 1, node, index, node->len - index);
+    BTreeMap_moveKids(self, node, index + 2, node, index + 1, node->len - index);
+    bti_memcpy(BTreeMap_key(self, node, index), key, self->key_type.size);
+    BTreeMap_kids(self, node)[index + 1] = kid;
+    node->len += 1;
+}
+
+/// Remove separator at index and its right child at index + 1 of an inner node
+static fn_(BTreeMap_innerRemove(BTreeMap* self, BTreeMap_Node* node, usize index), void) {
+    BTreeMap_moveKeys(self, node, index, node, index + 1, node->len - index - 1);
+    BTreeMap_moveKids(self, node, index + 1, node, index + 2, node->len - index - 1);
+    node->len -= 1;
+}
+
+/// Insert key at index of leaf, splitting full nodes on the path bottom-up
+static fn_scope(BTreeMap_insertAt(BTreeMap* self, BTreeMap_PathStep* path, BTreeMap_Node* leaf, usize index, anyptr_const key), mem_Allocator_Err$meta_Ptr) {
+    if (leaf->len < self->leaf_cap) {
+        BTreeMap_leafInsert(self, leaf, index, key);
+        self->len += 1;
+        return_ok((meta_Ptr){ .type = self->val_type, .addr = BTreeMap_val(self, leaf, index) });
+    }
+
+    // Full inner nodes directly above the leaf split too, and a split root adds a level
+    var splits = as$(usize, 0);
+    while (splits < self->height - 1 && path[self->height - 2 - splits].node->len == self->inner_cap) {
+        splits += 1;
+    }
+    BTreeMap_Node* spares[BTreeMap_height_max + 1];
+    usize          spares_len = 0;
+    try_(BTreeMap_reserveNodes(self, splits + (splits == self->height - 1 ? 1 : 0), spares, &spares_len));
+    var spare = as$(usize, 0);
+
+    // Split leaf in halves, then insert into the half the key belongs to
+    let right = spares[spare++];
+    let mid   = as$(usize, self->leaf_cap / 2);
+    right->len = self->leaf_cap - as$(u32, mid);
+    BTreeMap_moveKeys(self, right, 0, leaf, mid, right->len);
+    BTreeMap_moveVals(self, right, 0, leaf, mid, right->len);
+    leaf->len   = as$(u32, mid);
+    right->next = leaf->next;
+    leaf->next  = right;
+
+    let target = index <= mid ? leaf : right;
+    let at     = index <= mid ? index : index - mid;
+    BTreeMap_leafInsert(self, target, at, key);
+    self->len += 1;
+    let val = (meta_Ptr){ .type = self->val_type, .addr = BTreeMap_val(self, target, at) };
+
+    // Push separators up until a node has room
+    var sep   = as$(u8*, bti_alloca(self->key_type.size));
+    var up    = as$(u8*, bti_alloca(self->key_type.size));
+    var kid   = right;
+    var depth = self->height - 1;
+    bti_memcpy(sep, BTreeMap_key(self, right, 0), self->key_type.size);
+    while (true) {
+        if (depth == 0) {
+            let root = spares[spare++];
+            root->len = 1;
+            bti_memcpy(BTreeMap_key(self, root, 0), sep, self->key_type.size);
+            BTreeMap_kids(self, root)[0] = self->root;
+            BTreeMap_kids(self, root)[1] = kid;
+            self->root = root;
+            self->height += 1;
+            break;
+        }
+        depth -= 1;
+        let parent = path[depth].node;
+        let pos    = path[depth].index;
+        if (parent->len < self->inner_cap) {
+            BTreeMap_innerInsert(self, parent, pos, sep, kid);
+            break;
+        }
+        // Middle separator moves up, the halves keep the keys around it
+        let sibling = spares[spare++];
+        let half    = as$(usize, self->inner_cap / 2);
+        bti_memcpy(up, BTreeMap_key(self, parent, half), self->key_type.size);
+        sibling->len = self->inner_cap - as$(u32, half) - 1;
+        BTreeMap_moveKeys(self, sibling, 0, parent, half + 1, sibling->len);
+        BTreeMap_moveKids(self, sibling, 0, parent, half + 1, sibling->len + 1);
+        parent->len = as$(u32, half);
+        if (pos <= half) {
+            BTreeMap_innerInsert(self, parent, pos, sep, kid);
+        } else {
+            BTreeMap_innerInsert(self, sibling, pos - half - 1, sep, kid);
+        }
+        let temp = sep;
+        sep      = up;
+        up       = temp;
+        kid      = sibling;
+    }
+    debug_assert(spare == spares_len);
+    return_ok(val);
+} unscoped;
+
+/// Append entry with a key greater than every key, starting new nodes instead of splitting
+static fn_scope(BTreeMap_appendMax(BTreeMap* self, anyptr_const key, anyptr_const val), mem_Allocator_Err$void) {
+    if (self->root == null) {
+        self->root   = try_(BTreeMap_allocNode(self, true)).addr;
+        self->height = 1;
+    }
+    BTreeMap_Node* spine[BTreeMap_height_max];
+    var            node = self->root;
+    for (usize depth = 0; depth < self->height; ++depth) {
+        spine[depth] = node;
+        if (!node->is_leaf) { node = BTreeMap_kids(self, node)[node->len]; }
+    }
+
+    let leaf = spine[self->height - 1];
+    if (leaf->len < self->leaf_cap) {
+        bti_memcpy(BTreeMap_key(self, leaf, leaf->len), key, self->key_type.size);
+        bti_memcpy(BTreeMap_val(self, leaf, leaf->len), val, self->val_type.size);
+        leaf->len += 1;
+        self->len += 1;
+        return_ok({});
+    }
+
+    var splits = as$(usize, 0);
+    while (splits < self->height - 1 && spine[self->height - 2 - splits]->len == self->inner_cap) {
+        splits += 1;
+    }
+    BTreeMap_Node* spares[BTreeMap_height_max + 1];
+    usize          spares_len = 0;
+    try_(BTreeMap_reserveNodes(self, splits + (splits == self->height - 1 ? 1 : 0), spares, &spares_len));
+    var spare = as$(usize, 0);
+
+    let next = spares[spare++];
+    bti_memcpy(BTreeMap_key(self, next, 0), key, self->key_type.size);
+    bti_memcpy(BTreeMap_val(self, next, 0), val, self->val_type.size);
+    next->len  = 1;
+    leaf->next = next;
+    self->len += 1;
+
+    // New key separates the new node from its left neighbor on every level it reaches
+    var kid   = next;
+    var depth = self->height - 1;
+    while (true) {
+        if (depth == 0) {
+            let root = spares[spare++];
+            root->len = 1;
+            bti_memcpy(BTreeMap_key(self, root, 0), key, self->key_type.size);
+            BTreeMap_kids(self, root)[0] = self->root;
+            BTreeMap_kids(self, root)[1] = kid;
+            self->root = root;
+            self->height += 1;
+            break;
+        }
+        depth -= 1;
+        let parent = spine[depth];
+        if (parent->len < self->inner_cap) {
+            BTreeMap_innerInsert(self, parent, parent->len, key, kid);
+            break;
+        }
+        let sibling                     = spares[spare++];
+        BTreeMap_kids(self, sibling)[0] = kid;
+        kid                             = sibling;
+    }
+    debug_assert(spare == spares_len);
+    return_ok({});
+} unscoped;
+
+/// Refill the rightmost node of each level from its full left neighbor after appending
+static fn_(BTreeMap_fixRightSpine(BTreeMap* self), void) {
+    var node = self->root;
+    while (node != null && !node->is_leaf) {
+        let index = as$(usize, node->len);
+        let child = BTreeMap_kids(self, node)[index];
+        while (child->len < BTreeMap_minLen(self, child)) {
+            BTreeMap_rotateRight(self, node, index);
+        }
+        node = child;
+    }
+}
+
+/// Move the last entry of child `index - 1` to the front of child `index`
+static fn_(BTreeMap_rotateRight(BTreeMap* self, BTreeMap_Node* parent, usize index), void) {
+    let kids  = BTreeMap_kids(self, parent);
+    let left  = kids[index - 1];
+    let child = kids[index];
+    let sep   = BTreeMap_key(self, parent, index - 1);
+    if (child->is_leaf) {
+        BTreeMap_moveKeys(self, child, 1, child, 0, child->len);
+        BTreeMap_moveVals(self, child, 1, child, 0, child->len);
+        BTreeMap_moveKeys(self, child, 0, left, left->len - 1, 1);
+        BTreeMap_moveVals(self, child, 0, left, left->len - 1, 1);
+        bti_memcpy(sep, BTreeMap_key(self, child, 0), self->key_type.size);
+    } else {
+        BTreeMap_moveKeys(self, child, 1, child, 0, child->len);
+        BTreeMap_moveKids(self, child, 1, child, 0, child->len + 1);
+        bti_memcpy(BTreeMap_key(self, child, 0), sep, self->key_type.size);
+        BTreeMap_kids(self, child)[0] = BTreeMap_kids(self, left)[left->len];
+        bti_memcpy(sep, BTreeMap_key(self, left, left->len - 1), self->key_type.size);
+    }
+    left->len -= 1;
+    child->len += 1;
+}
+
+/// Move the first entry of child `index + 1` to the end of child `index`
+static fn_(BTreeMap_rotateLeft(BTreeMap* self, BTreeMap_Node* parent, usize index), void) {
+    let kids  = BTreeMap_kids(self, parent);
+    let child = kids[index];
+    let right = kids[index + 1];
+    let sep   = BTreeMap_key(self, parent, index);
+    if (child->is_leaf) {
+        BTreeMap_moveKeys(self, child, child->len, right, 0, 1);
+        BTreeMap_moveVals(self, child, child->len, right, 0, 1);
+        BTreeMap_moveKeys(self, right, 0, right, 1, right->len - 1);
+        BTreeMap_moveVals(self, right, 0, right, 1, right->len - 1);
+        bti_memcpy(sep, BTreeMap_key(self, right, 0), self->key_type.size);
+    } else {
+        bti_memcpy(BTreeMap_key(self, child, child->len), sep, self->key_type.size);
+        BTreeMap_kids(self, child)[child->len + 1] = BTreeMap_kids(self, right)[0];
+        bti_memcpy(sep, BTreeMap_key(self, right, 0), self->key_type.size);
+        BTreeMap_moveKeys(self, right, 0, right, 1, right->len - 1);
+        BTreeMap_moveKids(self, right, 0, right, 1, right->len);
+    }
+    right->len -= 1;
+    child->len += 1;
+}
+
+/// Merge child `index + 1` into child `index` and drop their separator
+static fn_(BTreeMap_merge(BTreeMap* self, BTreeMap_Node* parent, usize index), void) {
+    let kids  = BTreeMap_kids(self, parent);
+    let left  = kids[index];
+    let right = kids[index + 1];
+    if (left->is_leaf) {
+        BTreeMap_moveKeys(self, left, left->len, right, 0, right->len);
+        BTreeMap_moveVals(self, left, left->len, right, 0, right->len);
+        left->len += right->len;
+        left->next = right->next;
+    } else {
+        bti_memcpy(BTreeMap_key(self, left, left->len), BTreeMap_key(self, parent, index), self->key_type.size);
+        BTreeMap_moveKeys(self, left, left->len + 1, right, 0, right->len);
+        BTreeMap_moveKids(self, left, left->len + 1, right, 0, right->len + 1);
+        left->len += right->len + 1;
+    }
+    BTreeMap_freeNode(self, right);
+    BTreeMap_innerRemove(self, parent, index);
+}
+
+/// Restore minimum occupancy bottom-up after `node` lost an entry
+static fn_(BTreeMap_rebalance(BTreeMap* self, BTreeMap_PathStep* path, BTreeMap_Node* node), void) {
+    var depth = self->height - 1;
+    while (0 < depth) {
+        let min = BTreeMap_minLen(self, node);
+        if (min <= node->len) { return; }
+        depth -= 1;
+        let parent = path[depth].node;
+        let index  = path[depth].index;
+        let kids   = BTreeMap_kids(self, parent);
+        // Borrow from a sibling with spare entries, otherwise merge with one
+        if (0 < index && min < kids[index - 1]->len) {
+            BTreeMap_rotateRight(self, parent, index);
+            return;
+        }
+        if (index < parent->len && min < kids[index + 1]->len) {
+            BTreeMap_rotateLeft(self, parent, index);
+            return;
+        }
+        BTreeMap_merge(self, parent, 0 < index ? index - 1 : index);
+        node = parent;
+    }
+
+    // Root may run empty: a leaf root is freed, an inner root hands over to its only child
+    if (node->len != 0) { return; }
+    if (node->is_leaf) {
+        self->root   = null;
+        self->height = 0;
+    } else {
+        self->root = BTreeMap_kids(self, node)[0];
+        self->height -= 1;
+    }
+    BTreeMap_freeNode(self, node);
+}
+
+static fn_(BTreeMap_cursorAt(const BTreeMap* self, BTreeMap_Node* leaf, usize index), BTreeMap_Cursor) {
+    BTreeMap_skipExhausted(&leaf, &index);
+    return (BTreeMap_Cursor){
+        .map       = self,
+        .leaf      = leaf,
+        .index     = index,
+        .end_leaf  = null,
+        .end_index = 0,
+    };
+}
+
+/// Step past the end of a leaf to the start of the next one
+static fn_(BTreeMap_skipExhausted(BTreeMap_Node** leaf, usize* index), void) {
+    while (*leaf != null && (*leaf)->len <= *index) {
+        *leaf  = (*leaf)->next;
+        *index = 0;
+    }
+}
@@ -0,0 +1,334 @@
+#include "dh/BitSet.h"
+#include "dh/debug/assert.h"
+
+#if bti_arch_has_avx2
+#include <immintrin.h>
+#elif bti_arch_has_sse2
+#include <emmintrin.h>
+#elif bti_arch_has_neon
+#include <arm_neon.h>
+#endif /* bti_arch_has_neon */
+
+/// Word-level operation of whole-set functions
+typedef enum BitSet_Op {
+    BitSet_Op_or,
+    BitSet_Op_and,
+    BitSet_Op_xor,
+    BitSet_Op_andNot
+} BitSet_Op;
+
+// Internal helper functions
+static fn_(BitSet_wordCount(BitSet self), usize);
+static fn_(BitSet_maskTail(BitSet self), void);
+force_inline fn_(BitSet_applyOp(BitSet_Word* dst, const BitSet_Word* src, usize len, BitSet_Op op), void);
+static fn_(BitSet_countWords(const BitSet_Word* words, usize len), usize);
+
+/*========== Implementation =================================================*/
+
+fn_(BitSet_fromWords(BitSet_Word* words, usize bit_len), BitSet) {
+    debug_assert_fmt(bit_len == 0 || words != null, "Words cannot be null");
+    return (BitSet){ .words = words, .bit_len = bit_len };
+}
+
+fn_(BitSet_isSet(BitSet self, usize index), bool) {
+    debug_assert_fmt(index < self.bit_len, "Index out of bounds");
+    return (self.words[index / BitSet_word_bits] >> (index % BitSet_word_bits)) & 1;
+}
+
+fn_(BitSet_set(BitSet self, usize index), void) {
+    debug_assert_fmt(index < self.bit_len, "Index out of bounds");
+    self.words[index / BitSet_word_bits] |= as$(BitSet_Word, 1) << (index % BitSet_word_bits);
+}
+
+fn_(BitSet_unset(BitSet self, usize index), void) {
+    debug_assert_fmt(index < self.bit_len, "Index out of bounds");
+    self.words[index / BitSet_word_bits] &= ~(as$(BitSet_Word, 1) << (index % BitSet_word_bits));
+}
+
+fn_(BitSet_toggle(BitSet self, usize index), void) {
+    debug_assert_fmt(index < self.bit_len, "Index out of bounds");
+    self.words[index / BitSet_word_bits] ^= as$(BitSet_Word, 1) << (index % BitSet_word_bits);
+}
+
+fn_(BitSet_setValue(BitSet self, usize index, bool value), void) {
+    debug_assert_fmt(index < self.bit_len, "Index out of bounds");
+
+    // Branchless: clear the bit, then or in the value
+    let shift = index % BitSet_word_bits;
+    let word  = &self.words[index / BitSet_word_bits];
+    *word     = (*word & ~(as$(BitSet_Word, 1) << shift)) | (as$(BitSet_Word, value) << shift);
+}
+
+fn_(BitSet_setRangeValue(BitSet self, usize start, usize end, bool value), void) {
+    debug_assert_fmt(start <= end && end <= self.bit_len, "Range out of bounds");
+
+    if (start == end) { return; }
+    let first      = start / BitSet_word_bits;
+    let last       = (end - 1) / BitSet_word_bits;
+    let first_mask = ~as$(BitSet_Word, 0) << (start % BitSet_word_bits);
+    let last_mask  = ~as$(BitSet_Word, 0) >> (BitSet_word_bits - 1 - (end - 1) % BitSet_word_bits);
+    if (first == last) {
+        let mask          = first_mask & last_mask;
+        self.words[first] = value ? self.words[first] | mask : self.words[first] & ~mask;
+        return;
+    }
+    self.words[first] = value ? self.words[first] | first_mask : self.words[first] & ~first_mask;
+    // Whole words in between (memset is vectorized by libc)
+    bti_memset(self.words + first + 1, value ? 0xFF : 0x00, (last - first - 1) * sizeof(BitSet_Word));
+    self.words[last] = value ? self.words[last] | last_mask : self.words[last] & ~last_mask;
+}
+
+fn_(BitSet_setAll(BitSet self), void) {
+    BitSet_setRangeValue(self, 0, self.bit_len, true);
+}
+
+fn_(BitSet_unsetAll(BitSet self), void) {
+    bti_memset(self.words, 0x00, BitSet_wordCount(self) * sizeof(BitSet_Word));
+}
+
+fn_(BitSet_toggleAll(BitSet self), void) {
+    let len = BitSet_wordCount(self);
+    for (usize i = 0; i < len; ++i) { self.words[i] = ~self.words[i]; }
+    BitSet_maskTail(self);
+}
+
+fn_(BitSet_or(BitSet self, BitSet other), void) {
+    debug_assert_fmt(self.bit_len == other.bit_len, "Bit sets must have the same length");
+    BitSet_applyOp(self.words, other.words, BitSet_wordCount(self), BitSet_Op_or);
+}
+
+fn_(BitSet_and(BitSet self, BitSet other), void) {
+    debug_assert_fmt(self.bit_len == other.bit_len, "Bit sets must have the same length");
+    BitSet_applyOp(self.words, other.words, BitSet_wordCount(self), BitSet_Op_and);
+}
+
+fn_(BitSet_xor(BitSet self, BitSet other), void) {
+    debug_assert_fmt(self.bit_len == other.bit_len, "Bit sets must have the same length");
+    BitSet_applyOp(self.words, other.words, BitSet_wordCount(self), BitSet_Op_xor);
+}
+
+fn_(BitSet_andNot(BitSet self, BitSet other), void) {
+    debug_assert_fmt(self.bit_len == other.bit_len, "Bit sets must have the same length");
+    BitSet_applyOp(self.words, other.words, BitSet_wordCount(self), BitSet_Op_andNot);
+}
+
+fn_(BitSet_count(BitSet self), usize) {
+    return BitSet_countWords(self.words, BitSet_wordCount(self));
+}
+
+fn_(BitSet_eql(BitSet self, BitSet other), bool) {
+    if (self.bit_len != other.bit_len) { return false; }
+    // Tail bits are zero in both, so whole words compare
+    return bti_memcmp(self.words, other.words, BitSet_wordCount(self) * sizeof(BitSet_Word)) == 0;
+}
+
+fn_scope(BitSet_findFirstSet(BitSet self), Opt$usize) {
+    let len = BitSet_wordCount(self);
+    for (usize i = 0; i < len; ++i) {
+        if (self.words[i] == 0) { continue; }
+        return_some(i * BitSet_word_bits + as$(usize, __builtin_ctzll(self.words[i])));
+    }
+    return_none();
+} unscoped;
+
+fn_(BitSet_iter(BitSet self), BitSet_Iter) {
+    return (BitSet_Iter){
+        .set        = self,
+        .word_index = 0,
+        .word       = 0 < self.bit_len ? self.words[0] : 0,
+    };
+}
+
+fn_scope(BitSet_Iter_next(BitSet_Iter* self), Opt$usize) {
+    debug_assert_nonnull(self);
+
+    let len = BitSet_wordCount(self->set);
+    while (self->word == 0) {
+        if (len <= self->word_index + 1) {
+            self->word_index = len;
+            return_none();
+        }
+        self->word = self->set.words[++self->word_index];
+    }
+    let bit = as$(usize, __builtin_ctzll(self->word));
+    self->word &= self->word - 1; // Clear lowest set bit
+    return_some(self->word_index * BitSet_word_bits + bit);
+} unscoped;
+
+fn_(DynBitSet_init(mem_Allocator allocator), DynBitSet) {
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    return (DynBitSet){
+        .set       = { .words = null, .bit_len = 0 },
+        .allocator = allocator,
+    };
+}
+
+fn_scope(DynBitSet_initEmpty(mem_Allocator allocator, usize bit_len), mem_Allocator_Err$DynBitSet) {
+    var self = DynBitSet_init(allocator);
+    try_(DynBitSet_resize(&self, bit_len, false));
+    return_ok(self);
+} unscoped;
+
+fn_scope(DynBitSet_initFull(mem_Allocator allocator, usize bit_len), mem_Allocator_Err$DynBitSet) {
+    var self = DynBitSet_init(allocator);
+    try_(DynBitSet_resize(&self, bit_len, true));
+    return_ok(self);
+} unscoped;
+
+fn_(DynBitSet_fini(DynBitSet* self), void) {
+    debug_assert_nonnull(self);
+
+    if (self->set.words == null) { return; }
+    let mem = (meta_Sli){
+        .type = typeInfo$(BitSet_Word),
+        .addr = self->set.words,
+        .len  = BitSet_wordCount(self->set),
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(mem));
+}
+
+fn_scope(DynBitSet_resize(DynBitSet* self, usize new_len, bool fill), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    let old_len   = self->set.bit_len;
+    let old_words = BitSet_wordCount(self->set);
+    let new_words = BitSet_wordsFor(new_len);
+    if (new_words != old_words) {
+        if (new_words == 0) {
+            DynBitSet_fini(self);
+            self->set.words = null;
+        } else {
+            let old_mem = (meta_Sli){ .type = typeInfo$(BitSet_Word), .addr = self->set.words, .len = old_words };
+            if (old_words == 0 || !mem_Allocator_resize(self->allocator, meta_sliToAny(old_mem), new_words)) {
+                let new_mem = try_(mem_Allocator_alloc(self->allocator, typeInfo$(BitSet_Word), new_words));
+                bti_memcpy(new_mem.addr, self->set.words, prim_min(old_words, new_words) * sizeof(BitSet_Word));
+                DynBitSet_fini(self);
+                self->set.words = new_mem.addr;
+            }
+            if (old_words < new_words) {
+                bti_memset(self->set.words + old_words, 0x00, (new_words - old_words) * sizeof(BitSet_Word));
+            }
+        }
+    }
+    self->set.bit_len = new_len;
+    if (old_len < new_len) {
+        BitSet_setRangeValue(self->set, old_len, new_len, fill);
+    } else {
+        BitSet_maskTail(self->set);
+    }
+    return_ok({});
+} unscoped;
+
+fn_scope(DynBitSet_clone(const DynBitSet* self, mem_Allocator allocator), mem_Allocator_Err$DynBitSet) {
+    debug_assert_nonnull(self);
+
+    let clone = try_(DynBitSet_initEmpty(allocator, self->set.bit_len));
+    bti_memcpy(clone.set.words, self->set.words, BitSet_wordCount(self->set) * sizeof(BitSet_Word));
+    return_ok(clone);
+} unscoped;
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(BitSet_wordCount(BitSet self), usize) {
+    return BitSet_wordsFor(self.bit_len);
+}
+
+/// Clear bits past the length in the last word
+static fn_(BitSet_maskTail(BitSet self), void) {
+    let tail = self.bit_len % BitSet_word_bits;
+    if (tail == 0) { return; }
+    self.words[self.bit_len / BitSet_word_bits] &= ~(~as$(BitSet_Word, 0) << tail);
+}
+
+/// Apply op word-wise, `op` is constant at every (inlined) call site so the switches fold away
+force_inline fn_(BitSet_applyOp(BitSet_Word* dst, const BitSet_Word* src, usize len, BitSet_Op op), void) {
+    usize i = 0;
+#if bti_arch_has_avx2
+    for (; i + 4 <= len; i += 4) {
+        let lhs = _mm256_loadu_si256(as$(const __m256i*, dst + i));
+        let rhs = _mm256_loadu_si256(as$(const __m256i*, src + i));
+        var res = lhs;
+        switch (op) {
+        case BitSet_Op_or:     res = _mm256_or_si256(lhs, rhs); break;
+        case BitSet_Op_and:    res = _mm256_and_si256(lhs, rhs); break;
+        case BitSet_Op_xor:    res = _mm256_xor_si256(lhs, rhs); break;
+        case BitSet_Op_andNot: res = _mm256_andnot_si256(rhs, lhs); break;
+        }
+        _mm256_storeu_si256(as$(__m256i*, dst + i), res);
+    }
+#endif /* bti_arch_has_avx2 */
+#if bti_arch_has_sse2
+    for (; i + 2 <= len; i += 2) {
+        let lhs = _mm_loadu_si128(as$(const __m128i*, dst + i));
+        let rhs = _mm_loadu_si128(as$(const __m128i*, src + i));
+        var res = lhs;
+        switch (op) {
+        case BitSet_Op_or:     res = _mm_or_si128(lhs, rhs); break;
+        case BitSet_Op_and:    res = _mm_and_si128(lhs, rhs); break;
+        case BitSet_Op_xor:    res = _mm_xor_si128(lhs, rhs); break;
+        case BitSet_Op_andNot: res = _mm_andnot_si128(rhs, lhs); break;
+        }
+        _mm_storeu_si128(as$(__m128i*, dst + i), res);
+    }
+#elif bti_arch_has_neon
+    for (; i + 2 <= len; i += 2) {
+        let lhs = vld1q_u64(dst + i);
+        let rhs = vld1q_u64(src + i);
+        var res = lhs;
+        switch (op) {
+        case BitSet_Op_or:     res = vorrq_u64(lhs, rhs); break;
+        case BitSet_Op_and:    res = vandq_u64(lhs, rhs); break;
+        case BitSet_Op_xor:    res = veorq_u64(lhs, rhs); break;
+        case BitSet_Op_andNot: res = vbicq_u64(lhs, rhs); break;
+        }
+        vst1q_u64(dst + i, res);
+    }
+#endif /* bti_arch_has_neon */
+    for (; i < len; ++i) {
+        switch (op) {
+        case BitSet_Op_or:     dst[i] |= src[i]; break;
+        case BitSet_Op_and:    dst[i] &= src[i]; break;
+        case BitSet_Op_xor:    dst[i] ^= src[i]; break;
+        case BitSet_Op_andNot: dst[i] &= ~src[i]; break;
+        }
+    }
+}
+
+static fn_(BitSet_countWords(const BitSet_Word* words, usize len), usize) {
+    usize i     = 0;
+    usize total = 0;
+#if bti_arch_has_avx2
+    // Nibble lookup popcount (Mula), byte counts summed into 64-bit lanes
+    let lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+    );
+    let low_mask = _mm256_set1_epi8(0x0F);
+    var acc      = _mm256_setzero_si256();
+    for (; i + 4 <= len; i += 4) {
+        let vec = _mm256_loadu_si256(as$(const __m256i*, words + i));
+        let lo  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(vec, low_mask));
+        let hi  = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(vec, 4), low_mask));
+        acc     = _mm256_add_epi64(acc, _mm256_sad_epu8(_mm256_add_epi8(lo, hi), _mm256_setzero_si256()));
+    }
+    total += as$(usize, _mm256_extract_epi64(acc, 0) + _mm256_extract_epi64(acc, 1)
+                        + _mm256_extract_epi64(acc, 2) + _mm256_extract_epi64(acc, 3));
+#elif bti_arch_has_neon
+    for (; i + 2 <= len; i += 2) {
+        let counts = vcntq_u8(vreinterpretq_u8_u64(vld1q_u64(words + i)));
+#if bti_arch_arm64
+        total += vaddlvq_u8(counts);
+#else  /* !bti_arch_arm64 */
+        // Across-vector add is AArch64 only, widen pairwise down to two 64-bit lanes instead
+        let sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(counts)));
+        total += as$(usize, vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1));
+#endif /* !bti_arch_arm64 */
+    }
+#endif /* bti_arch_has_neon */
+    for (; i < len; ++i) {
+        total += as$(usize, __builtin_popcountll(words[i]));
+    }
+    return total;
+}
@@ -0,0 +1,224 @@
+#include "dh/Deque.h"
+#include "dh/debug/assert.h"
+
+/// Smallest buffer
+#define Deque_min_cap (8)
+
+// Internal helper functions
+static fn_(Deque_itemAt(const Deque* self, usize buf_index), meta_Ptr);
+static fn_(Deque_bufIndex(const Deque* self, usize index), usize);
+static fn_(Deque_capFor(usize len), usize);
+static fn_(Deque_bufSli(const Deque* self), meta_Sli);
+
+/*========== Implementation =================================================*/
+
+fn_(Deque_init(TypeInfo type, mem_Allocator allocator), Deque) {
+    debug_assert_fmt(0 < type.size, "Item type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    return (Deque){
+        .type      = type,
+        .buf       = null,
+        .head      = 0,
+        .len       = 0,
+        .cap       = 0,
+        .allocator = allocator,
+    };
+}
+
+fn_scope(Deque_initCap(TypeInfo type, mem_Allocator allocator, usize cap), mem_Allocator_Err$Deque) {
+    var deque = Deque_init(type, allocator);
+    try_(Deque_ensureTotalCap(&deque, cap));
+    return_ok(deque);
+} unscoped;
+
+fn_(Deque_fini(Deque* self), void) {
+    debug_assert_nonnull(self);
+
+    if (self->buf == null) { return; }
+    mem_Allocator_free(self->allocator, meta_sliToAny(Deque_bufSli(self)));
+}
+
+fn_scope(Deque_ensureTotalCap(Deque* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    if (new_cap <= self->cap) {
+        return_ok({});
+    }
+    let old_cap  = self->cap;
+    let grow_cap = Deque_capFor(new_cap);
+    let size     = self->type.size;
+
+    // Grown in place: only the wrapped run (shorter than old capacity) moves past the old end
+    if (0 < old_cap && mem_Allocator_resize(self->allocator, meta_sliToAny(Deque_bufSli(self)), grow_cap)) {
+        if (old_cap < self->head + self->len) {
+            let wrapped = self->head + self->len - old_cap;
+            bti_memcpy(as$(u8*, self->buf) + old_cap * size, self->buf, wrapped * size);
+        }
+        self->cap = grow_cap;
+        return_ok({});
+    }
+
+    // Otherwise linearize into the new buffer, front item first
+    let new_buf = try_(mem_Allocator_alloc(self->allocator, self->type, grow_cap));
+    if (0 < old_cap) {
+        let halves = Deque_halves(self);
+        bti_memcpy(new_buf.addr, halves.first.addr, halves.first.len * size);
+        bti_memcpy(as$(u8*, new_buf.addr) + halves.first.len * size, halves.second.addr, halves.second.len * size);
+        mem_Allocator_free(self->allocator, meta_sliToAny(Deque_bufSli(self)));
+    }
+    self->buf  = new_buf.addr;
+    self->head = 0;
+    self->cap  = grow_cap;
+    return_ok({});
+} unscoped;
+
+fn_scope(Deque_ensureUnusedCap(Deque* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(Deque_ensureTotalCap(self, self->len + additional));
+    return_ok({});
+} unscoped;
+
+fn_(Deque_at(const Deque* self, usize index), meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+
+    return Deque_itemAt(self, Deque_bufIndex(self, index));
+}
+
+fn_scope(Deque_front(const Deque* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->len == 0) {
+        return_none();
+    }
+    return_some(Deque_itemAt(self, self->head));
+} unscoped;
+
+fn_scope(Deque_back(const Deque* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->len == 0) {
+        return_none();
+    }
+    return_some(Deque_itemAt(self, Deque_bufIndex(self, self->len - 1)));
+} unscoped;
+
+fn_(Deque_halves(const Deque* self), Deque_Halves) {
+    debug_assert_nonnull(self);
+
+    let first_len = prim_min(self->len, self->cap - self->head);
+    return (Deque_Halves){
+        .first = {
+            .type = self->type,
+            .addr = as$(u8*, self->buf) + self->head * self->type.size,
+            .len  = first_len,
+        },
+        .second = {
+            .type = self->type,
+            .addr = self->buf,
+            .len  = self->len - first_len,
+        },
+    };
+}
+
+fn_scope(Deque_pushBack(Deque* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    let slot = try_(Deque_addBackOne(self));
+    bti_memcpy(slot.addr, item.addr, self->type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(Deque_pushFront(Deque* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    let slot = try_(Deque_addFrontOne(self));
+    bti_memcpy(slot.addr, item.addr, self->type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(Deque_addBackOne(Deque* self), mem_Allocator_Err$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    try_(Deque_ensureUnusedCap(self, 1));
+    let buf_index = Deque_bufIndex(self, self->len);
+    self->len += 1;
+    return_ok(Deque_itemAt(self, buf_index));
+} unscoped;
+
+fn_scope(Deque_addFrontOne(Deque* self), mem_Allocator_Err$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    try_(Deque_ensureUnusedCap(self, 1));
+    self->head = (self->head - 1) & (self->cap - 1);
+    self->len += 1;
+    return_ok(Deque_itemAt(self, self->head));
+} unscoped;
+
+fn_scope(Deque_popBack(Deque* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->len == 0) {
+        return_none();
+    }
+    self->len -= 1;
+    return_some(Deque_itemAt(self, Deque_bufIndex(self, self->len)));
+} unscoped;
+
+fn_scope(Deque_popFront(Deque* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->len == 0) {
+        return_none();
+    }
+    let buf_index = self->head;
+    self->head    = (self->head + 1) & (self->cap - 1);
+    self->len -= 1;
+    return_some(Deque_itemAt(self, buf_index));
+} unscoped;
+
+fn_(Deque_clearRetainingCap(Deque* self), void) {
+    debug_assert_nonnull(self);
+
+    self->head = 0;
+    self->len  = 0;
+}
+
+fn_(Deque_clearAndFree(Deque* self), void) {
+    debug_assert_nonnull(self);
+
+    Deque_fini(self);
+    self->buf  = null;
+    self->head = 0;
+    self->len  = 0;
+    self->cap  = 0;
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(Deque_itemAt(const Deque* self, usize buf_index), meta_Ptr) {
+    return (meta_Ptr){
+        .type = self->type,
+        .addr = as$(u8*, self->buf) + buf_index * self->type.size,
+    };
+}
+
+/// Buffer index of item at position (capacity is power of two, so wrapping is a mask)
+static fn_(Deque_bufIndex(const Deque* self, usize index), usize) {
+    return (self->head + index) & (self->cap - 1);
+}
+
+static fn_(Deque_capFor(usize len), usize) {
+    var cap = as$(usize, Deque_min_cap);
+    while (cap < len) { cap *= 2; }
+    return cap;
+}
+
+static fn_(Deque_bufSli(const Deque* self), meta_Sli) {
+    return (meta_Sli){ .type = self->type, .addr = self->buf, .len = self->cap };
+}
@@ -0,0 +1,468 @@
+#include "dh/HashMap.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+
+#if bti_arch_has_sse2
+#include <emmintrin.h>
+#elif bti_arch_has_neon
+#include <arm_neon.h>
+#endif /* bti_arch_has_neon */
+
+/*========== Control Bytes and Group Probing ================================*/
+
+/// Control byte of slot that was never used (terminates probing)
+#define HashMap_ctrl_empty   as$(u8, 0x80)
+/// Control byte of removed slot (probing continues past it)
+#define HashMap_ctrl_deleted as$(u8, 0xFE)
+/* Full slots hold the top 7 bits of their hash (0x00..0x7F) */
+
+#if bti_arch_has_sse2
+/// Slots compared at once
+#define HashMap_group_width (16)
+/// Bits per slot in match mask (log2)
+#define HashMap_mask_shift  (0)
+#else /* others */
+#define HashMap_group_width (8)
+#define HashMap_mask_shift  (3)
+#endif /* others */
+/// Smallest table (must hold at least one group)
+#define HashMap_min_cap (16)
+
+#define HashMap_lsbs (0x0101010101010101ull)
+#define HashMap_msbs (0x8080808080808080ull)
+
+/// Matching slots of group (bit per slot with SSE2, high bit of each byte otherwise)
+typedef u64 HashMap_Mask;
+
+// Group operations
+static fn_(HashMap_Group_matchH2(const u8* group, u8 h2), HashMap_Mask);
+static fn_(HashMap_Group_matchEmpty(const u8* group), HashMap_Mask);
+static fn_(HashMap_Group_matchEmptyOrDeleted(const u8* group), HashMap_Mask);
+static fn_(HashMap_Mask_lowest(HashMap_Mask mask), usize);
+static fn_(HashMap_Mask_leadingSlots(HashMap_Mask mask), usize);
+
+// Internal helper functions
+static fn_(HashMap_hashKey(const HashMap* self, anyptr_const key), u64);
+static fn_(HashMap_eqlKey(const HashMap* self, anyptr_const lhs, anyptr_const rhs), bool);
+static fn_(HashMap_h1(u64 hash), usize);
+static fn_(HashMap_h2(u64 hash), u8);
+static fn_(HashMap_entryAlign(const HashMap* self), u32);
+static fn_(HashMap_keyAt(const HashMap* self, usize index), u8*);
+static fn_(HashMap_entryAt(const HashMap* self, usize index), HashMap_Entry);
+static fn_(HashMap_maxLoad(usize cap), usize);
+static fn_(HashMap_capForLen(usize len), usize);
+static fn_(HashMap_setCtrl(HashMap* self, usize index, u8 ctrl), void);
+static fn_(HashMap_findIndex(const HashMap* self, anyptr_const key, u64 hash), usize);
+static fn_(HashMap_findInsertSlot(const HashMap* self, u64 hash), usize);
+static fn_(HashMap_eraseAt(HashMap* self, usize index), void);
+static fn_(HashMap_rehash(HashMap* self, usize new_cap), $must_check mem_Allocator_Err$void);
+static fn_(HashMap_freeTable(HashMap* self), void);
+
+/*========== Implementation =================================================*/
+
+fn_(HashMap_init(TypeInfo key_type, TypeInfo val_type, HashMap_Ctx ctx, mem_Allocator allocator), HashMap) {
+    debug_assert_fmt(0 < key_type.size, "Key type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    // Same layout as `struct { K key; V val; }`
+    let val_offset = mem_alignForward(key_type.size, val_type.align);
+    let align      = prim_max(key_type.align, val_type.align);
+    return (HashMap){
+        .key_type    = key_type,
+        .val_type    = val_type,
+        .val_offset  = val_offset,
+        .entry_size  = mem_alignForward(val_offset + val_type.size, align),
+        .ctrls       = null,
+        .entries     = null,
+        .cap         = 0,
+        .len         = 0,
+        .growth_left = 0,
+        .ctx         = ctx,
+        .allocator   = allocator,
+    };
+}
+
+fn_scope(HashMap_initCap(TypeInfo key_type, TypeInfo val_type, HashMap_Ctx ctx, mem_Allocator allocator, usize cap), mem_Allocator_Err$HashMap) {
+    var map = HashMap_init(key_type, val_type, ctx, allocator);
+    try_(HashMap_ensureTotalCap(&map, cap));
+    return_ok(map);
+} unscoped;
+
+fn_(HashMap_fini(HashMap* self), void) {
+    debug_assert_nonnull(self);
+    HashMap_freeTable(self);
+}
+
+fn_scope(HashMap_ensureTotalCap(HashMap* self, usize new_len), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    if (new_len <= self->len + self->growth_left) {
+        return_ok({});
+    }
+    try_(HashMap_rehash(self, HashMap_capForLen(new_len)));
+    return_ok({});
+} unscoped;
+
+fn_scope(HashMap_ensureUnusedCap(HashMap* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(HashMap_ensureTotalCap(self, self->len + additional));
+    return_ok({});
+} unscoped;
+
+fn_(HashMap_contains(const HashMap* self, meta_Ptr key), bool) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(key.type.size == self->key_type.size, "Key type mismatch");
+
+    return HashMap_findIndex(self, key.addr, HashMap_hashKey(self, key.addr)) < self->cap;
+}
+
+fn_scope(HashMap_getPtr(const HashMap* self, meta_Ptr key), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(key.type.size == self->key_type.size, "Key type mismatch");
+
+    let index = HashMap_findIndex(self, key.addr, HashMap_hashKey(self, key.addr));
+    if (self->cap <= index) {
+        return_none();
+    }
+    return_some(HashMap_entryAt(self, index).val);
+} unscoped;
+
+fn_scope(HashMap_getEntry(const HashMap* self, meta_Ptr key), Opt$HashMap_Entry) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(key.type.size == self->key_type.size, "Key type mismatch");
+
+    let index = HashMap_findIndex(self, key.addr, HashMap_hashKey(self, key.addr));
+    if (self->cap <= index) {
+        return_none();
+    }
+    return_some(HashMap_entryAt(self, index));
+} unscoped;
+
+fn_scope(HashMap_put(HashMap* self, meta_Ptr key, meta_Ptr val), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(val.type.size == self->val_type.size, "Value type mismatch");
+
+    let result = try_(HashMap_getOrPut(self, key));
+    bti_memcpy(result.val.addr, val.addr, self->val_type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(HashMap_getOrPut(HashMap* self, meta_Ptr key), mem_Allocator_Err$HashMap_GetOrPutResult) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(key.type.size == self->key_type.size, "Key type mismatch");
+
+    let hash  = HashMap_hashKey(self, key.addr);
+    let found = HashMap_findIndex(self, key.addr, hash);
+    if (found < self->cap) {
+        let entry = HashMap_entryAt(self, found);
+        return_ok({ .key = entry.key, .val = entry.val, .found_existing = true });
+    }
+
+    // Reusing a deleted slot never needs growth, an empty one consumes growth budget
+    var index = self->cap;
+    if (0 < self->cap) {
+        index = HashMap_findInsertSlot(self, hash);
+    }
+    if (self->cap == 0 || (self->growth_left == 0 && self->ctrls[index] != HashMap_ctrl_deleted)) {
+        // Mostly tombstones: clean up at same capacity, otherwise double
+        let new_cap = self->len < HashMap_maxLoad(self->cap) / 2
+                        ? prim_max(self->cap, HashMap_min_cap)
+                        : prim_max(self->cap * 2, HashMap_capForLen(self->len + 1));
+        try_(HashMap_rehash(self, new_cap));
+        index = HashMap_findInsertSlot(self, hash);
+    }
+    if (self->ctrls[index] == HashMap_ctrl_empty) {
+        self->growth_left--;
+    }
+    HashMap_setCtrl(self, index, HashMap_h2(hash));
+    bti_memcpy(HashMap_keyAt(self, index), key.addr, self->key_type.size);
+    self->len++;
+
+    let entry = HashMap_entryAt(self, index);
+    return_ok({ .key = entry.key, .val = entry.val, .found_existing = false });
+} unscoped;
+
+fn_(HashMap_remove(HashMap* self, meta_Ptr key), bool) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(key.type.size == self->key_type.size, "Key type mismatch");
+
+    let index = HashMap_findIndex(self, key.addr, HashMap_hashKey(self, key.addr));
+    if (self->cap <= index) { return false; }
+    HashMap_eraseAt(self, index);
+    return true;
+}
+
+fn_(HashMap_clearRetainingCap(HashMap* self), void) {
+    debug_assert_nonnull(self);
+
+    if (self->cap == 0) { return; }
+    bti_memset(self->ctrls, HashMap_ctrl_empty, self->cap + HashMap_group_width);
+    self->len         = 0;
+    self->growth_left = HashMap_maxLoad(self->cap);
+}
+
+fn_(HashMap_clearAndFree(HashMap* self), void) {
+    debug_assert_nonnull(self);
+
+    HashMap_freeTable(self);
+    self->ctrls       = null;
+    self->entries     = null;
+    self->cap         = 0;
+    self->len         = 0;
+    self->growth_left = 0;
+}
+
+fn_(HashMap_iter(const HashMap* self), HashMap_Iter) {
+    debug_assert_nonnull(self);
+    return (HashMap_Iter){ .map = self, .index = 0 };
+}
+
+fn_scope(HashMap_Iter_next(HashMap_Iter* self), Opt$HashMap_Entry) {
+    debug_assert_nonnull(self);
+
+    let map = self->map;
+    while (self->index < map->cap) {
+        let index = self->index++;
+        // Full slots have high bit clear
+        if (map->ctrls[index] & 0x80) { continue; }
+        return_some(HashMap_entryAt(map, index));
+    }
+    return_none();
+} unscoped;
+
+fn_(HashMap_hashStr(anyptr_const key), u64) {
+    return Str_hash(*as$(const Str_const*, key));
+}
+
+fn_(HashMap_eqlStr(anyptr_const lhs, anyptr_const rhs), bool) {
+    return Str_eql(*as$(const Str_const*, lhs), *as$(const Str_const*, rhs));
+}
+
+/*========== Group Operations ===============================================*/
+
+#if bti_arch_has_sse2
+
+static fn_(HashMap_Group_matchH2(const u8* group, u8 h2), HashMap_Mask) {
+    let ctrl = _mm_loadu_si128(as$(const __m128i*, group));
+    return as$(u16, _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(as$(char, h2)))));
+}
+
+static fn_(HashMap_Group_matchEmpty(const u8* group), HashMap_Mask) {
+    let ctrl = _mm_loadu_si128(as$(const __m128i*, group));
+    return as$(u16, _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(as$(char, HashMap_ctrl_empty)))));
+}
+
+static fn_(HashMap_Group_matchEmptyOrDeleted(const u8* group), HashMap_Mask) {
+    // Both have high bit set, full slots do not
+    return as$(u16, _mm_movemask_epi8(_mm_loadu_si128(as$(const __m128i*, group))));
+}
+
+#else /* others */
+
+/// Load group as little-endian word, so slot i is byte i
+static fn_(HashMap_Group_load(const u8* group), u64) {
+    u64 word = 0;
+    bti_memcpy(&word, group, sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif /* defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ */
+    return word;
+}
+
+static fn_(HashMap_Group_matchH2(const u8* group, u8 h2), HashMap_Mask) {
+#if bti_arch_has_neon
+    let eql = vceq_u8(vld1_u8(group), vdup_n_u8(h2));
+    return vget_lane_u64(vreinterpret_u64_u8(eql), 0) & HashMap_msbs;
+#else  /* others */
+    // Zero byte detection, may report a full slot right after a match (keys are compared anyway)
+    let word = HashMap_Group_load(group) ^ (HashMap_lsbs * h2);
+    return (word - HashMap_lsbs) & ~word & HashMap_msbs;
+#endif /* others */
+}
+
+static fn_(HashMap_Group_matchEmpty(const u8* group), HashMap_Mask) {
+    // Empty (0x80) has bit 1 clear, deleted (0xFE) has it set
+    let word = HashMap_Group_load(group);
+    return word & ~(word << 6) & HashMap_msbs;
+}
+
+static fn_(HashMap_Group_matchEmptyOrDeleted(const u8* group), HashMap_Mask) {
+    return HashMap_Group_load(group) & HashMap_msbs;
+}
+
+#endif /* others */
+
+static fn_(HashMap_Mask_lowest(HashMap_Mask mask), usize) {
+    return as$(usize, __builtin_ctzll(mask)) >> HashMap_mask_shift;
+}
+
+/// Number of slots at the end of group without match
+static fn_(HashMap_Mask_leadingSlots(HashMap_Mask mask), usize) {
+    if (mask == 0) { return HashMap_group_width; }
+    // Mask occupies the low (group width << shift) bits
+    let unused_bits = 64 - (HashMap_group_width << HashMap_mask_shift);
+    return (as$(usize, __builtin_clzll(mask)) - unused_bits) >> HashMap_mask_shift;
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(HashMap_hashKey(const HashMap* self, anyptr_const key), u64) {
+    var hash = as$(u64, 0);
+    if (self->ctx.hashFn.is_lam || self->ctx.hashFn.callback.fnPtr != null) {
+        hash = invoke(self->ctx.hashFn, key);
+    } else {
+        // FNV-1a over key bytes
+        let bytes = as$(const u8*, key);
+        hash      = 0xCBF29CE484222325ull;
+        for (usize i = 0; i < self->key_type.size; ++i) {
+            hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+        }
+    }
+    // Finalize (murmur3 fmix64), so weak hashes like identity of integers spread over h1 and h2
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+static fn_(HashMap_eqlKey(const HashMap* self, anyptr_const lhs, anyptr_const rhs), bool) {
+    if (self->ctx.eqlFn.is_lam || self->ctx.eqlFn.callback.fnPtr != null) {
+        return invoke(self->ctx.eqlFn, lhs, rhs);
+    }
+    return bti_memcmp(lhs, rhs, self->key_type.size) == 0;
+}
+
+/// Probe start (low bits of hash)
+static fn_(HashMap_h1(u64 hash), usize) {
+    return as$(usize, hash);
+}
+
+/// Control byte of full slot (top 7 bits of hash, independent of probe start)
+static fn_(HashMap_h2(u64 hash), u8) {
+    return as$(u8, hash >> 57);
+}
+
+static fn_(HashMap_entryAlign(const HashMap* self), u32) {
+    return prim_max(self->key_type.align, self->val_type.align);
+}
+
+static fn_(HashMap_keyAt(const HashMap* self, usize index), u8*) {
+    return as$(u8*, self->entries) + index * self->entry_size;
+}
+
+static fn_(HashMap_entryAt(const HashMap* self, usize index), HashMap_Entry) {
+    let key = HashMap_keyAt(self, index);
+    return (HashMap_Entry){
+        .key = { .type = self->key_type, .addr = key },
+        .val = { .type = self->val_type, .addr = key + self->val_offset },
+    };
+}
+
+/// Maximum number of non-empty slots (7/8 load factor)
+static fn_(HashMap_maxLoad(usize cap), usize) {
+    return cap - cap / 8;
+}
+
+static fn_(HashMap_capForLen(usize len), usize) {
+    var cap = as$(usize, HashMap_min_cap);
+    while (HashMap_maxLoad(cap) < len) { cap *= 2; }
+    return cap;
+}
+
+static fn_(HashMap_setCtrl(HashMap* self, usize index, u8 ctrl), void) {
+    // First group is mirrored after the last slot, so a group load never wraps around
+    let mirror          = ((index - HashMap_group_width) & (self->cap - 1)) + HashMap_group_width;
+    self->ctrls[index]  = ctrl;
+    self->ctrls[mirror] = ctrl;
+}
+
+/// Index of entry for key, or capacity when absent
+static fn_(HashMap_findIndex(const HashMap* self, anyptr_const key, u64 hash), usize) {
+    if (self->len == 0) { return self->cap; }
+
+    let mask   = self->cap - 1;
+    let h2     = HashMap_h2(hash);
+    var pos    = HashMap_h1(hash) & mask;
+    var stride = as$(usize, 0);
+    while (true) {
+        let group = self->ctrls + pos;
+        for (var matches = HashMap_Group_matchH2(group, h2); matches != 0; matches &= matches - 1) {
+            let index = (pos + HashMap_Mask_lowest(matches)) & mask;
+            if (HashMap_eqlKey(self, HashMap_keyAt(self, index), key)) { return index; }
+        }
+        // An empty slot ends the probe sequence (load factor guarantees one exists)
+        if (HashMap_Group_matchEmpty(group) != 0) { return self->cap; }
+        // Triangular probing visits every group once when capacity is power of two
+        stride += HashMap_group_width;
+        pos = (pos + stride) & mask;
+    }
+}
+
+static fn_(HashMap_findInsertSlot(const HashMap* self, u64 hash), usize) {
+    let mask   = self->cap - 1;
+    var pos    = HashMap_h1(hash) & mask;
+    var stride = as$(usize, 0);
+    while (true) {
+        let matches = HashMap_Group_matchEmptyOrDeleted(self->ctrls + pos);
+        if (matches != 0) { return (pos + HashMap_Mask_lowest(matches)) & mask; }
+        stride += HashMap_group_width;
+        pos = (pos + stride) & mask;
+    }
+}
+
+static fn_(HashMap_eraseAt(HashMap* self, usize index), void) {
+    // Slot may become empty only if no probe window could have seen a full group around it
+    let mask           = self->cap - 1;
+    let empty_before   = HashMap_Group_matchEmpty(self->ctrls + ((index - HashMap_group_width) & mask));
+    let empty_after    = HashMap_Group_matchEmpty(self->ctrls + index);
+    let full_after     = empty_after == 0 ? HashMap_group_width : HashMap_Mask_lowest(empty_after);
+    let was_never_full = HashMap_Mask_leadingSlots(empty_before) + full_after < HashMap_group_width;
+
+    HashMap_setCtrl(self, index, was_never_full ? HashMap_ctrl_empty : HashMap_ctrl_deleted);
+    self->growth_left += was_never_full;
+    self->len--;
+}
+
+static fn_scope(HashMap_rehash(HashMap* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_fmt(self->len <= HashMap_maxLoad(new_cap), "Capacity too small for entries");
+
+    // Entries and control bytes share one allocation
+    let entries_size = new_cap * self->entry_size;
+    let buf          = try_(mem_Allocator_alloc(
+        self->allocator,
+        ((TypeInfo){ .size = 1, .align = HashMap_entryAlign(self) }),
+        entries_size + new_cap + HashMap_group_width
+    ));
+
+    var old           = *self;
+    self->entries     = buf.addr;
+    self->ctrls       = as$(u8*, buf.addr) + entries_size;
+    self->cap         = new_cap;
+    self->growth_left = HashMap_maxLoad(new_cap) - self->len;
+    bti_memset(self->ctrls, HashMap_ctrl_empty, new_cap + HashMap_group_width);
+
+    for (usize i = 0; i < old.cap; ++i) {
+        if (old.ctrls[i] & 0x80) { continue; }
+        let key   = HashMap_keyAt(&old, i);
+        let hash  = HashMap_hashKey(self, key);
+        let index = HashMap_findInsertSlot(self, hash);
+        HashMap_setCtrl(self, index, HashMap_h2(hash));
+        bti_memcpy(HashMap_keyAt(self, index), key, self->entry_size);
+    }
+    HashMap_freeTable(&old);
+    return_ok({});
+} unscoped;
+
+static fn_(HashMap_freeTable(HashMap* self), void) {
+    if (self->entries == null) { return; }
+    let table = (meta_Sli){
+        .type = { .size = 1, .align = HashMap_entryAlign(self) },
+        .addr = self->entries,
+        .len  = self->cap * self->entry_size + self->cap + HashMap_group_width,
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(table));
+}
@@ -0,0 +1,72 @@
+#include "dh/HashSet.h"
+#include "dh/debug/assert.h"
+
+/// Zero-sized value type of underlying map
+#define HashSet_val_type ((TypeInfo){ .size = 0, .align = 1 })
+
+/*========== Implementation =================================================*/
+
+fn_(HashSet_init(TypeInfo elem_type, HashMap_Ctx ctx, mem_Allocator allocator), HashSet) {
+    return (HashSet){ .map = HashMap_init(elem_type, HashSet_val_type, ctx, allocator) };
+}
+
+fn_scope(HashSet_initCap(TypeInfo elem_type, HashMap_Ctx ctx, mem_Allocator allocator, usize cap), mem_Allocator_Err$HashSet) {
+    return_ok({ .map = try_(HashMap_initCap(elem_type, HashSet_val_type, ctx, allocator, cap)) });
+} unscoped;
+
+fn_(HashSet_fini(HashSet* self), void) {
+    debug_assert_nonnull(self);
+    HashMap_fini(&self->map);
+}
+
+fn_(HashSet_ensureTotalCap(HashSet* self, usize new_len), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    return HashMap_ensureTotalCap(&self->map, new_len);
+}
+
+fn_(HashSet_ensureUnusedCap(HashSet* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    return HashMap_ensureUnusedCap(&self->map, additional);
+}
+
+fn_(HashSet_contains(const HashSet* self, meta_Ptr elem), bool) {
+    debug_assert_nonnull(self);
+    return HashMap_contains(&self->map, elem);
+}
+
+fn_scope(HashSet_insert(HashSet* self, meta_Ptr elem), mem_Allocator_Err$bool) {
+    debug_assert_nonnull(self);
+
+    // No value to initialize, a new entry is complete once its key is stored
+    let result = try_(HashMap_getOrPut(&self->map, elem));
+    return_ok(!result.found_existing);
+} unscoped;
+
+fn_(HashSet_remove(HashSet* self, meta_Ptr elem), bool) {
+    debug_assert_nonnull(self);
+    return HashMap_remove(&self->map, elem);
+}
+
+fn_(HashSet_clearRetainingCap(HashSet* self), void) {
+    debug_assert_nonnull(self);
+    HashMap_clearRetainingCap(&self->map);
+}
+
+fn_(HashSet_clearAndFree(HashSet* self), void) {
+    debug_assert_nonnull(self);
+    HashMap_clearAndFree(&self->map);
+}
+
+fn_(HashSet_iter(const HashSet* self), HashSet_Iter) {
+    debug_assert_nonnull(self);
+    return (HashSet_Iter){ .map_iter = HashMap_iter(&self->map) };
+}
+
+fn_scope(HashSet_Iter_next(HashSet_Iter* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if_some(HashMap_Iter_next(&self->map_iter), entry) {
+        return_some(entry.key);
+    }
+    return_none();
+} unscoped;
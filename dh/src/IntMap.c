@@ -0,0 +1,296 @@
+#include "dh/IntMap.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+
+/// Smallest table
+#define IntMap_min_cap    (8)
+/// Index returned for absent keys
+#define IntMap_index_none (usize_limit_max)
+
+// Internal helper functions
+static fn_(IntMap_entryAlign(const IntMap* self), u32);
+static fn_(IntMap_entryAt(const IntMap* self, usize index), u8*);
+static fn_(IntMap_keyAt(const IntMap* self, usize index), u64);
+static fn_(IntMap_setKey(IntMap* self, usize index, u64 key), void);
+static fn_(IntMap_valAt(const IntMap* self, usize index), meta_Ptr);
+static fn_(IntMap_home(const IntMap* self, u64 key), usize);
+static fn_(IntMap_maxLoad(usize cap), usize);
+static fn_(IntMap_capForLen(usize len), usize);
+static fn_(IntMap_findIndex(const IntMap* self, u64 key), usize);
+static fn_(IntMap_insertNew(IntMap* self, u64 key), usize);
+static fn_(IntMap_rehash(IntMap* self, usize new_cap), $must_check mem_Allocator_Err$void);
+static fn_(IntMap_freeTable(IntMap* self), void);
+
+/*========== Implementation =================================================*/
+
+fn_(IntMap_init(TypeInfo key_type, TypeInfo val_type, mem_Allocator allocator), IntMap) {
+    debug_assert_fmt(key_type.size == sizeof(u32) || key_type.size == sizeof(u64), "Key type must be u32 or u64");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    // Same layout as `struct { K key; V val; }`
+    let val_offset = mem_alignForward(key_type.size, val_type.align);
+    let align      = prim_max(key_type.align, val_type.align);
+    return (IntMap){
+        .key_type   = key_type,
+        .val_type   = val_type,
+        .val_offset = val_offset,
+        .entry_size = mem_alignForward(val_offset + val_type.size, align),
+        .entries    = null,
+        .cap        = 0,
+        .len        = 0,
+        .shift      = 0,
+        .has_zero   = false,
+        .allocator  = allocator,
+    };
+}
+
+fn_scope(IntMap_initCap(TypeInfo key_type, TypeInfo val_type, mem_Allocator allocator, usize cap), mem_Allocator_Err$IntMap) {
+    var map = IntMap_init(key_type, val_type, allocator);
+    try_(IntMap_ensureTotalCap(&map, cap));
+    return_ok(map);
+} unscoped;
+
+fn_(IntMap_fini(IntMap* self), void) {
+    debug_assert_nonnull(self);
+    IntMap_freeTable(self);
+}
+
+fn_scope(IntMap_ensureTotalCap(IntMap* self, usize new_len), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    // Counting key zero against the table only overestimates
+    if (new_len == 0 || (0 < self->cap && new_len <= IntMap_maxLoad(self->cap))) {
+        return_ok({});
+    }
+    try_(IntMap_rehash(self, IntMap_capForLen(new_len)));
+    return_ok({});
+} unscoped;
+
+fn_scope(IntMap_ensureUnusedCap(IntMap* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(IntMap_ensureTotalCap(self, self->len + additional));
+    return_ok({});
+} unscoped;
+
+fn_(IntMap_contains(const IntMap* self, u64 key), bool) {
+    debug_assert_nonnull(self);
+    return IntMap_findIndex(self, key) != IntMap_index_none;
+}
+
+fn_scope(IntMap_getPtr(const IntMap* self, u64 key), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    let index = IntMap_findIndex(self, key);
+    if (index == IntMap_index_none) {
+        return_none();
+    }
+    return_some(IntMap_valAt(self, index));
+} unscoped;
+
+fn_scope(IntMap_put(IntMap* self, u64 key, meta_Ptr val), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(val.type.size == self->val_type.size, "Value type mismatch");
+
+    let result = try_(IntMap_getOrPut(self, key));
+    bti_memcpy(result.val.addr, val.addr, self->val_type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(IntMap_getOrPut(IntMap* self, u64 key), mem_Allocator_Err$IntMap_GetOrPutResult) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(self->key_type.size == sizeof(u64) || key <= u32_limit_max, "Key out of range of u32");
+
+    let found = IntMap_findIndex(self, key);
+    if (found != IntMap_index_none) {
+        return_ok({ .val = IntMap_valAt(self, found), .found_existing = true });
+    }
+
+    let table_len = self->len - self->has_zero;
+    if (self->cap == 0 || (key != 0 && IntMap_maxLoad(self->cap) <= table_len)) {
+        try_(IntMap_rehash(self, prim_max(self->cap * 2, IntMap_capForLen(table_len + 1))));
+    }
+    var index = self->cap;
+    if (key == 0) {
+        self->has_zero = true;
+    } else {
+        index = IntMap_insertNew(self, key);
+    }
+    self->len++;
+    return_ok({ .val = IntMap_valAt(self, index), .found_existing = false });
+} unscoped;
+
+fn_(IntMap_remove(IntMap* self, u64 key), bool) {
+    debug_assert_nonnull(self);
+
+    let index = IntMap_findIndex(self, key);
+    if (index == IntMap_index_none) { return false; }
+    self->len--;
+    if (key == 0) {
+        self->has_zero = false;
+        return true;
+    }
+
+    // Backward shift: pull each following entry of the cluster into the hole
+    // when the hole lies between its home slot and its current slot
+    let mask = self->cap - 1;
+    var hole = index;
+    for (usize next = (index + 1) & mask; IntMap_keyAt(self, next) != 0; next = (next + 1) & mask) {
+        let dist_home = (next - IntMap_home(self, IntMap_keyAt(self, next))) & mask;
+        let dist_hole = (next - hole) & mask;
+        if (dist_hole <= dist_home) {
+            bti_memcpy(IntMap_entryAt(self, hole), IntMap_entryAt(self, next), self->entry_size);
+            hole = next;
+        }
+    }
+    IntMap_setKey(self, hole, 0);
+    return true;
+}
+
+fn_(IntMap_clearRetainingCap(IntMap* self), void) {
+    debug_assert_nonnull(self);
+
+    if (self->cap == 0) { return; }
+    bti_memset(self->entries, 0, self->cap * self->entry_size);
+    self->len      = 0;
+    self->has_zero = false;
+}
+
+fn_(IntMap_clearAndFree(IntMap* self), void) {
+    debug_assert_nonnull(self);
+
+    IntMap_freeTable(self);
+    self->entries  = null;
+    self->cap      = 0;
+    self->len      = 0;
+    self->shift    = 0;
+    self->has_zero = false;
+}
+
+fn_(IntMap_iter(const IntMap* self), IntMap_Iter) {
+    debug_assert_nonnull(self);
+    return (IntMap_Iter){ .map = self, .index = 0 };
+}
+
+fn_scope(IntMap_Iter_next(IntMap_Iter* self), Opt$IntMap_Entry) {
+    debug_assert_nonnull(self);
+
+    let map = self->map;
+    while (self->index < map->cap) {
+        let index = self->index++;
+        let key   = IntMap_keyAt(map, index);
+        if (key == 0) { continue; }
+        return_some({ .key = key, .val = IntMap_valAt(map, index) });
+    }
+    if (self->index == map->cap && map->has_zero) {
+        return_some({ .key = 0, .val = IntMap_valAt(map, self->index++) });
+    }
+    return_none();
+} unscoped;
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(IntMap_entryAlign(const IntMap* self), u32) {
+    return prim_max(self->key_type.align, self->val_type.align);
+}
+
+static fn_(IntMap_entryAt(const IntMap* self, usize index), u8*) {
+    return as$(u8*, self->entries) + index * self->entry_size;
+}
+
+static fn_(IntMap_keyAt(const IntMap* self, usize index), u64) {
+    let entry = IntMap_entryAt(self, index);
+    if (self->key_type.size == sizeof(u32)) { return *as$(const u32*, entry); }
+    return *as$(const u64*, entry);
+}
+
+static fn_(IntMap_setKey(IntMap* self, usize index, u64 key), void) {
+    let entry = IntMap_entryAt(self, index);
+    if (self->key_type.size == sizeof(u32)) {
+        *as$(u32*, entry) = as$(u32, key);
+    } else {
+        *as$(u64*, entry) = key;
+    }
+}
+
+static fn_(IntMap_valAt(const IntMap* self, usize index), meta_Ptr) {
+    return (meta_Ptr){ .type = self->val_type, .addr = IntMap_entryAt(self, index) + self->val_offset };
+}
+
+/// Fibonacci hashing: top bits of key times 2^64/phi, spreads sequential keys apart
+static fn_(IntMap_home(const IntMap* self, u64 key), usize) {
+    return as$(usize, (key * 0x9E3779B97F4A7C15ull) >> self->shift);
+}
+
+/// Maximum number of table entries (3/4 load factor, linear probing degrades above)
+static fn_(IntMap_maxLoad(usize cap), usize) {
+    return cap - cap / 4;
+}
+
+static fn_(IntMap_capForLen(usize len), usize) {
+    var cap = as$(usize, IntMap_min_cap);
+    while (IntMap_maxLoad(cap) < len) { cap *= 2; }
+    return cap;
+}
+
+/// Slot of key, or none when absent
+static fn_(IntMap_findIndex(const IntMap* self, u64 key), usize) {
+    if (key == 0) { return self->has_zero ? self->cap : IntMap_index_none; }
+    if (self->len - self->has_zero == 0) { return IntMap_index_none; }
+
+    let mask = self->cap - 1;
+    for (usize index = IntMap_home(self, key);; index = (index + 1) & mask) {
+        let slot_key = IntMap_keyAt(self, index);
+        if (slot_key == key) { return index; }
+        if (slot_key == 0) { return IntMap_index_none; }
+    }
+}
+
+/// Place absent non-zero key in first empty slot of its probe sequence
+static fn_(IntMap_insertNew(IntMap* self, u64 key), usize) {
+    let mask  = self->cap - 1;
+    var index = IntMap_home(self, key);
+    while (IntMap_keyAt(self, index) != 0) { index = (index + 1) & mask; }
+    IntMap_setKey(self, index, key);
+    return index;
+}
+
+static fn_scope(IntMap_rehash(IntMap* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_fmt(self->len - self->has_zero <= IntMap_maxLoad(new_cap), "Capacity too small for entries");
+
+    // Table slots followed by the slot of key zero
+    let buf = try_(mem_Allocator_alloc(
+        self->allocator,
+        ((TypeInfo){ .size = 1, .align = IntMap_entryAlign(self) }),
+        (new_cap + 1) * self->entry_size
+    ));
+    bti_memset(buf.addr, 0, (new_cap + 1) * self->entry_size);
+
+    var old       = *self;
+    self->entries = buf.addr;
+    self->cap     = new_cap;
+    self->shift   = 64 - ctz(new_cap);
+
+    for (usize i = 0; i < old.cap; ++i) {
+        let key = IntMap_keyAt(&old, i);
+        if (key == 0) { continue; }
+        let index = IntMap_insertNew(self, key);
+        bti_memcpy(IntMap_entryAt(self, index), IntMap_entryAt(&old, i), self->entry_size);
+    }
+    if (old.has_zero) {
+        bti_memcpy(IntMap_entryAt(self, new_cap), IntMap_entryAt(&old, old.cap), self->entry_size);
+    }
+    IntMap_freeTable(&old);
+    return_ok({});
+} unscoped;
+
+static fn_(IntMap_freeTable(IntMap* self), void) {
+    if (self->entries == null) { return; }
+    let table = (meta_Sli){
+        .type = { .size = 1, .align = IntMap_entryAlign(self) },
+        .addr = self->entries,
+        .len  = (self->cap + 1) * self->entry_size,
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(table));
+}
@@ -0,0 +1,348 @@
+#include "dh/ListUnrolled.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+
+/// Minimum number of items per node (keeps splits and merges meaningful)
+#define ListUnrolled_node_cap_min (4)
+
+// Internal helper functions
+static fn_(ListUnrolled_layout(TypeInfo type, ListUnrolled* out), void);
+static fn_(ListUnrolled_itemAt(const ListUnrolled* self, const ListUnrolled_Node* node, usize index), u8*);
+static fn_(ListUnrolled_moveItems(const ListUnrolled* self, ListUnrolled_Node* dst, usize dst_index, const ListUnrolled_Node* src, usize src_index, usize n), void);
+static fn_(ListUnrolled_acquireNode(ListUnrolled* self), mem_Allocator_Err$meta_Ptr);
+static fn_(ListUnrolled_freeNode(ListUnrolled* self, ListUnrolled_Node* node), void);
+static fn_(ListUnrolled_linkAfter(ListUnrolled* self, ListUnrolled_Node* node, ListUnrolled_Node* new_node), void);
+static fn_(ListUnrolled_unlink(ListUnrolled* self, ListUnrolled_Node* node), void);
+static fn_(ListUnrolled_refill(ListUnrolled* self, ListUnrolled_Node* node), void);
+static fn_(ListUnrolled_normalize(ListUnrolled_Pos pos), ListUnrolled_Pos);
+
+/*========== Implementation =================================================*/
+
+fn_(ListUnrolled_init(TypeInfo type, mem_Allocator allocator), ListUnrolled) {
+    debug_assert_fmt(0 < type.size, "Type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    var list = (ListUnrolled){
+        .type      = type,
+        .first     = null,
+        .last      = null,
+        .len       = 0,
+        .spare     = null,
+        .allocator = allocator,
+    };
+    ListUnrolled_layout(type, &list);
+    return list;
+}
+
+fn_(ListUnrolled_fini(ListUnrolled* self), void) {
+    debug_assert_nonnull(self);
+    ListUnrolled_clearAndFree(self);
+}
+
+fn_(ListUnrolled_nodeType(TypeInfo type), TypeInfo) {
+    var list = (ListUnrolled){ .type = type };
+    ListUnrolled_layout(type, &list);
+    return (TypeInfo){ .size = as$(u32, list.node_size), .align = list.node_align };
+}
+
+fn_(ListUnrolled_len(const ListUnrolled* self), usize) {
+    debug_assert_nonnull(self);
+    return self->len;
+}
+
+fn_(ListUnrolled_front(const ListUnrolled* self), ListUnrolled_Pos) {
+    debug_assert_nonnull(self);
+    return (ListUnrolled_Pos){ .node = self->first, .index = 0 };
+}
+
+fn_(ListUnrolled_posAt(const ListUnrolled* self, usize index), ListUnrolled_Pos) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index <= self->len, "Index out of bounds");
+
+    var node = self->first;
+    while (node != null && node->len <= index) {
+        index -= node->len;
+        node = node->next;
+    }
+    return (ListUnrolled_Pos){ .node = node, .index = index };
+}
+
+fn_(ListUnrolled_next(const ListUnrolled* self, ListUnrolled_Pos pos), ListUnrolled_Pos) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull_fmt(pos.node, "Cannot advance past the end");
+
+    pos.index += 1;
+    return ListUnrolled_normalize(pos);
+}
+
+fn_(ListUnrolled_get(const ListUnrolled* self, ListUnrolled_Pos pos), meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull_fmt(pos.node, "Cannot get item at the end");
+    debug_assert_fmt(pos.index < pos.node->len, "Index out of bounds");
+
+    return (meta_Ptr){ .type = self->type, .addr = ListUnrolled_itemAt(self, pos.node, pos.index) };
+}
+
+fn_scope(ListUnrolled_append(ListUnrolled* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(ListUnrolled_insertAt(self, (ListUnrolled_Pos){ .node = null, .index = 0 }, item));
+    return_ok({});
+} unscoped;
+
+fn_scope(ListUnrolled_prepend(ListUnrolled* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(ListUnrolled_insertAt(self, ListUnrolled_front(self), item));
+    return_ok({});
+} unscoped;
+
+fn_scope(ListUnrolled_insertAt(ListUnrolled* self, ListUnrolled_Pos pos, meta_Ptr item), mem_Allocator_Err$ListUnrolled_Pos) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull(item.addr);
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    if (self->first == null) {
+        let node = meta_castPtr$(ListUnrolled_Node*, try_(ListUnrolled_acquireNode(self)));
+        node->prev  = null;
+        node->next  = null;
+        self->first = node;
+        self->last  = node;
+        pos         = (ListUnrolled_Pos){ .node = node, .index = 0 };
+    } else if (pos.node == null) {
+        pos = (ListUnrolled_Pos){ .node = self->last, .index = self->last->len };
+    }
+    debug_assert_fmt(pos.index <= pos.node->len, "Index out of bounds");
+
+    if (pos.node->len == self->node_cap) {
+        let fresh = meta_castPtr$(ListUnrolled_Node*, try_(ListUnrolled_acquireNode(self)));
+        if (pos.index == pos.node->len && pos.node->next == null) {
+            // Appending past the full last node starts the next one, keeping sequential fills dense
+            ListUnrolled_linkAfter(self, pos.node, fresh);
+            pos = (ListUnrolled_Pos){ .node = fresh, .index = 0 };
+        } else {
+            // Split in halves, then insert into the half the position falls in
+            let mid = as$(usize, self->node_cap / 2);
+            ListUnrolled_moveItems(self, fresh, 0, pos.node, mid, self->node_cap - mid);
+            fresh->len    = self->node_cap - mid;
+            pos.node->len = mid;
+            ListUnrolled_linkAfter(self, pos.node, fresh);
+            if (mid < pos.index) {
+                pos = (ListUnrolled_Pos){ .node = fresh, .index = pos.index - mid };
+            }
+        }
+    }
+
+    let node = pos.node;
+    ListUnrolled_moveItems(self, node, pos.index + 1, node, pos.index, node->len - pos.index);
+    bti_memcpy(ListUnrolled_itemAt(self, node, pos.index), item.addr, self->type.size);
+    node->len += 1;
+    self->len += 1;
+    return_ok(pos);
+} unscoped;
+
+fn_(ListUnrolled_removeAt(ListUnrolled* self, ListUnrolled_Pos pos), ListUnrolled_Pos) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull_fmt(pos.node, "Cannot remove at the end");
+    debug_assert_fmt(pos.index < pos.node->len, "Index out of bounds");
+
+    let node = pos.node;
+    ListUnrolled_moveItems(self, node, pos.index, node, pos.index + 1, node->len - pos.index - 1);
+    node->len -= 1;
+    self->len -= 1;
+
+    if (node->len == 0) {
+        let next = node->next;
+        ListUnrolled_unlink(self, node);
+        return (ListUnrolled_Pos){ .node = next, .index = 0 };
+    }
+    ListUnrolled_refill(self, node);
+    return ListUnrolled_normalize(pos);
+}
+
+fn_scope(ListUnrolled_pop(ListUnrolled* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    let node = self->last;
+    if (node == null) {
+        return_none();
+    }
+    node->len -= 1;
+    self->len -= 1;
+    let item = (meta_Ptr){ .type = self->type, .addr = ListUnrolled_itemAt(self, node, node->len) };
+    // Emptied node becomes spare, so the item stays readable until the next insert
+    if (node->len == 0) {
+        ListUnrolled_unlink(self, node);
+    }
+    return_some(item);
+} unscoped;
+
+fn_(ListUnrolled_concatByMoving(ListUnrolled* dst, ListUnrolled* src), void) {
+    debug_assert_nonnull(dst);
+    debug_assert_nonnull(src);
+    debug_assert_fmt(dst->type.size == src->type.size && dst->node_cap == src->node_cap, "Item type mismatch");
+    debug_assert_fmt(dst->allocator.ptr == src->allocator.ptr, "Lists must share their allocator");
+
+    if (src->first == null) { return; }
+    let junction = dst->last;
+    if (junction == null) {
+        dst->first = src->first;
+    } else {
+        junction->next   = src->first;
+        src->first->prev = junction;
+    }
+    dst->last = src->last;
+    dst->len += src->len;
+
+    src->first = null;
+    src->last  = null;
+    src->len   = 0;
+    // Old last node may be short and is no longer last
+    if (junction != null) {
+        ListUnrolled_refill(dst, junction);
+    }
+}
+
+fn_(ListUnrolled_clearRetainingCap(ListUnrolled* self), void) {
+    debug_assert_nonnull(self);
+
+    while (self->first != null) {
+        ListUnrolled_unlink(self, self->first);
+    }
+    self->len = 0;
+}
+
+fn_(ListUnrolled_clearAndFree(ListUnrolled* self), void) {
+    debug_assert_nonnull(self);
+
+    ListUnrolled_clearRetainingCap(self);
+    while (self->spare != null) {
+        let node    = self->spare;
+        self->spare = node->next;
+        ListUnrolled_freeNode(self, node);
+    }
+}
+
+fn_(ListUnrolled_iter(const ListUnrolled* self), ListUnrolled_Iter) {
+    debug_assert_nonnull(self);
+
+    return (ListUnrolled_Iter){
+        .list  = self,
+        .node  = self->first,
+        .index = 0,
+    };
+}
+
+fn_scope(ListUnrolled_Iter_next(ListUnrolled_Iter* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->node == null) {
+        return_none();
+    }
+    let addr = ListUnrolled_itemAt(self->list, self->node, self->index);
+    self->index += 1;
+    if (self->node->len <= self->index) {
+        self->node  = self->node->next;
+        self->index = 0;
+    }
+    return_some((meta_Ptr){ .type = self->list->type, .addr = addr });
+} unscoped;
+
+/*========== Internal Helper Functions ======================================*/
+
+/// As many items as fit in the target node size after the header
+static fn_(ListUnrolled_layout(TypeInfo type, ListUnrolled* out), void) {
+    let node_align   = prim_max(as$(u32, alignOf$(ListUnrolled_Node)), type.align);
+    let items_offset = mem_alignForward(sizeOf$(ListUnrolled_Node), type.align);
+    let room         = ListUnrolled_node_size - prim_min(items_offset, as$(usize, ListUnrolled_node_size));
+    let node_cap     = prim_max(room / type.size, as$(usize, ListUnrolled_node_cap_min));
+
+    out->node_cap     = as$(u32, node_cap);
+    out->node_align   = node_align;
+    out->items_offset = items_offset;
+    out->node_size    = mem_alignForward(items_offset + node_cap * type.size, node_align);
+}
+
+static fn_(ListUnrolled_itemAt(const ListUnrolled* self, const ListUnrolled_Node* node, usize index), u8*) {
+    return as$(u8*, node) + self->items_offset + index * self->type.size;
+}
+
+static fn_(ListUnrolled_moveItems(const ListUnrolled* self, ListUnrolled_Node* dst, usize dst_index, const ListUnrolled_Node* src, usize src_index, usize n), void) {
+    if (n == 0) { return; }
+    bti_memmove(ListUnrolled_itemAt(self, dst, dst_index), ListUnrolled_itemAt(self, src, src_index), n * self->type.size);
+}
+
+/// Take a spare node, or allocate one (header of the node is left to the caller except `len`)
+static fn_scope(ListUnrolled_acquireNode(ListUnrolled* self), mem_Allocator_Err$meta_Ptr) {
+    let type = (TypeInfo){ .size = as$(u32, self->node_size), .align = self->node_align };
+    var node = self->spare;
+    if (node != null) {
+        self->spare = node->next;
+    } else {
+        node = try_(mem_Allocator_create(self->allocator, type)).addr;
+    }
+    node->len = 0;
+    return_ok({ .type = type, .addr = node });
+} unscoped;
+
+static fn_(ListUnrolled_freeNode(ListUnrolled* self, ListUnrolled_Node* node), void) {
+    let type = (TypeInfo){ .size = as$(u32, self->node_size), .align = self->node_align };
+    mem_Allocator_destroy(self->allocator, meta_ptrToAny((meta_Ptr){ .type = type, .addr = node }));
+}
+
+static fn_(ListUnrolled_linkAfter(ListUnrolled* self, ListUnrolled_Node* node, ListUnrolled_Node* new_node), void) {
+    new_node->prev = node;
+    new_node->next = node->next;
+    if (node->next != null) {
+        node->next->prev = new_node;
+    } else {
+        self->last = new_node;
+    }
+    node->next = new_node;
+}
+
+/// Unlink node from the list and keep it as spare
+static fn_(ListUnrolled_unlink(ListUnrolled* self, ListUnrolled_Node* node), void) {
+    if (node->prev != null) {
+        node->prev->next = node->next;
+    } else {
+        self->first = node->next;
+    }
+    if (node->next != null) {
+        node->next->prev = node->prev;
+    } else {
+        self->last = node->prev;
+    }
+    node->prev  = null;
+    node->next  = self->spare;
+    self->spare = node;
+}
+
+/// Refill a node under half capacity from its successor: merge both if they fit, else even them out
+static fn_(ListUnrolled_refill(ListUnrolled* self, ListUnrolled_Node* node), void) {
+    let half = as$(usize, self->node_cap / 2);
+    let next = node->next;
+    if (half <= node->len || next == null) { return; }
+
+    if (node->len + next->len <= self->node_cap) {
+        ListUnrolled_moveItems(self, node, node->len, next, 0, next->len);
+        node->len += next->len;
+        ListUnrolled_unlink(self, next);
+        return;
+    }
+    // Both keep at least half of more than node_cap items
+    let n = (node->len + next->len) / 2 - node->len;
+    ListUnrolled_moveItems(self, node, node->len, next, 0, n);
+    ListUnrolled_moveItems(self, next, 0, next, n, next->len - n);
+    node->len += n;
+    next->len -= n;
+}
+
+/// Move position past the end of its node to the start of the next one
+static fn_(ListUnrolled_normalize(ListUnrolled_Pos pos), ListUnrolled_Pos) {
+    if (pos.node != null && pos.node->len <= pos.index) {
+        return (ListUnrolled_Pos){ .node = pos.node->next, .index = 0 };
+    }
+    return pos;
+}
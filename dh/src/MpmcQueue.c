@@ -0,0 +1,146 @@
+#include "dh/MpmcQueue.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+#include "dh/int.h"
+
+// Internal helper functions
+static fn_(MpmcQueue_cellsType(const MpmcQueue* self), TypeInfo);
+static fn_(MpmcQueue_cellAt(const MpmcQueue* self, usize pos), u8*);
+static fn_(MpmcQueue_seq(u8* cell), volatile usize*);
+
+/*========== Implementation =================================================*/
+
+fn_scope(MpmcQueue_init(TypeInfo type, usize cap, mem_Allocator allocator), mem_Allocator_Err$MpmcQueue) {
+    debug_assert_fmt(0 < type.size, "Type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    let cap_pow2 = usize_chkdNextPow2(prim_max(cap, as$(usize, 2)));
+    if_none(cap_pow2) { return_err(mem_Allocator_Err_OutOfMemory()); }
+
+    let cell_align  = prim_max(as$(u32, alignOf$(usize)), type.align);
+    let item_offset = mem_alignForward(sizeOf$(usize), type.align);
+    var queue       = (MpmcQueue){
+              .type        = type,
+              .mask        = cap_pow2.value - 1,
+              .item_offset = item_offset,
+              .cell_size   = mem_alignForward(item_offset + type.size, cell_align),
+              .cells       = null,
+              .allocator   = allocator,
+    };
+    atomic_init(queue.enqueue_pos, 0);
+    atomic_init(queue.dequeue_pos, 0);
+    let cells_len = usize_chkdMul(cap_pow2.value, queue.cell_size);
+    if_none(cells_len) { return_err(mem_Allocator_Err_OutOfMemory()); }
+    queue.cells = try_(mem_Allocator_alloc(allocator, MpmcQueue_cellsType(&queue), cells_len.value)).addr;
+
+    // Every cell starts out free for the producer at its own position
+    for (usize pos = 0; pos < cap_pow2.value; ++pos) {
+        *MpmcQueue_seq(MpmcQueue_cellAt(&queue, pos)) = pos;
+    }
+    return_ok(queue);
+} unscoped;
+
+fn_(MpmcQueue_fini(MpmcQueue* self), void) {
+    debug_assert_nonnull(self);
+
+    let mem = (meta_Sli){
+        .type = MpmcQueue_cellsType(self),
+        .addr = self->cells,
+        .len  = (self->mask + 1) * self->cell_size,
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(mem));
+}
+
+fn_(MpmcQueue_cap(const MpmcQueue* self), usize) {
+    debug_assert_nonnull(self);
+    return self->mask + 1;
+}
+
+fn_(MpmcQueue_lenApprox(const MpmcQueue* self), usize) {
+    debug_assert_nonnull(self);
+
+    // Positions only grow, so reading the tail first never yields a negative length
+    let tail = atomic_load$(usize, as$(volatile usize*, &self->dequeue_pos.raw), atomic_MemOrd_acquire);
+    let head = atomic_load$(usize, as$(volatile usize*, &self->enqueue_pos.raw), atomic_MemOrd_acquire);
+    return prim_min(head - tail, self->mask + 1);
+}
+
+fn_(MpmcQueue_tryPush(MpmcQueue* self, meta_Ptr item), bool) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    var pos  = atomic_load(self->enqueue_pos, atomic_MemOrd_monotonic);
+    var cell = as$(u8*, null);
+    while (true) {
+        cell      = MpmcQueue_cellAt(self, pos);
+        let seq   = atomic_load$(usize, MpmcQueue_seq(cell), atomic_MemOrd_acquire);
+        let delta = as$(isize, seq - pos);
+        if (delta == 0) {
+            // Cell is free for this position: claim it, or retry from the position that won
+            if (atomic_cmpxchgWeak$(usize, &self->enqueue_pos.raw, &pos, pos + 1, atomic_MemOrd_monotonic, atomic_MemOrd_monotonic)) { break; }
+        } else if (delta < 0) {
+            return false; // Cell still holds the item from one lap ago
+        } else {
+            pos = atomic_load(self->enqueue_pos, atomic_MemOrd_monotonic);
+        }
+    }
+    bti_memcpy(cell + self->item_offset, item.addr, self->type.size);
+    atomic_store$(usize, MpmcQueue_seq(cell), pos + 1, atomic_MemOrd_release);
+    return true;
+}
+
+fn_(MpmcQueue_push(MpmcQueue* self, meta_Ptr item), void) {
+    while (!MpmcQueue_tryPush(self, item)) {
+        atomic_spinLoopHint();
+    }
+}
+
+fn_(MpmcQueue_tryPop(MpmcQueue* self, meta_Ptr out), bool) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull(out.addr);
+    debug_assert_fmt(out.type.size == self->type.size, "Item type mismatch");
+
+    var pos  = atomic_load(self->dequeue_pos, atomic_MemOrd_monotonic);
+    var cell = as$(u8*, null);
+    while (true) {
+        cell      = MpmcQueue_cellAt(self, pos);
+        let seq   = atomic_load$(usize, MpmcQueue_seq(cell), atomic_MemOrd_acquire);
+        let delta = as$(isize, seq - (pos + 1));
+        if (delta == 0) {
+            if (atomic_cmpxchgWeak$(usize, &self->dequeue_pos.raw, &pos, pos + 1, atomic_MemOrd_monotonic, atomic_MemOrd_monotonic)) { break; }
+        } else if (delta < 0) {
+            return false; // Producer of this position has not published yet
+        } else {
+            pos = atomic_load(self->dequeue_pos, atomic_MemOrd_monotonic);
+        }
+    }
+    bti_memcpy(out.addr, cell + self->item_offset, self->type.size);
+    // Hand the cell to the producer one lap ahead
+    atomic_store$(usize, MpmcQueue_seq(cell), pos + self->mask + 1, atomic_MemOrd_release);
+    return true;
+}
+
+fn_(MpmcQueue_pop(MpmcQueue* self, meta_Ptr out), void) {
+    while (!MpmcQueue_tryPop(self, out)) {
+        atomic_spinLoopHint();
+    }
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(MpmcQueue_cellsType(const MpmcQueue* self), TypeInfo) {
+    return (TypeInfo){
+        .size  = 1,
+        .align = prim_max(as$(u32, alignOf$(usize)), self->type.align),
+    };
+}
+
+static fn_(MpmcQueue_cellAt(const MpmcQueue* self, usize pos), u8*) {
+    return self->cells + (pos & self->mask) * self->cell_size;
+}
+
+/// Sequence number stored at the start of a cell
+static fn_(MpmcQueue_seq(u8* cell), volatile usize*) {
+    return as$(volatile usize*, cell);
+}
@@ -0,0 +1,267 @@
+#include "dh/MultiArrList.h"
+#include "dh/ArrList.h"
+#include "dh/debug/assert.h"
+
+/// Key column and ordering of a sort
+typedef struct MultiArrList_SortCtx {
+    const u8*  key;   ///< Column of key field
+    usize      size;  ///< Size of key field
+    sort_CmpFn cmpFn; ///< Ordering of key values
+} MultiArrList_SortCtx;
+
+// Internal helper functions
+static fn_(MultiArrList_columnAlign(const MultiArrList* self), u32);
+static fn_(MultiArrList_bufSize(const MultiArrList* self, usize cap), usize);
+static fn_(MultiArrList_columnOffset(const MultiArrList* self, usize field_index, usize cap), usize);
+static fn_(MultiArrList_column(const MultiArrList* self, usize field_index), u8*);
+static fn_(MultiArrList_freeBuf(MultiArrList* self), void);
+static fn_(MultiArrList_cmpByKey(anyptr_const lhs, anyptr_const rhs, anyptr_const arg), cmp_Ord);
+
+/*========== Implementation =================================================*/
+
+fn_(MultiArrList_init(TypeInfo type, const MultiArrList_Field* fields, usize fields_len, mem_Allocator allocator), MultiArrList) {
+    debug_assert_nonnull(fields);
+    debug_assert_fmt(0 < fields_len, "List must have at least one field");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    return (MultiArrList){
+        .type       = type,
+        .fields     = fields,
+        .fields_len = fields_len,
+        .bytes      = null,
+        .len        = 0,
+        .cap        = 0,
+        .allocator  = allocator,
+    };
+}
+
+fn_scope(MultiArrList_initCap(TypeInfo type, const MultiArrList_Field* fields, usize fields_len, mem_Allocator allocator, usize cap), mem_Allocator_Err$MultiArrList) {
+    var list = MultiArrList_init(type, fields, fields_len, allocator);
+    try_(MultiArrList_ensureTotalCap(&list, cap));
+    return_ok(list);
+} unscoped;
+
+fn_(MultiArrList_fini(MultiArrList* self), void) {
+    debug_assert_nonnull(self);
+    MultiArrList_freeBuf(self);
+}
+
+fn_scope(MultiArrList_ensureTotalCap(MultiArrList* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    if (new_cap <= self->cap) {
+        return_ok({});
+    }
+    // Column offsets depend on capacity, so every column moves to the new buffer
+    let grow_cap = ArrList_growCap(self->cap, new_cap);
+    let buf      = try_(mem_Allocator_alloc(
+        self->allocator,
+        ((TypeInfo){ .size = 1, .align = MultiArrList_columnAlign(self) }),
+        MultiArrList_bufSize(self, grow_cap)
+    ));
+    for (usize i = 0; i < self->fields_len; ++i) {
+        if (self->len == 0) { break; }
+        bti_memcpy(
+            as$(u8*, buf.addr) + MultiArrList_columnOffset(self, i, grow_cap),
+            MultiArrList_column(self, i),
+            self->len * self->fields[i].type.size
+        );
+    }
+    MultiArrList_freeBuf(self);
+    self->bytes = buf.addr;
+    self->cap   = grow_cap;
+    return_ok({});
+} unscoped;
+
+fn_scope(MultiArrList_ensureUnusedCap(MultiArrList* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(MultiArrList_ensureTotalCap(self, self->len + additional));
+    return_ok({});
+} unscoped;
+
+fn_(MultiArrList_items(const MultiArrList* self, usize field_index), meta_Sli) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(field_index < self->fields_len, "Field index out of bounds");
+
+    return (meta_Sli){
+        .type = self->fields[field_index].type,
+        .addr = MultiArrList_column(self, field_index),
+        .len  = self->len,
+    };
+}
+
+fn_(MultiArrList_get(const MultiArrList* self, usize index, meta_Ptr out), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+    debug_assert_fmt(out.type.size == self->type.size, "Item type mismatch");
+
+    for (usize i = 0; i < self->fields_len; ++i) {
+        let field = self->fields[i];
+        bti_memcpy(as$(u8*, out.addr) + field.offset, MultiArrList_column(self, i) + index * field.type.size, field.type.size);
+    }
+}
+
+fn_(MultiArrList_set(MultiArrList* self, usize index, meta_Ptr item), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    for (usize i = 0; i < self->fields_len; ++i) {
+        let field = self->fields[i];
+        bti_memcpy(MultiArrList_column(self, i) + index * field.type.size, as$(const u8*, item.addr) + field.offset, field.type.size);
+    }
+}
+
+fn_scope(MultiArrList_append(MultiArrList* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(MultiArrList_ensureUnusedCap(self, 1));
+    MultiArrList_appendAssumeCap(self, item);
+    return_ok({});
+} unscoped;
+
+fn_(MultiArrList_appendAssumeCap(MultiArrList* self, meta_Ptr item), void) {
+    debug_assert_nonnull(self);
+    debug_assert(self->len < self->cap);
+
+    self->len += 1;
+    MultiArrList_set(self, self->len - 1, item);
+}
+
+fn_(MultiArrList_removeOrdered(MultiArrList* self, usize index), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+
+    for (usize i = 0; i < self->fields_len; ++i) {
+        let size   = self->fields[i].type.size;
+        let column = MultiArrList_column(self, i);
+        bti_memmove(column + index * size, column + (index + 1) * size, (self->len - index - 1) * size);
+    }
+    self->len -= 1;
+}
+
+fn_(MultiArrList_removeSwap(MultiArrList* self, usize index), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+
+    let last = self->len - 1;
+    if (index != last) {
+        for (usize i = 0; i < self->fields_len; ++i) {
+            let size   = self->fields[i].type.size;
+            let column = MultiArrList_column(self, i);
+            bti_memcpy(column + index * size, column + last * size, size);
+        }
+    }
+    self->len = last;
+}
+
+fn_scope_ext(MultiArrList_sort(MultiArrList* self, usize field_index, sort_CmpFn cmpFn), Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(field_index < self->fields_len, "Field index out of bounds");
+
+    if (self->len < 2) {
+        return_ok({});
+    }
+
+    // Sort a permutation by the key column only, then gather every column through it
+    let perm_mem = try_(mem_Allocator_alloc(self->allocator, typeInfo$(usize), self->len));
+    defer_(mem_Allocator_free(self->allocator, meta_sliToAny(perm_mem)));
+    let perm = as$(usize*, perm_mem.addr);
+    for (usize i = 0; i < self->len; ++i) { perm[i] = i; }
+
+    let ctx = (MultiArrList_SortCtx){
+        .key   = MultiArrList_column(self, field_index),
+        .size  = self->fields[field_index].type.size,
+        .cmpFn = cmpFn,
+    };
+    try_(sort_stableSortWithArg(self->allocator, perm_mem, wrapFn(MultiArrList_cmpByKey), &ctx));
+
+    var max_size = as$(usize, 0);
+    for (usize i = 0; i < self->fields_len; ++i) {
+        max_size = prim_max(max_size, self->fields[i].type.size);
+    }
+    let temp_mem = try_(mem_Allocator_alloc(self->allocator, typeInfo$(u8), max_size * self->len));
+    defer_(mem_Allocator_free(self->allocator, meta_sliToAny(temp_mem)));
+    let temp = as$(u8*, temp_mem.addr);
+    for (usize i = 0; i < self->fields_len; ++i) {
+        let size   = self->fields[i].type.size;
+        let column = MultiArrList_column(self, i);
+        for (usize j = 0; j < self->len; ++j) {
+            bti_memcpy(temp + j * size, column + perm[j] * size, size);
+        }
+        bti_memcpy(column, temp, self->len * size);
+    }
+    return_ok({});
+} unscoped_ext;
+
+fn_(MultiArrList_clearRetainingCap(MultiArrList* self), void) {
+    debug_assert_nonnull(self);
+    self->len = 0;
+}
+
+fn_(MultiArrList_clearAndFree(MultiArrList* self), void) {
+    debug_assert_nonnull(self);
+
+    MultiArrList_freeBuf(self);
+    self->bytes = null;
+    self->len   = 0;
+    self->cap   = 0;
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(MultiArrList_columnAlign(const MultiArrList* self), u32) {
+    var align = as$(u32, 1);
+    for (usize i = 0; i < self->fields_len; ++i) {
+        align = prim_max(align, self->fields[i].type.align);
+    }
+    return align;
+}
+
+static fn_(MultiArrList_bufSize(const MultiArrList* self, usize cap), usize) {
+    var size = as$(usize, 0);
+    for (usize i = 0; i < self->fields_len; ++i) {
+        size += self->fields[i].type.size * cap;
+    }
+    return size;
+}
+
+/// Columns with stricter alignment come first (ties keep field order), so each column
+/// starts at a multiple of its alignment without padding
+static fn_(MultiArrList_columnOffset(const MultiArrList* self, usize field_index, usize cap), usize) {
+    let align  = self->fields[field_index].type.align;
+    var offset = as$(usize, 0);
+    for (usize i = 0; i < self->fields_len; ++i) {
+        let other = self->fields[i].type;
+        if (align < other.align || (other.align == align && i < field_index)) {
+            offset += other.size * cap;
+        }
+    }
+    return offset;
+}
+
+static fn_(MultiArrList_column(const MultiArrList* self, usize field_index), u8*) {
+    return self->bytes + MultiArrList_columnOffset(self, field_index, self->cap);
+}
+
+static fn_(MultiArrList_freeBuf(MultiArrList* self), void) {
+    if (self->bytes == null) { return; }
+    let buf = (meta_Sli){
+        .type = { .size = 1, .align = MultiArrList_columnAlign(self) },
+        .addr = self->bytes,
+        .len  = MultiArrList_bufSize(self, self->cap),
+    };
+    mem_Allocator_free(self->allocator, meta_sliToAny(buf));
+}
+
+/// Compare permutation entries by the key values they refer to
+static fn_(MultiArrList_cmpByKey(anyptr_const lhs, anyptr_const rhs, anyptr_const arg), cmp_Ord) {
+    let ctx = as$(const MultiArrList_SortCtx*, arg);
+    return invoke(
+        ctx->cmpFn,
+        ctx->key + *as$(const usize*, lhs) * ctx->size,
+        ctx->key + *as$(const usize*, rhs) * ctx->size
+    );
+}
@@ -0,0 +1,282 @@
+#include "dh/PriorityQueue.h"
+#include "dh/debug/assert.h"
+
+/// Marks position of released handle (low bits link to next released handle)
+#define PriorityQueue_released_tag (~(usize_limit_max >> 1))
+/// End of released handle list (fits in the link bits)
+#define PriorityQueue_handle_none  (usize_limit_max >> 1)
+
+// Internal helper functions
+static fn_(PriorityQueue_itemAt(const PriorityQueue* self, usize index), u8*);
+static fn_(PriorityQueue_handles(const PriorityQueue* self), usize*);
+static fn_(PriorityQueue_positions(const PriorityQueue* self), usize*);
+static fn_(PriorityQueue_less(const PriorityQueue* self, anyptr_const lhs, anyptr_const rhs), bool);
+static fn_(PriorityQueue_place(PriorityQueue* self, usize index, anyptr_const item, usize handle), void);
+static fn_(PriorityQueue_move(PriorityQueue* self, usize from, usize to), void);
+static fn_(PriorityQueue_siftUp(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void);
+static fn_(PriorityQueue_siftDown(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void);
+static fn_(PriorityQueue_reposition(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void);
+static fn_(PriorityQueue_releaseHandle(PriorityQueue* self, usize handle), void);
+
+/*========== Implementation =================================================*/
+
+fn_(PriorityQueue_init(TypeInfo type, sort_CmpFn cmpFn, PriorityQueue_Arity arity, mem_Allocator allocator), PriorityQueue) {
+    debug_assert_fmt(arity == PriorityQueue_Arity_binary || arity == PriorityQueue_Arity_quaternary, "Arity must be 2 or 4");
+
+    return (PriorityQueue){
+        .items       = ArrList_init(type, allocator),
+        .handles     = ArrList_init(typeInfo$(usize), allocator),
+        .positions   = ArrList_init(typeInfo$(usize), allocator),
+        .free_handle = PriorityQueue_handle_none,
+        .cmpFn       = cmpFn,
+        .arity       = arity,
+    };
+}
+
+fn_scope_ext(PriorityQueue_initSli(meta_Sli_const items, sort_CmpFn cmpFn, PriorityQueue_Arity arity, mem_Allocator allocator), mem_Allocator_Err$PriorityQueue) {
+    var queue = PriorityQueue_init(items.type, cmpFn, arity, allocator);
+    errdefer_(PriorityQueue_fini(&queue));
+    try_(PriorityQueue_ensureUnusedCap(&queue, items.len));
+
+    bti_memcpy(queue.items.items.addr, items.addr, items.len * items.type.size);
+    let handles   = PriorityQueue_handles(&queue);
+    let positions = PriorityQueue_positions(&queue);
+    for (usize i = 0; i < items.len; ++i) {
+        handles[i]   = i;
+        positions[i] = i;
+    }
+    queue.items.items.len     = items.len;
+    queue.handles.items.len   = items.len;
+    queue.positions.items.len = items.len;
+
+    // Floyd's heapify: sift down every parent from the last one, O(n) in total
+    if (1 < items.len) {
+        let tmp = bti_alloca(items.type.size);
+        for (usize parent = (items.len - 2) / arity + 1; 0 < parent--;) {
+            bti_memcpy(tmp, PriorityQueue_itemAt(&queue, parent), items.type.size);
+            PriorityQueue_siftDown(&queue, parent, tmp, handles[parent]);
+        }
+    }
+    return_ok(queue);
+} unscoped_ext;
+
+fn_(PriorityQueue_fini(PriorityQueue* self), void) {
+    debug_assert_nonnull(self);
+
+    ArrList_fini(&self->items);
+    ArrList_fini(&self->handles);
+    ArrList_fini(&self->positions);
+}
+
+fn_scope(PriorityQueue_ensureUnusedCap(PriorityQueue* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(ArrList_ensureUnusedCap(&self->items, additional));
+    try_(ArrList_ensureUnusedCap(&self->handles, additional));
+    try_(ArrList_ensureUnusedCap(&self->positions, additional));
+    return_ok({});
+} unscoped;
+
+fn_(PriorityQueue_len(const PriorityQueue* self), usize) {
+    debug_assert_nonnull(self);
+    return self->items.items.len;
+}
+
+fn_scope(PriorityQueue_peek(const PriorityQueue* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->items.items.len == 0) {
+        return_none();
+    }
+    return_some({ .type = self->items.items.type, .addr = self->items.items.addr });
+} unscoped;
+
+fn_(PriorityQueue_isQueued(const PriorityQueue* self, PriorityQueue_Handle handle), bool) {
+    debug_assert_nonnull(self);
+
+    return handle.id < self->positions.items.len
+        && !(PriorityQueue_positions(self)[handle.id] & PriorityQueue_released_tag);
+}
+
+fn_(PriorityQueue_get(const PriorityQueue* self, PriorityQueue_Handle handle), meta_Ptr_const) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(PriorityQueue_isQueued(self, handle), "Handle does not refer to a queued item");
+
+    return (meta_Ptr_const){
+        .type = self->items.items.type,
+        .addr = PriorityQueue_itemAt(self, PriorityQueue_positions(self)[handle.id]),
+    };
+}
+
+fn_scope(PriorityQueue_push(PriorityQueue* self, meta_Ptr item), mem_Allocator_Err$PriorityQueue_Handle) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(item.type.size == self->items.items.type.size, "Item type mismatch");
+
+    // Lengths below only grow in place, and a reused handle is only unlinked from the free list once all three arrays have room
+    try_(PriorityQueue_ensureUnusedCap(self, 1));
+    var handle = self->free_handle;
+    if (handle != PriorityQueue_handle_none) {
+        self->free_handle = PriorityQueue_positions(self)[handle] & ~PriorityQueue_released_tag;
+    } else {
+        handle = self->positions.items.len++;
+    }
+    let hole = self->items.items.len++;
+    self->handles.items.len++;
+    PriorityQueue_siftUp(self, hole, item.addr, handle);
+    return_ok({ .id = handle });
+} unscoped;
+
+fn_scope(PriorityQueue_pop(PriorityQueue* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    let len = self->items.items.len;
+    if (len == 0) {
+        return_none();
+    }
+    let size = self->items.items.type.size;
+    let last = len - 1;
+    PriorityQueue_releaseHandle(self, PriorityQueue_handles(self)[0]);
+    self->items.items.len   = last;
+    self->handles.items.len = last;
+
+    // Least item ends up just past the heap, the former last item fills the root
+    if (0 < last) {
+        let tmp         = bti_alloca(size);
+        let last_handle = PriorityQueue_handles(self)[last];
+        bti_memcpy(tmp, PriorityQueue_itemAt(self, last), size);
+        bti_memcpy(PriorityQueue_itemAt(self, last), PriorityQueue_itemAt(self, 0), size);
+        PriorityQueue_siftDown(self, 0, tmp, last_handle);
+    }
+    return_some({ .type = self->items.items.type, .addr = PriorityQueue_itemAt(self, last) });
+} unscoped;
+
+fn_(PriorityQueue_decreaseKey(PriorityQueue* self, PriorityQueue_Handle handle, meta_Ptr item), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(PriorityQueue_isQueued(self, handle), "Handle does not refer to a queued item");
+    debug_assert_fmt(item.type.size == self->items.items.type.size, "Item type mismatch");
+
+    let hole = PriorityQueue_positions(self)[handle.id];
+    debug_assert_fmt(!PriorityQueue_less(self, PriorityQueue_itemAt(self, hole), item.addr), "New item must not compare greater");
+    let tmp = bti_alloca(item.type.size);
+    bti_memcpy(tmp, item.addr, item.type.size);
+    PriorityQueue_siftUp(self, hole, tmp, handle.id);
+}
+
+fn_(PriorityQueue_update(PriorityQueue* self, PriorityQueue_Handle handle, meta_Ptr item), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(PriorityQueue_isQueued(self, handle), "Handle does not refer to a queued item");
+    debug_assert_fmt(item.type.size == self->items.items.type.size, "Item type mismatch");
+
+    // Copy first, the item may live inside the heap
+    let tmp = bti_alloca(item.type.size);
+    bti_memcpy(tmp, item.addr, item.type.size);
+    PriorityQueue_reposition(self, PriorityQueue_positions(self)[handle.id], tmp, handle.id);
+}
+
+fn_(PriorityQueue_remove(PriorityQueue* self, PriorityQueue_Handle handle), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(PriorityQueue_isQueued(self, handle), "Handle does not refer to a queued item");
+
+    let size = self->items.items.type.size;
+    let hole = PriorityQueue_positions(self)[handle.id];
+    let last = self->items.items.len - 1;
+    PriorityQueue_releaseHandle(self, handle.id);
+    self->items.items.len   = last;
+    self->handles.items.len = last;
+    if (hole == last) { return; }
+
+    // Former last item fills the hole and may need to go either way
+    let tmp = bti_alloca(size);
+    bti_memcpy(tmp, PriorityQueue_itemAt(self, last), size);
+    PriorityQueue_reposition(self, hole, tmp, PriorityQueue_handles(self)[last]);
+}
+
+fn_(PriorityQueue_clearRetainingCap(PriorityQueue* self), void) {
+    debug_assert_nonnull(self);
+
+    ArrList_clearRetainingCap(&self->items);
+    ArrList_clearRetainingCap(&self->handles);
+    ArrList_clearRetainingCap(&self->positions);
+    self->free_handle = PriorityQueue_handle_none;
+}
+
+fn_(PriorityQueue_clearAndFree(PriorityQueue* self), void) {
+    debug_assert_nonnull(self);
+
+    PriorityQueue_fini(self);
+    *self = PriorityQueue_init(self->items.items.type, self->cmpFn, self->arity, self->items.allocator);
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(PriorityQueue_itemAt(const PriorityQueue* self, usize index), u8*) {
+    return as$(u8*, self->items.items.addr) + index * self->items.items.type.size;
+}
+
+static fn_(PriorityQueue_handles(const PriorityQueue* self), usize*) {
+    return as$(usize*, self->handles.items.addr);
+}
+
+static fn_(PriorityQueue_positions(const PriorityQueue* self), usize*) {
+    return as$(usize*, self->positions.items.addr);
+}
+
+static fn_(PriorityQueue_less(const PriorityQueue* self, anyptr_const lhs, anyptr_const rhs), bool) {
+    return invoke(self->cmpFn, lhs, rhs) == cmp_Ord_lt;
+}
+
+/// Store item and its handle at index
+static fn_(PriorityQueue_place(PriorityQueue* self, usize index, anyptr_const item, usize handle), void) {
+    bti_memcpy(PriorityQueue_itemAt(self, index), item, self->items.items.type.size);
+    PriorityQueue_handles(self)[index] = handle;
+    PriorityQueue_positions(self)[handle] = index;
+}
+
+static fn_(PriorityQueue_move(PriorityQueue* self, usize from, usize to), void) {
+    PriorityQueue_place(self, to, PriorityQueue_itemAt(self, from), PriorityQueue_handles(self)[from]);
+}
+
+/// Move parents greater than item down into the hole, then fill it with item
+static fn_(PriorityQueue_siftUp(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void) {
+    while (0 < hole) {
+        let parent = (hole - 1) / self->arity;
+        if (!PriorityQueue_less(self, item, PriorityQueue_itemAt(self, parent))) { break; }
+        PriorityQueue_move(self, parent, hole);
+        hole = parent;
+    }
+    PriorityQueue_place(self, hole, item, handle);
+}
+
+/// Move least children less than item up into the hole, then fill it with item
+static fn_(PriorityQueue_siftDown(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void) {
+    let len = self->items.items.len;
+    while (true) {
+        let first = hole * self->arity + 1;
+        if (len <= first) { break; }
+        let end   = prim_min(first + self->arity, len);
+        var least = first;
+        for (usize child = first + 1; child < end; ++child) {
+            if (PriorityQueue_less(self, PriorityQueue_itemAt(self, child), PriorityQueue_itemAt(self, least))) {
+                least = child;
+            }
+        }
+        if (!PriorityQueue_less(self, PriorityQueue_itemAt(self, least), item)) { break; }
+        PriorityQueue_move(self, least, hole);
+        hole = least;
+    }
+    PriorityQueue_place(self, hole, item, handle);
+}
+
+/// Fill hole with item, moving it up or down as its order requires
+static fn_(PriorityQueue_reposition(PriorityQueue* self, usize hole, anyptr_const item, usize handle), void) {
+    if (0 < hole && PriorityQueue_less(self, item, PriorityQueue_itemAt(self, (hole - 1) / self->arity))) {
+        PriorityQueue_siftUp(self, hole, item, handle);
+    } else {
+        PriorityQueue_siftDown(self, hole, item, handle);
+    }
+}
+
+static fn_(PriorityQueue_releaseHandle(PriorityQueue* self, usize handle), void) {
+    PriorityQueue_positions(self)[handle] = PriorityQueue_released_tag | self->free_handle;
+    self->free_handle                     = handle;
+}
@@ -0,0 +1,173 @@
+#include "dh/SegArrList.h"
+#include "dh/debug/assert.h"
+
+/// Number of items in the first segment
+#define SegArrList_first_seg_len (as$(usize, 1) << SegArrList_first_seg_log2)
+
+// Internal helper functions
+static fn_(SegArrList_segLen(usize seg), usize);
+static fn_(SegArrList_segStart(usize seg), usize);
+static fn_(SegArrList_segOf(usize index), usize);
+static fn_(SegArrList_freeSegs(SegArrList* self), void);
+
+/*========== Implementation =================================================*/
+
+fn_(SegArrList_init(TypeInfo type, mem_Allocator allocator), SegArrList) {
+    debug_assert_fmt(0 < type.size, "Type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    return (SegArrList){
+        .type      = type,
+        .segs      = { 0 },
+        .segs_len  = 0,
+        .len       = 0,
+        .allocator = allocator,
+    };
+}
+
+fn_scope(SegArrList_initCap(TypeInfo type, mem_Allocator allocator, usize cap), mem_Allocator_Err$SegArrList) {
+    var list = SegArrList_init(type, allocator);
+    try_(SegArrList_ensureTotalCap(&list, cap));
+    return_ok(list);
+} unscoped;
+
+fn_(SegArrList_fini(SegArrList* self), void) {
+    debug_assert_nonnull(self);
+    SegArrList_freeSegs(self);
+}
+
+fn_(SegArrList_cap(const SegArrList* self), usize) {
+    debug_assert_nonnull(self);
+    return SegArrList_segStart(self->segs_len);
+}
+
+fn_scope(SegArrList_ensureTotalCap(SegArrList* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    // Each new segment doubles the capacity, existing segments stay where they are
+    while (SegArrList_cap(self) < new_cap) {
+        debug_assert_fmt(self->segs_len < SegArrList_segs_max, "Capacity overflow");
+        let seg                    = try_(mem_Allocator_alloc(self->allocator, self->type, SegArrList_segLen(self->segs_len)));
+        self->segs[self->segs_len] = seg.addr;
+        self->segs_len += 1;
+    }
+    return_ok({});
+} unscoped;
+
+fn_scope(SegArrList_ensureUnusedCap(SegArrList* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(SegArrList_ensureTotalCap(self, self->len + additional));
+    return_ok({});
+} unscoped;
+
+fn_(SegArrList_at(const SegArrList* self, usize index), meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->len, "Index out of bounds");
+
+    let seg = SegArrList_segOf(index);
+    return (meta_Ptr){
+        .type = self->type,
+        .addr = self->segs[seg] + (index - SegArrList_segStart(seg)) * self->type.size,
+    };
+}
+
+fn_scope(SegArrList_append(SegArrList* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull(item.addr);
+    debug_assert(item.type.size == self->type.size);
+
+    let slot = try_(SegArrList_addBackOne(self));
+    bti_memcpy(slot.addr, item.addr, item.type.size);
+    return_ok({});
+} unscoped;
+
+fn_scope(SegArrList_addBackOne(SegArrList* self), mem_Allocator_Err$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    try_(SegArrList_ensureUnusedCap(self, 1));
+    self->len += 1;
+    return_ok(SegArrList_at(self, self->len - 1));
+} unscoped;
+
+fn_scope(SegArrList_popOrNull(SegArrList* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->len == 0) {
+        return_none();
+    }
+    let item = SegArrList_at(self, self->len - 1);
+    self->len -= 1;
+    return_some(item);
+} unscoped;
+
+fn_(SegArrList_clearRetainingCap(SegArrList* self), void) {
+    debug_assert_nonnull(self);
+    self->len = 0;
+}
+
+fn_(SegArrList_clearAndFree(SegArrList* self), void) {
+    debug_assert_nonnull(self);
+
+    SegArrList_freeSegs(self);
+    self->segs_len = 0;
+    self->len      = 0;
+}
+
+fn_(SegArrList_iter(const SegArrList* self), SegArrList_Iter) {
+    debug_assert_nonnull(self);
+
+    return (SegArrList_Iter){
+        .list     = self,
+        .index    = 0,
+        .seg      = 0,
+        .seg_next = SegArrList_segStart(1),
+    };
+}
+
+fn_scope(SegArrList_Iter_next(SegArrList_Iter* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->list->len <= self->index) {
+        return_none();
+    }
+    // Walk segments in order instead of locating every index
+    if (self->index == self->seg_next) {
+        self->seg += 1;
+        self->seg_next = SegArrList_segStart(self->seg + 1);
+    }
+    let type  = self->list->type;
+    let start = SegArrList_segStart(self->seg);
+    let addr  = self->list->segs[self->seg] + (self->index - start) * type.size;
+    self->index += 1;
+    return_some((meta_Ptr){ .type = type, .addr = addr });
+} unscoped;
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(SegArrList_segLen(usize seg), usize) {
+    return SegArrList_first_seg_len << seg;
+}
+
+/// Index of first item in segment (also capacity of all segments before it)
+static fn_(SegArrList_segStart(usize seg), usize) {
+    return (SegArrList_first_seg_len << seg) - SegArrList_first_seg_len;
+}
+
+/// Segment holding index, from the highest set bit of `index + first_seg_len`
+static fn_(SegArrList_segOf(usize index), usize) {
+    let biased = as$(u64, index) + SegArrList_first_seg_len;
+    return as$(usize, 63 - __builtin_clzll(biased)) - SegArrList_first_seg_log2;
+}
+
+static fn_(SegArrList_freeSegs(SegArrList* self), void) {
+    for (usize seg = 0; seg < self->segs_len; ++seg) {
+        let mem = (meta_Sli){
+            .type = self->type,
+            .addr = self->segs[seg],
+            .len  = SegArrList_segLen(seg),
+        };
+        mem_Allocator_free(self->allocator, meta_sliToAny(mem));
+    }
+}
@@ -0,0 +1,160 @@
+#include "dh/SlotMap.h"
+#include "dh/debug/assert.h"
+
+/// End of free slot list
+#define SlotMap_slot_none (u32_limit_max)
+
+// Internal helper functions
+static fn_(SlotMap_itemAt(const SlotMap* self, usize index), u8*);
+static fn_(SlotMap_owners(const SlotMap* self), u32*);
+static fn_(SlotMap_slots(const SlotMap* self), SlotMap_Slot*);
+static fn_(SlotMap_freeSlot(SlotMap* self, u32 slot), void);
+
+/*========== Implementation =================================================*/
+
+fn_(SlotMap_Handle_toBits(SlotMap_Handle self), u64) {
+    return (as$(u64, self.gen) << 32) | self.index;
+}
+
+fn_(SlotMap_Handle_fromBits(u64 bits), SlotMap_Handle) {
+    return (SlotMap_Handle){ .index = as$(u32, bits), .gen = as$(u32, bits >> 32) };
+}
+
+fn_(SlotMap_Handle_eq(SlotMap_Handle self, SlotMap_Handle other), bool) {
+    return self.index == other.index && self.gen == other.gen;
+}
+
+fn_(SlotMap_init(TypeInfo type, mem_Allocator allocator), SlotMap) {
+    return (SlotMap){
+        .items     = ArrList_init(type, allocator),
+        .owners    = ArrList_init(typeInfo$(u32), allocator),
+        .slots     = ArrList_init(typeInfo$(SlotMap_Slot), allocator),
+        .free_slot = SlotMap_slot_none,
+    };
+}
+
+fn_(SlotMap_fini(SlotMap* self), void) {
+    debug_assert_nonnull(self);
+
+    ArrList_fini(&self->items);
+    ArrList_fini(&self->owners);
+    ArrList_fini(&self->slots);
+}
+
+fn_scope(SlotMap_ensureUnusedCap(SlotMap* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(ArrList_ensureUnusedCap(&self->items, additional));
+    try_(ArrList_ensureUnusedCap(&self->owners, additional));
+    try_(ArrList_ensureUnusedCap(&self->slots, additional));
+    return_ok({});
+} unscoped;
+
+fn_(SlotMap_len(const SlotMap* self), usize) {
+    debug_assert_nonnull(self);
+    return self->items.items.len;
+}
+
+fn_(SlotMap_contains(const SlotMap* self, SlotMap_Handle handle), bool) {
+    debug_assert_nonnull(self);
+
+    return handle.index < self->slots.items.len
+        && SlotMap_slots(self)[handle.index].gen == handle.gen
+        && (handle.gen & 1) != 0;
+}
+
+fn_scope(SlotMap_get(const SlotMap* self, SlotMap_Handle handle), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (!SlotMap_contains(self, handle)) {
+        return_none();
+    }
+    return_some({ .type = self->items.items.type, .addr = SlotMap_itemAt(self, SlotMap_slots(self)[handle.index].index) });
+} unscoped;
+
+fn_(SlotMap_handleAt(const SlotMap* self, usize index), SlotMap_Handle) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(index < self->items.items.len, "Index out of bounds");
+
+    let slot = SlotMap_owners(self)[index];
+    return (SlotMap_Handle){ .index = slot, .gen = SlotMap_slots(self)[slot].gen };
+}
+
+fn_scope(SlotMap_insert(SlotMap* self, meta_Ptr item), mem_Allocator_Err$SlotMap_Handle) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(item.type.size == self->items.items.type.size, "Item type mismatch");
+
+    try_(SlotMap_ensureUnusedCap(self, 1));
+    var slot = self->free_slot;
+    if (slot != SlotMap_slot_none) {
+        self->free_slot = SlotMap_slots(self)[slot].index;
+    } else {
+        debug_assert_fmt(self->slots.items.len < SlotMap_slot_none, "Slot count overflow");
+        slot                          = as$(u32, self->slots.items.len++);
+        SlotMap_slots(self)[slot].gen = 0;
+    }
+    let index = self->items.items.len++;
+    self->owners.items.len++;
+    bti_memcpy(SlotMap_itemAt(self, index), item.addr, item.type.size);
+    SlotMap_owners(self)[index] = slot;
+
+    // Odd generation marks the slot occupied
+    let entry = &SlotMap_slots(self)[slot];
+    entry->gen += 1;
+    entry->index = as$(u32, index);
+    return_ok({ .index = slot, .gen = entry->gen });
+} unscoped;
+
+fn_(SlotMap_remove(SlotMap* self, SlotMap_Handle handle), bool) {
+    debug_assert_nonnull(self);
+
+    if (!SlotMap_contains(self, handle)) { return false; }
+    let size = self->items.items.type.size;
+    let hole = SlotMap_slots(self)[handle.index].index;
+    let last = self->items.items.len - 1;
+    SlotMap_freeSlot(self, handle.index);
+    self->items.items.len  = last;
+    self->owners.items.len = last;
+    if (hole == last) { return true; }
+
+    // Last item fills the hole, its slot follows it
+    let moved = SlotMap_owners(self)[last];
+    bti_memcpy(SlotMap_itemAt(self, hole), SlotMap_itemAt(self, last), size);
+    SlotMap_owners(self)[hole]       = moved;
+    SlotMap_slots(self)[moved].index = as$(u32, hole);
+    return true;
+}
+
+fn_(SlotMap_clearRetainingCap(SlotMap* self), void) {
+    debug_assert_nonnull(self);
+
+    let owners = SlotMap_owners(self);
+    for (usize i = 0; i < self->owners.items.len; ++i) {
+        SlotMap_freeSlot(self, owners[i]);
+    }
+    ArrList_clearRetainingCap(&self->items);
+    ArrList_clearRetainingCap(&self->owners);
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(SlotMap_itemAt(const SlotMap* self, usize index), u8*) {
+    return as$(u8*, self->items.items.addr) + index * self->items.items.type.size;
+}
+
+static fn_(SlotMap_owners(const SlotMap* self), u32*) {
+    return as$(u32*, self->owners.items.addr);
+}
+
+static fn_(SlotMap_slots(const SlotMap* self), SlotMap_Slot*) {
+    return as$(SlotMap_Slot*, self->slots.items.addr);
+}
+
+/// Bump generation to even and link slot into the free list, unless its generations ran out
+static fn_(SlotMap_freeSlot(SlotMap* self, u32 slot), void) {
+    let entry = &SlotMap_slots(self)[slot];
+    entry->gen += 1;
+    if (entry->gen == 0) { return; }
+    entry->index    = self->free_slot;
+    self->free_slot = slot;
+}
@@ -0,0 +1,213 @@
+#include "dh/SmallArrList.h"
+#include "dh/ArrList.h"
+#include "dh/mem/common.h"
+#include "dh/debug/assert.h"
+
+// Internal helper functions
+static fn_(SmallArrList_inlineItems(SmallArrList* self), anyptr);
+static fn_(SmallArrList_freeSpilled(SmallArrList* self), void);
+static fn_(SmallArrList_at(const SmallArrList* self, usize index), u8*);
+
+/*========== Implementation =================================================*/
+
+fn_(SmallArrList_init(SmallArrList* self, TypeInfo type, usize inline_cap, mem_Allocator allocator), void) {
+    debug_assert_nonnull(self);
+    debug_assert_fmt(0 < type.size, "Type size must be greater than 0");
+    debug_assert_fmt(0 < inline_cap, "Inline capacity must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    self->items      = (meta_Sli){ .type = type, .addr = null, .len = 0 };
+    self->cap        = inline_cap;
+    self->allocator  = allocator;
+    self->inline_cap = inline_cap;
+    self->items.addr = SmallArrList_inlineItems(self);
+}
+
+fn_(SmallArrList_fini(SmallArrList* self), void) {
+    debug_assert_nonnull(self);
+    SmallArrList_freeSpilled(self);
+}
+
+fn_(SmallArrList_isInline(const SmallArrList* self), bool) {
+    debug_assert_nonnull(self);
+    return self->cap == self->inline_cap;
+}
+
+fn_scope(SmallArrList_toOwnedSli(SmallArrList* self), mem_Allocator_Err$meta_Sli) {
+    debug_assert_nonnull(self);
+
+    if (!SmallArrList_isInline(self)) {
+        let actual_mem = (meta_Sli){ .type = self->items.type, .addr = self->items.addr, .len = self->cap };
+        if (mem_Allocator_resize(self->allocator, meta_sliToAny(actual_mem), self->items.len)) {
+            let result = self->items;
+            SmallArrList_init(self, self->items.type, self->inline_cap, self->allocator);
+            return_ok(result);
+        }
+    }
+
+    let new_mem = try_(mem_Allocator_alloc(self->allocator, self->items.type, self->items.len));
+    bti_memcpy(new_mem.addr, self->items.addr, self->items.len * self->items.type.size);
+    SmallArrList_freeSpilled(self);
+    SmallArrList_init(self, self->items.type, self->inline_cap, self->allocator);
+    return_ok(new_mem);
+} unscoped;
+
+fn_scope(SmallArrList_ensureTotalCap(SmallArrList* self, usize new_cap), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    if (new_cap <= self->cap) {
+        return_ok({});
+    }
+    // Same growth as ArrList, continuing from the inline capacity
+    let grow_cap = ArrList_growCap(self->cap, new_cap);
+
+    // First spill, items leave the inline storage
+    if (SmallArrList_isInline(self)) {
+        let new_mem = try_(mem_Allocator_alloc(self->allocator, self->items.type, grow_cap));
+        bti_memcpy(new_mem.addr, self->items.addr, self->items.len * self->items.type.size);
+        self->items.addr = new_mem.addr;
+        self->cap        = grow_cap;
+        return_ok({});
+    }
+
+    let actual_mem = (meta_Sli){ .type = self->items.type, .addr = self->items.addr, .len = self->cap };
+    if (mem_Allocator_resize(self->allocator, meta_sliToAny(actual_mem), grow_cap)) {
+        self->cap = grow_cap;
+        return_ok({});
+    }
+    let new_mem = try_(mem_Allocator_alloc(self->allocator, self->items.type, grow_cap));
+    bti_memcpy(new_mem.addr, self->items.addr, self->items.len * self->items.type.size);
+    mem_Allocator_free(self->allocator, meta_sliToAny(actual_mem));
+    self->items.addr = new_mem.addr;
+    self->cap        = grow_cap;
+    return_ok({});
+} unscoped;
+
+fn_scope(SmallArrList_ensureUnusedCap(SmallArrList* self, usize additional), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+
+    try_(SmallArrList_ensureTotalCap(self, self->items.len + additional));
+    return_ok({});
+} unscoped;
+
+fn_scope(SmallArrList_append(SmallArrList* self, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert_nonnull(item.addr);
+    debug_assert(item.type.size == self->items.type.size);
+
+    try_(SmallArrList_ensureUnusedCap(self, 1));
+    bti_memcpy(SmallArrList_at(self, self->items.len), item.addr, item.type.size);
+    self->items.len += 1;
+    return_ok({});
+} unscoped;
+
+fn_scope(SmallArrList_appendSli(SmallArrList* self, meta_Sli items), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert(items.type.size == self->items.type.size);
+
+    try_(SmallArrList_ensureUnusedCap(self, items.len));
+    bti_memcpy(SmallArrList_at(self, self->items.len), items.addr, items.len * items.type.size);
+    self->items.len += items.len;
+    return_ok({});
+} unscoped;
+
+fn_scope(SmallArrList_addBackOne(SmallArrList* self), mem_Allocator_Err$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    try_(SmallArrList_ensureUnusedCap(self, 1));
+    self->items.len += 1;
+    return_ok((meta_Ptr){
+        .addr = SmallArrList_at(self, self->items.len - 1),
+        .type = self->items.type,
+    });
+} unscoped;
+
+fn_scope(SmallArrList_insert(SmallArrList* self, usize index, meta_Ptr item), mem_Allocator_Err$void) {
+    debug_assert_nonnull(self);
+    debug_assert(index <= self->items.len);
+    debug_assert(item.type.size == self->items.type.size);
+
+    try_(SmallArrList_ensureUnusedCap(self, 1));
+    let size = self->items.type.size;
+    if (index < self->items.len) {
+        bti_memmove(SmallArrList_at(self, index + 1), SmallArrList_at(self, index), (self->items.len - index) * size);
+    }
+    bti_memcpy(SmallArrList_at(self, index), item.addr, size);
+    self->items.len += 1;
+    return_ok({});
+} unscoped;
+
+fn_scope(SmallArrList_popOrNull(SmallArrList* self), Opt$meta_Ptr) {
+    debug_assert_nonnull(self);
+
+    if (self->items.len == 0) {
+        return_none();
+    }
+    self->items.len -= 1;
+    return_some((meta_Ptr){
+        .addr = SmallArrList_at(self, self->items.len),
+        .type = self->items.type,
+    });
+} unscoped;
+
+fn_(SmallArrList_removeOrdered(SmallArrList* self, usize index), meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert(index < self->items.len);
+
+    // Rotate the removed item to just past the new end, where it stays readable
+    let size    = self->items.type.size;
+    let last    = self->items.len - 1;
+    let removed = bti_alloca(size);
+    bti_memcpy(removed, SmallArrList_at(self, index), size);
+    bti_memmove(SmallArrList_at(self, index), SmallArrList_at(self, index + 1), (last - index) * size);
+    bti_memcpy(SmallArrList_at(self, last), removed, size);
+    self->items.len = last;
+    return (meta_Ptr){ .addr = SmallArrList_at(self, last), .type = self->items.type };
+}
+
+fn_(SmallArrList_removeSwap(SmallArrList* self, usize index), meta_Ptr) {
+    debug_assert_nonnull(self);
+    debug_assert(index < self->items.len);
+
+    // Swap with the last item, the removed item stays readable just past the new end
+    let size = self->items.type.size;
+    let last = self->items.len - 1;
+    if (index != last) {
+        let temp = bti_alloca(size);
+        bti_memcpy(temp, SmallArrList_at(self, index), size);
+        bti_memcpy(SmallArrList_at(self, index), SmallArrList_at(self, last), size);
+        bti_memcpy(SmallArrList_at(self, last), temp, size);
+    }
+    self->items.len = last;
+    return (meta_Ptr){ .addr = SmallArrList_at(self, last), .type = self->items.type };
+}
+
+fn_(SmallArrList_clearRetainingCap(SmallArrList* self), void) {
+    debug_assert_nonnull(self);
+    self->items.len = 0;
+}
+
+fn_(SmallArrList_clearAndFree(SmallArrList* self), void) {
+    debug_assert_nonnull(self);
+
+    SmallArrList_freeSpilled(self);
+    SmallArrList_init(self, self->items.type, self->inline_cap, self->allocator);
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+/// Inline storage starts after the list structure, aligned for the elements
+static fn_(SmallArrList_inlineItems(SmallArrList* self), anyptr) {
+    return as$(u8*, self) + mem_alignForward(sizeOf$(SmallArrList), self->items.type.align);
+}
+
+static fn_(SmallArrList_freeSpilled(SmallArrList* self), void) {
+    if (SmallArrList_isInline(self)) { return; }
+    let actual_mem = (meta_Sli){ .type = self->items.type, .addr = self->items.addr, .len = self->cap };
+    mem_Allocator_free(self->allocator, meta_sliToAny(actual_mem));
+}
+
+static fn_(SmallArrList_at(const SmallArrList* self, usize index), u8*) {
+    return as$(u8*, self->items.addr) + index * self->items.type.size;
+}
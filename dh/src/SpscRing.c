@@ -0,0 +1,125 @@
+#include "dh/SpscRing.h"
+#include "dh/debug/assert.h"
+#include "dh/int.h"
+
+// Internal helper functions
+static fn_(SpscRing_slotsAt(const SpscRing* self, usize pos, usize len), meta_Sli);
+
+/*========== Implementation =================================================*/
+
+fn_scope(SpscRing_init(TypeInfo type, usize cap, mem_Allocator allocator), mem_Allocator_Err$SpscRing) {
+    debug_assert_fmt(0 < type.size, "Type size must be greater than 0");
+    debug_assert_nonnull_fmt(allocator.ptr, "Allocator context cannot be null");
+    debug_assert_nonnull_fmt(allocator.vt, "Allocator vtable cannot be null");
+
+    let cap_pow2 = usize_chkdNextPow2(prim_max(cap, as$(usize, 2)));
+    if_none(cap_pow2) { return_err(mem_Allocator_Err_OutOfMemory()); }
+
+    var ring = (SpscRing){
+        .tail_cached = 0,
+        .head_cached = 0,
+        .type        = type,
+        .mask        = cap_pow2.value - 1,
+        .items       = null,
+        .allocator   = allocator,
+    };
+    atomic_init(ring.head, 0);
+    atomic_init(ring.tail, 0);
+    ring.items = try_(mem_Allocator_alloc(allocator, type, cap_pow2.value)).addr;
+    return_ok(ring);
+} unscoped;
+
+fn_(SpscRing_fini(SpscRing* self), void) {
+    debug_assert_nonnull(self);
+    mem_Allocator_free(self->allocator, meta_sliToAny(SpscRing_slotsAt(self, 0, self->mask + 1)));
+}
+
+fn_(SpscRing_cap(const SpscRing* self), usize) {
+    debug_assert_nonnull(self);
+    return self->mask + 1;
+}
+
+fn_(SpscRing_lenApprox(const SpscRing* self), usize) {
+    debug_assert_nonnull(self);
+
+    let tail = atomic_load$(usize, as$(volatile usize*, &self->tail.raw), atomic_MemOrd_acquire);
+    let head = atomic_load$(usize, as$(volatile usize*, &self->head.raw), atomic_MemOrd_acquire);
+    return prim_min(head - tail, self->mask + 1);
+}
+
+fn_(SpscRing_reserve(SpscRing* self, usize n), meta_Sli) {
+    debug_assert_nonnull(self);
+
+    // Only the producer stores head, so its own index needs no ordering
+    let head = atomic_load(self->head, atomic_MemOrd_monotonic);
+    var free = self->mask + 1 - (head - self->tail_cached);
+    if (free < n) {
+        // Cached tail is stale: pay for one cross-core read and refresh it
+        self->tail_cached = atomic_load(self->tail, atomic_MemOrd_acquire);
+        free              = self->mask + 1 - (head - self->tail_cached);
+    }
+    let until_wrap = self->mask + 1 - (head & self->mask);
+    return SpscRing_slotsAt(self, head, prim_min(prim_min(n, free), until_wrap));
+}
+
+fn_(SpscRing_commit(SpscRing* self, usize n), void) {
+    debug_assert_nonnull(self);
+
+    let head = atomic_load(self->head, atomic_MemOrd_monotonic);
+    debug_assert_fmt(head + n - self->tail_cached <= self->mask + 1, "Committed more slots than were reserved");
+    atomic_store(self->head, head + n, atomic_MemOrd_release);
+}
+
+fn_(SpscRing_tryPush(SpscRing* self, meta_Ptr item), bool) {
+    debug_assert_fmt(item.type.size == self->type.size, "Item type mismatch");
+
+    let slots = SpscRing_reserve(self, 1);
+    if (slots.len == 0) { return false; }
+    bti_memcpy(slots.addr, item.addr, self->type.size);
+    SpscRing_commit(self, 1);
+    return true;
+}
+
+fn_(SpscRing_peek(SpscRing* self, usize n), meta_Sli) {
+    debug_assert_nonnull(self);
+
+    // Only the consumer stores tail, so its own index needs no ordering
+    let tail  = atomic_load(self->tail, atomic_MemOrd_monotonic);
+    var avail = self->head_cached - tail;
+    if (avail < n) {
+        // Cached head is stale: pay for one cross-core read and refresh it
+        self->head_cached = atomic_load(self->head, atomic_MemOrd_acquire);
+        avail             = self->head_cached - tail;
+    }
+    let until_wrap = self->mask + 1 - (tail & self->mask);
+    return SpscRing_slotsAt(self, tail, prim_min(prim_min(n, avail), until_wrap));
+}
+
+fn_(SpscRing_consume(SpscRing* self, usize n), void) {
+    debug_assert_nonnull(self);
+
+    let tail = atomic_load(self->tail, atomic_MemOrd_monotonic);
+    debug_assert_fmt(n <= self->head_cached - tail, "Consumed more items than were peeked");
+    atomic_store(self->tail, tail + n, atomic_MemOrd_release);
+}
+
+fn_(SpscRing_tryPop(SpscRing* self, meta_Ptr out), bool) {
+    debug_assert_nonnull(out.addr);
+    debug_assert_fmt(out.type.size == self->type.size, "Item type mismatch");
+
+    let items = SpscRing_peek(self, 1);
+    if (items.len == 0) { return false; }
+    bti_memcpy(out.addr, items.addr, self->type.size);
+    SpscRing_consume(self, 1);
+    return true;
+}
+
+/*========== Internal Helper Functions ======================================*/
+
+static fn_(SpscRing_slotsAt(const SpscRing* self, usize pos, usize len), meta_Sli) {
+    return (meta_Sli){
+        .type = self->type,
+        .addr = self->items + (pos & self->mask) * self->type.size,
+        .len  = len,
+    };
+}
@@ -1,4 +1,5 @@
 #include "dh/heap/Arena.h"
+#include "dh/heap/Page.h"
 #include "dh/mem/common.h"
 #include "dh/meta/common.h"
 #include "dh/opt.h"
@@ -10,6 +11,13 @@ static fn_(heap_Arena_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
 static fn_(heap_Arena_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
 static fn_(heap_Arena_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
 static fn_(heap_Arena_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+static fn_(heap_Arena_allocMany(anyptr ctx, usize len, u32 align, Sli$Ptr$u8 out), bool);
+static fn_(heap_Arena_freeMany(anyptr ctx, Sli$Ptr$u8 bufs, usize len, u32 align), void);
+
+static fn_(heap_Arena_ThrdSafe_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Arena_ThrdSafe_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Arena_ThrdSafe_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Arena_ThrdSafe_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
 
 // Internal helper functions
 static fn_(heap_Arena_createNode(heap_Arena* self, usize prev_len, usize minimum_size), Opt$Ptr$ListSgl_Node$usize);
@@ -22,14 +30,24 @@ extern fn_(heap_Arena_State_promote(heap_Arena_State* self, mem_Allocator child_
     };
 }
 
+extern fn_(heap_Arena_State_mark(const heap_Arena_State* self), heap_Arena_Mark) {
+    debug_assert_nonnull(self);
+    return (heap_Arena_Mark){
+        .node      = self->buffer_list.first,
+        .end_index = self->end_index,
+    };
+}
+
 extern fn_(heap_Arena_allocator(heap_Arena* self), mem_Allocator) {
     debug_assert_nonnull(self);
     /* VTable for Arena allocator */
     static const mem_Allocator_VT vt[1] = { {
-        .alloc  = heap_Arena_alloc,
-        .resize = heap_Arena_resize,
-        .remap  = heap_Arena_remap,
-        .free   = heap_Arena_free,
+        .alloc     = heap_Arena_alloc,
+        .resize    = heap_Arena_resize,
+        .remap     = heap_Arena_remap,
+        .free      = heap_Arena_free,
+        .allocMany = heap_Arena_allocMany,
+        .freeMany  = heap_Arena_freeMany,
     } };
     return (mem_Allocator){
         .ptr = self,
@@ -148,6 +166,174 @@ extern fn_scope(heap_Arena_reset(heap_Arena* self, heap_Arena_ResetMode mode), b
     return_(true);
 } unscoped;
 
+extern fn_(heap_Arena_mark(const heap_Arena* self), heap_Arena_Mark) {
+    debug_assert_nonnull(self);
+    return heap_Arena_State_mark(&self->state);
+}
+
+extern fn_(heap_Arena_restore(heap_Arena* self, heap_Arena_Mark mark), void) {
+    debug_assert_nonnull(self);
+
+    // Free buffers acquired after the savepoint (they sit in front of the marked one)
+    while (isSome(self->state.buffer_list.first)) {
+        let node = unwrap(self->state.buffer_list.first);
+        if (isSome(mark.node) && unwrap(mark.node) == node) { break; }
+        self->state.buffer_list.first = node->next;
+        let alloc_buf                 = Sli_from$(Sli$u8, as$(u8*, node), *node->data);
+        mem_Allocator_rawFree(self->child_allocator, alloc_buf, alignOf(ListSgl_Node$usize));
+    }
+    debug_assert_fmt(isSome(mark.node) == isSome(self->state.buffer_list.first), "Savepoint does not belong to this arena");
+    self->state.end_index = mark.end_index;
+}
+
+/*========== Scratch Arenas =================================================*/
+
+/// Scratch arenas of calling thread (two, so one can hold results while the other holds temporaries)
+static $thread_local heap_Arena heap_Arena_s_scratch[2]     = {};
+static $thread_local bool       heap_Arena_s_scratch_inited = false;
+static heap_Page                heap_Arena_s_scratch_page   = {};
+
+extern fn_(heap_Arena_scratchBegin(anyptr_const conflict), heap_Arena_Scratch) {
+    if (!heap_Arena_s_scratch_inited) {
+        let child_allocator         = heap_Page_allocator(&heap_Arena_s_scratch_page);
+        heap_Arena_s_scratch[0]     = heap_Arena_init(child_allocator);
+        heap_Arena_s_scratch[1]     = heap_Arena_init(child_allocator);
+        heap_Arena_s_scratch_inited = true;
+    }
+    let arena = &heap_Arena_s_scratch[conflict == as$(anyptr_const, &heap_Arena_s_scratch[0]) ? 1 : 0];
+    return (heap_Arena_Scratch){
+        .arena = arena,
+        .mark  = heap_Arena_mark(arena),
+    };
+}
+
+extern fn_(heap_Arena_scratchEnd(heap_Arena_Scratch scratch), void) {
+    debug_assert_nonnull(scratch.arena);
+    heap_Arena_restore(scratch.arena, scratch.mark);
+}
+
+extern fn_(heap_Arena_Scratch_allocator(heap_Arena_Scratch scratch), mem_Allocator) {
+    return heap_Arena_allocator(scratch.arena);
+}
+
+extern fn_(heap_Arena_scratchFini(void), void) {
+    if (!heap_Arena_s_scratch_inited) { return; }
+    heap_Arena_fini(heap_Arena_s_scratch[0]);
+    heap_Arena_fini(heap_Arena_s_scratch[1]);
+    heap_Arena_s_scratch_inited = false;
+}
+
+/*========== Thread-Safe Arena ==============================================*/
+
+extern fn_(heap_Arena_ThrdSafe_allocator(heap_Arena_ThrdSafe* self), mem_Allocator) {
+    debug_assert_nonnull(self);
+    /* VTable for thread-safe Arena allocator */
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc  = heap_Arena_ThrdSafe_alloc,
+        .resize = heap_Arena_ThrdSafe_resize,
+        .remap  = heap_Arena_ThrdSafe_remap,
+        .free   = heap_Arena_ThrdSafe_free,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt
+    };
+}
+
+extern fn_(heap_Arena_ThrdSafe_init(mem_Allocator child_allocator), heap_Arena_ThrdSafe) {
+    return (heap_Arena_ThrdSafe){
+        .child_allocator = child_allocator,
+        .current         = { .raw = 0 },
+    };
+}
+
+extern fn_(heap_Arena_ThrdSafe_fini(heap_Arena_ThrdSafe self), void) {
+    var chunk = intToRawptr$(heap_Arena_ThrdSafe_Chunk*, atomic_load(self.current, atomic_MemOrd_acquire));
+    while (chunk != null) {
+        let next      = chunk->next;
+        let alloc_buf = Sli_from$(Sli$u8, as$(u8*, chunk), chunk->len);
+        mem_Allocator_rawFree(self.child_allocator, alloc_buf, alignOf(heap_Arena_ThrdSafe_Chunk));
+        chunk = next;
+    }
+}
+
+extern fn_(heap_Arena_ThrdSafe_queryCap(const heap_Arena_ThrdSafe* self), usize) {
+    debug_assert_nonnull(self);
+    usize size  = 0;
+    var   chunk = intToRawptr$(heap_Arena_ThrdSafe_Chunk*, atomic_load(as$(heap_Arena_ThrdSafe*, self)->current, atomic_MemOrd_acquire));
+    while (chunk != null) {
+        size += chunk->len - sizeOf(heap_Arena_ThrdSafe_Chunk);
+        chunk = chunk->next;
+    }
+    return size;
+}
+
+extern fn_(heap_Arena_ThrdSafe_reset(heap_Arena_ThrdSafe* self), void) {
+    debug_assert_nonnull(self);
+    heap_Arena_ThrdSafe_fini(*self);
+    atomic_store(self->current, 0, atomic_MemOrd_release);
+}
+
+static fn_scope(heap_Arena_ThrdSafe_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Arena_ThrdSafe*, ctx);
+    // Reserve worst-case padding so a single fetch-add claims an aligned range
+    let reserve_len = len + align - 1;
+
+    while (true) {
+        let   chunk_addr = atomic_load(self->current, atomic_MemOrd_acquire);
+        let   chunk      = intToRawptr$(heap_Arena_ThrdSafe_Chunk*, chunk_addr);
+        usize prev_cap   = 0;
+        if (chunk != null) {
+            let cap   = chunk->len - sizeOf(heap_Arena_ThrdSafe_Chunk);
+            let start = atomic_fetchAdd$(usize, &chunk->end_index.raw, reserve_len, atomic_MemOrd_monotonic);
+            if (start <= cap && reserve_len <= cap - start) {
+                let addr = chunk_addr + sizeOf(heap_Arena_ThrdSafe_Chunk) + start;
+                return_some(intToRawptr$(u8*, mem_alignForward(addr, align)));
+            }
+            prev_cap = cap;
+        }
+
+        // Buffer is full: chain a new one in front, losers of the race give theirs back
+        let big_enough_len = prev_cap + reserve_len + sizeOf(heap_Arena_ThrdSafe_Chunk) + 16;
+        let new_len        = big_enough_len + big_enough_len / 2;
+        let new_ptr        = orelse(mem_Allocator_rawAlloc(self->child_allocator, new_len, alignOf(heap_Arena_ThrdSafe_Chunk)), eval({ return_none(); }));
+        let new_chunk      = as$(heap_Arena_ThrdSafe_Chunk*, new_ptr);
+        new_chunk->next    = chunk;
+        new_chunk->len     = new_len;
+        atomic_init(new_chunk->end_index, 0);
+
+        var expected = chunk_addr;
+        if (!atomic_cmpxchgStrong$(usize, &self->current.raw, &expected, rawptrToInt(new_chunk), atomic_MemOrd_acq_rel, atomic_MemOrd_acquire)) {
+            mem_Allocator_rawFree(self->child_allocator, Sli_from$(Sli$u8, new_ptr, new_len), alignOf(heap_Arena_ThrdSafe_Chunk));
+        }
+    }
+} unscoped;
+
+static fn_(heap_Arena_ThrdSafe_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+    $unused(ctx, buf_align);
+    // Reserved ranges cannot be extended safely while other threads bump, only shrink
+    return new_size <= buf.len;
+}
+
+static fn_scope(heap_Arena_ThrdSafe_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    if (heap_Arena_ThrdSafe_resize(ctx, buf, buf_align, new_size)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} unscoped;
+
+static fn_(heap_Arena_ThrdSafe_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+    // Memory is released all together by reset/fini
+    $unused(ctx, buf, buf_align);
+}
+
 /*========== Allocator Interface Implementation =============================*/
 
 static fn_scope(heap_Arena_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
@@ -254,6 +440,51 @@ static fn_(heap_Arena_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
     }
 }
 
+static fn_(heap_Arena_allocMany(anyptr ctx, usize len, u32 align, Sli$Ptr$u8 out), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    if (out.len == 0) { return true; }
+
+    // Carve whole batch from a single bump allocation
+    let stride = mem_alignForward(len, align);
+    if (stride != 0 && (usize_limit_max - len) / stride < out.len - 1) { return false; }
+    let base = orelse(heap_Arena_alloc(ctx, stride * (out.len - 1) + len, align), eval({ return false; }));
+    for (usize i = 0; i < out.len; ++i) {
+        out.ptr[i] = base + i * stride;
+    }
+    return true;
+}
+
+static fn_(heap_Arena_freeMany(anyptr ctx, Sli$Ptr$u8 bufs, usize len, u32 align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self = (heap_Arena*)ctx;
+    if (bufs.len == 0) { return; }
+    if_none(self->state.buffer_list.first) {
+        return;
+    }
+    let cur_node = unwrap(self->state.buffer_list.first);
+    let cur_buf  = (u8*)cur_node + sizeof(ListSgl_Node$usize);
+
+    // Batch carved by allocMany as the most recent allocation, given back with the padding between items
+    let stride = mem_alignForward(len, align);
+    let first  = bufs.ptr[0];
+    var carved = cur_buf <= first && cur_buf + self->state.end_index == bufs.ptr[bufs.len - 1] + len;
+    for (usize i = 1; carved && i < bufs.len; ++i) {
+        carved = bufs.ptr[i] == first + i * stride;
+    }
+    if (carved) {
+        self->state.end_index = as$(usize, first - cur_buf);
+        return;
+    }
+    // Otherwise newest first, so unpadded buffers at the end of the arena are given back
+    for (usize i = bufs.len; 0 < i; --i) {
+        heap_Arena_free(ctx, Sli_from$(Sli$u8, bufs.ptr[i - 1], len), align);
+    }
+}
+
 /*========== Internal Helper Functions =====================================*/
 
 static fn_scope(heap_Arena_createNode(heap_Arena* self, usize prev_len, usize minimum_size), Opt$Ptr$ListSgl_Node$usize) {
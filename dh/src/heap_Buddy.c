@@ -0,0 +1,277 @@
+#include "dh/heap/Buddy.h"
+#include "dh/mem/common.h"
+#include "dh/debug.h"
+
+// Forward declarations for allocator vtable functions
+static fn_(heap_Buddy_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Buddy_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Buddy_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Buddy_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+
+/*========== Internal Types =================================================*/
+
+struct heap_Buddy_Block {
+    heap_Buddy_Block* prev;
+    heap_Buddy_Block* next;
+    usize             order;
+};
+
+// Internal helper functions
+static fn_(heap_Buddy_orderFor(const heap_Buddy* self, usize len, u32 align), usize);
+static fn_(heap_Buddy_blockSize(usize order), usize);
+static fn_(heap_Buddy_blockAt(const heap_Buddy* self, usize offset), heap_Buddy_Block*);
+static fn_(heap_Buddy_isFreeAt(const heap_Buddy* self, usize offset), bool);
+static fn_(heap_Buddy_pushFree(heap_Buddy* self, usize offset, usize order), void);
+static fn_(heap_Buddy_removeFree(heap_Buddy* self, heap_Buddy_Block* block), void);
+static fn_(heap_Buddy_isFreeBuddy(const heap_Buddy* self, usize offset, usize order), bool);
+
+extern fn_(heap_Buddy_allocator(heap_Buddy* self), mem_Allocator) {
+    debug_assert_nonnull(self);
+    /* VTable for Buddy allocator */
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc  = heap_Buddy_alloc,
+        .resize = heap_Buddy_resize,
+        .remap  = heap_Buddy_remap,
+        .free   = heap_Buddy_free,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt
+    };
+}
+
+extern fn_(heap_Buddy_init(Sli$u8 buf), heap_Buddy) {
+    debug_assert_nonnull(buf.ptr);
+
+    let buf_start = rawptrToInt(buf.ptr);
+    let buf_end   = buf_start + buf.len;
+    let start     = prim_min(mem_alignForward(buf_start, heap_Buddy_min_block_size), buf_end);
+    let avail     = buf_end - start;
+
+    // Every 8 blocks cost one bitmap byte: fit as many blocks as possible with their bits
+    let group_size  = 8 * heap_Buddy_min_block_size + 1;
+    let groups      = avail / group_size;
+    let rest        = avail % group_size;
+    let extra       = heap_Buddy_min_block_size < rest ? (rest - 1) / heap_Buddy_min_block_size : 0;
+    let block_count = groups * 8 + extra;
+    let map_len     = groups + (0 < extra ? 1 : 0);
+    let managed_len = block_count * heap_Buddy_min_block_size;
+
+    var self = (heap_Buddy){
+        .buffer   = Sli_from$(Sli$u8, intToRawptr$(u8*, start), managed_len),
+        .free_map = Sli_from$(Sli$u8, intToRawptr$(u8*, start + managed_len), map_len),
+    };
+    heap_Buddy_reset(&self);
+    return self;
+}
+
+extern fn_(heap_Buddy_reset(heap_Buddy* self), void) {
+    debug_assert_nonnull(self);
+
+    bti_memset(self->free_map.ptr, 0, self->free_map.len);
+    for (usize order = 0; order < heap_Buddy_order_count; ++order) {
+        self->free_lists[order] = null;
+    }
+    self->used_len      = 0;
+    self->requested_len = 0;
+    self->alloc_count   = 0;
+
+    // Cover region with largest blocks first, so every offset stays aligned to its block size
+    var offset = as$(usize, 0);
+    while (offset < self->buffer.len) {
+        let remaining = self->buffer.len - offset;
+        let log2      = as$(usize, (sizeOf(u64) * 8 - 1) - __builtin_clzll(as$(u64, remaining)));
+        let order     = prim_min(log2 - heap_Buddy_min_block_log2, as$(usize, heap_Buddy_order_count - 1));
+        heap_Buddy_pushFree(self, offset, order);
+        offset += heap_Buddy_blockSize(order);
+    }
+}
+
+extern fn_(heap_Buddy_ownsPtr(const heap_Buddy* self, Ptr_const$u8 ptr), bool) {
+    debug_assert_nonnull(self);
+    let start = rawptrToInt(self->buffer.ptr);
+    let addr  = rawptrToInt(ptr);
+    return start <= addr && addr < start + self->buffer.len;
+}
+
+extern fn_(heap_Buddy_queryStats(const heap_Buddy* self), heap_Buddy_Stats) {
+    debug_assert_nonnull(self);
+
+    var stats = (heap_Buddy_Stats){
+        .capacity      = self->buffer.len,
+        .used_len      = self->used_len,
+        .requested_len = self->requested_len,
+        .free_len      = self->buffer.len - self->used_len,
+        .alloc_count   = self->alloc_count,
+    };
+    for (usize order = 0; order < heap_Buddy_order_count; ++order) {
+        for (var block = self->free_lists[order]; block != null; block = block->next) {
+            stats.largest_free_len = heap_Buddy_blockSize(order);
+            stats.free_block_count += 1;
+        }
+    }
+    return stats;
+}
+
+/*========== Allocator Interface Implementation =============================*/
+
+static fn_scope(heap_Buddy_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self  = as$(heap_Buddy*, ctx);
+    let order = heap_Buddy_orderFor(self, len, align);
+    if (heap_Buddy_order_count <= order) { return_none(); }
+
+    // Find smallest free block that fits
+    var found = order;
+    while (found < heap_Buddy_order_count && self->free_lists[found] == null) { found += 1; }
+    if (heap_Buddy_order_count <= found) { return_none(); }
+
+    let block  = self->free_lists[found];
+    let offset = rawptrToInt(block) - rawptrToInt(self->buffer.ptr);
+    heap_Buddy_removeFree(self, block);
+
+    // Split down to requested order, returning upper halves to free lists
+    while (order < found) {
+        found -= 1;
+        heap_Buddy_pushFree(self, offset + heap_Buddy_blockSize(found), found);
+    }
+
+    self->used_len += heap_Buddy_blockSize(order);
+    self->requested_len += len;
+    self->alloc_count += 1;
+    return_some(self->buffer.ptr + offset);
+} unscoped;
+
+static fn_(heap_Buddy_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Buddy*, ctx);
+    debug_assert_fmt(heap_Buddy_ownsPtr(self, buf.ptr), "Buffer not owned by this allocator");
+
+    let offset    = as$(usize, buf.ptr - self->buffer.ptr);
+    let order     = heap_Buddy_orderFor(self, buf.len, buf_align);
+    let new_order = heap_Buddy_orderFor(self, new_size, buf_align);
+    if (heap_Buddy_order_count <= new_order) { return false; }
+
+    if (new_order < order) {
+        // Shrink: release upper halves (their buddies are still allocated, so no merging)
+        for (usize split = order; new_order < split;) {
+            split -= 1;
+            heap_Buddy_pushFree(self, offset + heap_Buddy_blockSize(split), split);
+        }
+    } else if (order < new_order) {
+        // Grow: possible only while block is the lower buddy and each upper buddy is free
+        for (usize merge = order; merge < new_order; ++merge) {
+            if ((offset & heap_Buddy_blockSize(merge)) != 0) { return false; }
+            if (!heap_Buddy_isFreeBuddy(self, offset + heap_Buddy_blockSize(merge), merge)) { return false; }
+        }
+        for (usize merge = order; merge < new_order; ++merge) {
+            heap_Buddy_removeFree(self, heap_Buddy_blockAt(self, offset + heap_Buddy_blockSize(merge)));
+        }
+    }
+
+    self->used_len      = self->used_len - heap_Buddy_blockSize(order) + heap_Buddy_blockSize(new_order);
+    self->requested_len = self->requested_len - buf.len + new_size;
+    return true;
+}
+
+static fn_scope(heap_Buddy_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    if (heap_Buddy_resize(ctx, buf, buf_align, new_size)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} unscoped;
+
+static fn_(heap_Buddy_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Buddy*, ctx);
+    debug_assert_fmt(heap_Buddy_ownsPtr(self, buf.ptr), "Buffer not owned by this allocator");
+
+    var offset = as$(usize, buf.ptr - self->buffer.ptr);
+    var order  = heap_Buddy_orderFor(self, buf.len, buf_align);
+    debug_assert_fmt(!heap_Buddy_isFreeAt(self, offset), "Double free detected");
+
+    self->used_len -= heap_Buddy_blockSize(order);
+    self->requested_len -= buf.len;
+    self->alloc_count -= 1;
+
+    // Merge with buddy while it is free and of the same order
+    while (order + 1 < heap_Buddy_order_count) {
+        let buddy_offset = offset ^ heap_Buddy_blockSize(order);
+        if (!heap_Buddy_isFreeBuddy(self, buddy_offset, order)) { break; }
+        heap_Buddy_removeFree(self, heap_Buddy_blockAt(self, buddy_offset));
+        offset = prim_min(offset, buddy_offset);
+        order += 1;
+    }
+    heap_Buddy_pushFree(self, offset, order);
+}
+
+/*========== Internal Helper Functions =====================================*/
+
+/// Order of block serving request, or order_count if it can never be served
+static fn_(heap_Buddy_orderFor(const heap_Buddy* self, usize len, u32 align), usize) {
+    // Blocks are aligned to their size relative to region start, which itself is only so aligned
+    let start_addr = rawptrToInt(self->buffer.ptr);
+    if (start_addr != 0 && (start_addr & (~start_addr + 1)) < align) { return heap_Buddy_order_count; }
+    if (self->buffer.len < len) { return heap_Buddy_order_count; }
+
+    let size = prim_max(prim_max(len, as$(usize, align)), heap_Buddy_min_block_size);
+    // Round up to power of two
+    let size_log2 = as$(usize, (sizeOf(u64) * 8) - __builtin_clzll(as$(u64, size - 1)));
+    if (sizeOf(usize) * 8 <= size_log2) { return heap_Buddy_order_count; }
+    return prim_min(size_log2 - heap_Buddy_min_block_log2, as$(usize, heap_Buddy_order_count));
+}
+
+static fn_(heap_Buddy_blockSize(usize order), usize) {
+    return heap_Buddy_min_block_size << order;
+}
+
+static fn_(heap_Buddy_blockAt(const heap_Buddy* self, usize offset), heap_Buddy_Block*) {
+    return as$(heap_Buddy_Block*, self->buffer.ptr + offset);
+}
+
+static fn_(heap_Buddy_isFreeAt(const heap_Buddy* self, usize offset), bool) {
+    let index = offset >> heap_Buddy_min_block_log2;
+    return (self->free_map.ptr[index / 8] & (1u << (index % 8))) != 0;
+}
+
+static fn_(heap_Buddy_pushFree(heap_Buddy* self, usize offset, usize order), void) {
+    let index = offset >> heap_Buddy_min_block_log2;
+    self->free_map.ptr[index / 8] |= as$(u8, 1u << (index % 8));
+
+    let block    = heap_Buddy_blockAt(self, offset);
+    let head     = self->free_lists[order];
+    block->prev  = null;
+    block->next  = head;
+    block->order = order;
+    if (head != null) { head->prev = block; }
+    self->free_lists[order] = block;
+}
+
+static fn_(heap_Buddy_removeFree(heap_Buddy* self, heap_Buddy_Block* block), void) {
+    let offset = rawptrToInt(block) - rawptrToInt(self->buffer.ptr);
+    let index  = offset >> heap_Buddy_min_block_log2;
+    self->free_map.ptr[index / 8] &= as$(u8, ~(1u << (index % 8)));
+
+    if (block->prev != null) {
+        block->prev->next = block->next;
+    } else {
+        self->free_lists[block->order] = block->next;
+    }
+    if (block->next != null) { block->next->prev = block->prev; }
+}
+
+/// Check that a whole free block of given order starts at offset
+static fn_(heap_Buddy_isFreeBuddy(const heap_Buddy* self, usize offset, usize order), bool) {
+    if (self->buffer.len < offset + heap_Buddy_blockSize(order)) { return false; }
+    if (!heap_Buddy_isFreeAt(self, offset)) { return false; }
+    return heap_Buddy_blockAt(self, offset)->order == order;
+}
@@ -0,0 +1,207 @@
+#include "dh/heap/Gpa.h"
+#include "dh/heap/Page.h"
+#include "dh/mem/common.h"
+#include "dh/atomic.h"
+#include "dh/debug.h"
+
+// Forward declarations for allocator vtable functions
+static fn_(heap_Gpa_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Gpa_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Gpa_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Gpa_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+
+/*========== Internal Types and State =======================================*/
+
+/// Free block header (stored in-place inside each free block)
+typedef struct heap_Gpa_FreeBlock heap_Gpa_FreeBlock;
+struct heap_Gpa_FreeBlock {
+    heap_Gpa_FreeBlock* next;
+};
+
+/// Per-thread cache of free lists and bump ranges for each size class
+typedef struct $align(atomic_cache_line) heap_Gpa_Cache {
+    atomic_Value$(bool) locked;
+    heap_Gpa_FreeBlock* free_lists[heap_Gpa_size_class_count];
+    usize               next_addrs[heap_Gpa_size_class_count]; ///< Next unused block in current span
+    usize               end_addrs[heap_Gpa_size_class_count];  ///< End of current span
+} heap_Gpa_Cache;
+
+static heap_Gpa_Cache     heap_Gpa_s_caches[heap_Gpa_cache_count] = {};
+static heap_Page          heap_Gpa_s_page                         = {};
+static atomic_Value$(u32) heap_Gpa_s_next_cache_index             = {};
+/// Index of cache last used by this thread (plus one, zero means unassigned)
+static $thread_local u32  heap_Gpa_s_thrd_cache_index             = 0;
+
+// Internal helper functions
+static fn_(heap_Gpa_classIndex(usize len, u32 align), usize);
+static fn_(heap_Gpa_classSize(usize class_index), usize);
+static fn_(heap_Gpa_lockCache(void), heap_Gpa_Cache*);
+static fn_(heap_Gpa_unlockCache(heap_Gpa_Cache* cache), void);
+static fn_(heap_Gpa_recycleRange(heap_Gpa_Cache* cache, usize addr, usize end), void);
+static fn_(heap_Gpa_pageAllocator(void), mem_Allocator);
+
+extern fn_(heap_Gpa_allocator(heap_Gpa* self), mem_Allocator) {
+    /* VTable for general purpose allocator */
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc  = heap_Gpa_alloc,
+        .resize = heap_Gpa_resize,
+        .remap  = heap_Gpa_remap,
+        .free   = heap_Gpa_free,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt,
+    };
+}
+
+/*========== Allocator Interface Implementation =============================*/
+
+static fn_scope(heap_Gpa_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+    $unused(ctx);
+
+    let class_index = heap_Gpa_classIndex(len, align);
+    if (heap_Gpa_size_class_count <= class_index) {
+        // Large object passthrough
+        let page = heap_Gpa_pageAllocator();
+        return_(page.vt->alloc(page.ptr, len, align));
+    }
+
+    let cache = heap_Gpa_lockCache();
+    // Reuse a freed block of the same class first
+    if (cache->free_lists[class_index] != null) {
+        let block                      = cache->free_lists[class_index];
+        cache->free_lists[class_index] = block->next;
+        heap_Gpa_unlockCache(cache);
+        return_some(as$(u8*, block));
+    }
+
+    // Bump from current span, or take a new span when exhausted
+    let class_size = heap_Gpa_classSize(class_index);
+    if (cache->end_addrs[class_index] < cache->next_addrs[class_index] + class_size) {
+        let page = heap_Gpa_pageAllocator();
+        let span = page.vt->alloc(page.ptr, heap_Gpa_span_size, as$(u32, mem_page_size));
+        if_none(span) {
+            heap_Gpa_unlockCache(cache);
+            return_none();
+        }
+        // Tail of the old span is too short for this class, but smaller classes can still use it
+        heap_Gpa_recycleRange(cache, cache->next_addrs[class_index], cache->end_addrs[class_index]);
+        // Spans are only page aligned, so skip ahead to the first block aligned to the class size
+        let span_addr   = rawptrToInt(unwrap(span));
+        let first_block = mem_alignForward(span_addr, class_size);
+        heap_Gpa_recycleRange(cache, span_addr, first_block);
+        cache->next_addrs[class_index] = first_block;
+        cache->end_addrs[class_index]  = span_addr + heap_Gpa_span_size;
+    }
+    let addr = cache->next_addrs[class_index];
+    cache->next_addrs[class_index] += class_size;
+    heap_Gpa_unlockCache(cache);
+    return_some(intToRawptr$(u8*, addr));
+} unscoped;
+
+static fn_(heap_Gpa_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+    $unused(ctx);
+
+    let class_index     = heap_Gpa_classIndex(buf.len, buf_align);
+    let new_class_index = heap_Gpa_classIndex(new_size, buf_align);
+    if (heap_Gpa_size_class_count <= class_index) {
+        // Large objects may only stay large, otherwise free would pick the wrong path
+        if (new_class_index < heap_Gpa_size_class_count) { return false; }
+        let page = heap_Gpa_pageAllocator();
+        return page.vt->resize(page.ptr, buf, buf_align, new_size);
+    }
+    return class_index == new_class_index;
+}
+
+static fn_scope(heap_Gpa_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let class_index     = heap_Gpa_classIndex(buf.len, buf_align);
+    let new_class_index = heap_Gpa_classIndex(new_size, buf_align);
+    if (heap_Gpa_size_class_count <= class_index && heap_Gpa_size_class_count <= new_class_index) {
+        let page = heap_Gpa_pageAllocator();
+        return_(page.vt->remap(page.ptr, buf, buf_align, new_size));
+    }
+    if (heap_Gpa_resize(ctx, buf, buf_align, new_size)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} unscoped;
+
+static fn_(heap_Gpa_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+    $unused(ctx);
+
+    let class_index = heap_Gpa_classIndex(buf.len, buf_align);
+    if (heap_Gpa_size_class_count <= class_index) {
+        let page = heap_Gpa_pageAllocator();
+        page.vt->free(page.ptr, buf, buf_align);
+        return;
+    }
+
+    // Push block to free list of whichever cache this thread holds
+    let cache                      = heap_Gpa_lockCache();
+    let block                      = as$(heap_Gpa_FreeBlock*, buf.ptr);
+    block->next                    = cache->free_lists[class_index];
+    cache->free_lists[class_index] = block;
+    heap_Gpa_unlockCache(cache);
+}
+
+/*========== Internal Helper Functions =====================================*/
+
+static fn_(heap_Gpa_classIndex(usize len, u32 align), usize) {
+    let size = prim_max(prim_max(len, as$(usize, align)), as$(usize, 1) << heap_Gpa_min_class_log2);
+    // Round up to power of two: blocks of a class are aligned to their size within each span
+    let size_log2 = as$(usize, (sizeOf(u64) * 8) - __builtin_clzll(as$(u64, size - 1)));
+    return size_log2 - heap_Gpa_min_class_log2;
+}
+
+static fn_(heap_Gpa_classSize(usize class_index), usize) {
+    return as$(usize, 1) << (class_index + heap_Gpa_min_class_log2);
+}
+
+static fn_(heap_Gpa_lockCache(void), heap_Gpa_Cache*) {
+    var index = heap_Gpa_s_thrd_cache_index;
+    if (index == 0) {
+        // Spread threads over caches on first use
+        let ticket = atomic_fetchAdd$(u32, &heap_Gpa_s_next_cache_index.raw, 1, atomic_MemOrd_monotonic);
+        index      = (ticket % heap_Gpa_cache_count) + 1;
+    }
+    while (true) {
+        for (usize attempt = 0; attempt < heap_Gpa_cache_count; ++attempt) {
+            let cache = &heap_Gpa_s_caches[index - 1];
+            if (!atomic_swap(cache->locked, true, atomic_MemOrd_acquire)) {
+                heap_Gpa_s_thrd_cache_index = index;
+                return cache;
+            }
+            // Contended, rotate to next cache
+            index = (index % heap_Gpa_cache_count) + 1;
+        }
+        atomic_spinLoopHint();
+    }
+}
+
+static fn_(heap_Gpa_unlockCache(heap_Gpa_Cache* cache), void) {
+    atomic_store(cache->locked, false, atomic_MemOrd_release);
+}
+
+/// Push a span range onto free lists, as the largest blocks its alignment and length allow
+static fn_(heap_Gpa_recycleRange(heap_Gpa_Cache* cache, usize addr, usize end), void) {
+    while (addr + heap_Gpa_classSize(0) <= end) {
+        var class_index = as$(usize, heap_Gpa_size_class_count - 1);
+        while (0 < class_index && (end - addr < heap_Gpa_classSize(class_index) || !mem_isAligned(addr, heap_Gpa_classSize(class_index)))) {
+            --class_index;
+        }
+        let block                      = intToRawptr$(heap_Gpa_FreeBlock*, addr);
+        block->next                    = cache->free_lists[class_index];
+        cache->free_lists[class_index] = block;
+        addr += heap_Gpa_classSize(class_index);
+    }
+}
+
+/// Backing allocator, called through its vtable so the tracker only sees outer allocations
+static fn_(heap_Gpa_pageAllocator(void), mem_Allocator) {
+    return heap_Page_allocator(&heap_Gpa_s_page);
+}
@@ -1,5 +1,6 @@
 #include "dh/heap/Page.h"
 #include "dh/mem/common.h"
+#include "dh/atomic.h"
 
 #if bti_plat_windows
 #include "dh/os/windows/mem.h"
@@ -7,6 +8,9 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #endif                 /* posix */
+#if bti_plat_linux
+#include <stdio.h>
+#endif                 /* bti_plat_linux */
 #include <stdatomic.h> // Required for atomic operations
 
 static fn_(heap_Page_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
@@ -14,6 +18,44 @@ static fn_(heap_Page_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_siz
 static fn_(heap_Page_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
 static fn_(heap_Page_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
 
+static fn_(heap_Page_allocOpts(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Page_resizeOpts(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Page_remapOpts(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Page_freeOpts(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+
+static fn_(heap_Page_allocWith(heap_Page_Opts opts, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Page_resizeWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Page_remapWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Page_freeWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align), void);
+
+static fn_(heap_Page_Reserve_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Page_Reserve_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Page_Reserve_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Page_Reserve_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+
+/// Header written into the first page of a retained mapping
+typedef struct heap_Page_Retained heap_Page_Retained;
+struct heap_Page_Retained {
+    heap_Page_Retained* next;
+    usize               len; ///< Page aligned length of mapping
+};
+
+/// Default huge page size, zero until first queried
+static atomic_Value$(usize) heap_Page_s_huge_page_size = {};
+
+// Internal helper functions
+static fn_(heap_Page_hugeLen(heap_Page_Opts opts), usize);
+static fn_(heap_Page_alignedLen(heap_Page_Opts opts, usize len), usize);
+static fn_(heap_Page_commit(anyptr addr, usize len), bool);
+static fn_(heap_Page_decommit(anyptr addr, usize len), void);
+static fn_(heap_Page_canRetain(const heap_Page* self), bool);
+static fn_(heap_Page_lockRetained(heap_Page* self), void);
+static fn_(heap_Page_unlockRetained(heap_Page* self), void);
+
+fn_(heap_Page_init(heap_Page_Opts opts), heap_Page) {
+    return (heap_Page){ .opts = opts };
+}
+
 fn_(heap_Page_allocator(heap_Page* self), mem_Allocator) {
     static const mem_Allocator_VT vt[1] = { {
         .alloc  = heap_Page_alloc,
@@ -21,26 +63,164 @@ fn_(heap_Page_allocator(heap_Page* self), mem_Allocator) {
         .remap  = heap_Page_remap,
         .free   = heap_Page_free,
     } };
+    /* Options are read through instance, so it must outlive the allocator */
+    static const mem_Allocator_VT vt_opts[1] = { {
+        .alloc  = heap_Page_allocOpts,
+        .resize = heap_Page_resizeOpts,
+        .remap  = heap_Page_remapOpts,
+        .free   = heap_Page_freeOpts,
+    } };
+    let has_opts = self != null && (self->opts.huge_pages || self->opts.transparent_huge_pages || self->opts.populate || self->opts.retain_freed);
     return (mem_Allocator){
         .ptr = self,
-        .vt  = vt,
+        .vt  = has_opts ? vt_opts : vt,
     };
 }
 
+fn_(heap_Page_trim(heap_Page* self), void) {
+    debug_assert_nonnull(self);
+
+    heap_Page_lockRetained(self);
+    var node       = as$(heap_Page_Retained*, self->retained);
+    self->retained = null;
+    heap_Page_unlockRetained(self);
+    while (node != null) {
+        let next = node->next;
+        heap_Page_freeWith((heap_Page_Opts){}, (Sli$u8){ .ptr = as$(u8*, node), .len = node->len }, 1);
+        node = next;
+    }
+}
+
+fn_(heap_Page_discard(Sli$u8 buf), void) {
+    debug_assert_fmt(mem_isAligned(rawptrToInt(buf.ptr), mem_page_size), "Buffer must be page aligned");
+    let aligned_len = mem_alignForward(buf.len, mem_page_size);
+    if (aligned_len == 0) { return; }
+#if bti_plat_windows
+    VirtualAlloc(buf.ptr, aligned_len, MEM_RESET, PAGE_READWRITE);
+#else  /* posix */
+    madvise(buf.ptr, aligned_len, MADV_DONTNEED);
+#endif /* posix */
+}
+
+fn_(heap_Page_hugePageSize(void), usize) {
+    var size = atomic_load(heap_Page_s_huge_page_size, atomic_MemOrd_monotonic);
+    if (size != 0) { return size; }
+
+#if bti_plat_windows
+    size = GetLargePageMinimum();
+#elif bti_plat_linux
+    let file = fopen("/proc/meminfo", "r");
+    if (file != null) {
+        char line[128];
+        while (fgets(line, sizeof(line), file)) {
+            unsigned long long kib = 0;
+            if (sscanf(line, "Hugepagesize: %llu kB", &kib) == 1) {
+                size = as$(usize, kib) * 1024;
+                break;
+            }
+        }
+        fclose(file);
+    }
+#endif /* bti_plat_linux */
+    // Racing threads compute the same value, so a plain store is enough
+    if (size == 0 || !mem_isValidAlign(size) || size < mem_page_size) { size = heap_Page_huge_page_size_fallback; }
+    atomic_store(heap_Page_s_huge_page_size, size, atomic_MemOrd_monotonic);
+    return size;
+}
+
 /*========== Allocator Interface Implementation =============================*/
 
-static fn_scope(heap_Page_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+static fn_(heap_Page_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    $unused(ctx);
+    return heap_Page_allocWith((heap_Page_Opts){}, len, align);
+}
+
+static fn_(heap_Page_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    $unused(ctx);
+    return heap_Page_resizeWith((heap_Page_Opts){}, buf, buf_align, new_size);
+}
+
+static fn_(heap_Page_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    $unused(ctx);
+    return heap_Page_remapWith((heap_Page_Opts){}, buf, buf_align, new_size);
+}
+
+static fn_(heap_Page_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    $unused(ctx);
+    heap_Page_freeWith((heap_Page_Opts){}, buf, buf_align);
+}
+
+static fn_scope(heap_Page_allocOpts(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    let self = as$(heap_Page*, ctx);
+    if (heap_Page_canRetain(self) && len <= usize_limit - (mem_page_size - 1)) {
+        // Reuse a retained mapping of the same length, its pages fault back in on demand
+        let aligned_len = mem_alignForward(len, mem_page_size);
+        heap_Page_lockRetained(self);
+        var link = as$(heap_Page_Retained**, &self->retained);
+        while (*link != null && (*link)->len != aligned_len) { link = &(*link)->next; }
+        let node = *link;
+        if (node != null) { *link = node->next; }
+        heap_Page_unlockRetained(self);
+        if (node != null) { return_some(as$(u8*, node)); }
+    }
+    return heap_Page_allocWith(self->opts, len, align);
+} unscoped;
+
+static fn_(heap_Page_resizeOpts(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    return heap_Page_resizeWith(as$(heap_Page*, ctx)->opts, buf, buf_align, new_size);
+}
+
+static fn_(heap_Page_remapOpts(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    return heap_Page_remapWith(as$(heap_Page*, ctx)->opts, buf, buf_align, new_size);
+}
+
+static fn_(heap_Page_freeOpts(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    let self = as$(heap_Page*, ctx);
+    if (!heap_Page_canRetain(self)) {
+        heap_Page_freeWith(self->opts, buf, buf_align);
+        return;
+    }
+
+    // Keep the address range but hand its pages back, only the header page stays resident
+    let aligned_len = mem_alignForward(buf.len, mem_page_size);
+    heap_Page_discard((Sli$u8){ .ptr = buf.ptr + mem_page_size, .len = aligned_len - mem_page_size });
+    let node = as$(heap_Page_Retained*, buf.ptr);
+    node->len = aligned_len;
+    heap_Page_lockRetained(self);
+    node->next     = self->retained;
+    self->retained = node;
+    heap_Page_unlockRetained(self);
+}
+
+static fn_scope(heap_Page_allocWith(heap_Page_Opts opts, usize len, u32 align), Opt$Ptr$u8) {
     debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
     // Page allocator guarantees page alignment, which is typically larger than most requested alignments
     // Verify requested alignment is not stricter than page alignment
     debug_assert_fmt(align <= mem_page_size, "Page allocator can only guarantee page alignment (requested: %zu, page size: %zu)", align, mem_page_size);
 
-    $unused(ctx, align);
+    $unused(align);
 
     // Check for overflow when aligning to page size
     if (usize_limit - (mem_page_size - 1) < len) { return_none(); }
+    if (opts.huge_pages && usize_limit - (heap_Page_hugeLen(opts) - 1) < len) { return_none(); }
 
 #if bti_plat_windows
+    if (opts.huge_pages) {
+        // Requires SeLockMemoryPrivilege, silently falls back to normal pages otherwise
+        let large_addr = VirtualAlloc(
+            null,
+            heap_Page_alignedLen(opts, len),
+            MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES,
+            PAGE_READWRITE
+        );
+        if (large_addr != null) {
+            return_some(large_addr);
+        }
+    }
     // Windows allocation logic similar to zig's PageAllocator
     let addr = VirtualAlloc(
         null,
@@ -91,18 +271,42 @@ static fn_scope(heap_Page_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
     }
     return_none();
 #else  /* posix */
-    let aligned_len = mem_alignForward(len, mem_page_size);
+    let aligned_len = heap_Page_alignedLen(opts, len);
     let hint        = heap_Page_s_next_mmap_addr_hint;
 
-    let map = mmap(
-        hint,
-        aligned_len,
-        PROT_READ | PROT_WRITE,
-        MAP_PRIVATE | MAP_ANONYMOUS,
-        -1,
-        0
-    );
+    var flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_POPULATE
+    if (opts.populate) { flags |= MAP_POPULATE; }
+#endif /* MAP_POPULATE */
+
+    var map = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    if (opts.huge_pages) {
+        // Fails when no huge pages are configured, fall back to normal pages
+        var huge_flags = flags | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+        // Explicit sizes other than the default pool are selected by their log2
+        if (opts.huge_page_size != 0) { huge_flags |= as$(i32, __builtin_ctzll(opts.huge_page_size)) << MAP_HUGE_SHIFT; }
+#endif /* MAP_HUGE_SHIFT */
+        map = mmap(hint, aligned_len, PROT_READ | PROT_WRITE, huge_flags, -1, 0);
+    }
+#endif /* MAP_HUGETLB */
+    if (map == MAP_FAILED) {
+        map = mmap(
+            hint,
+            aligned_len,
+            PROT_READ | PROT_WRITE,
+            flags,
+            -1,
+            0
+        );
+    }
     if (map == MAP_FAILED) { return_none(); }
+#ifdef MADV_HUGEPAGE
+    if (opts.transparent_huge_pages) {
+        madvise(map, aligned_len, MADV_HUGEPAGE);
+    }
+#endif /* MADV_HUGEPAGE */
     debug_assert_fmt(mem_isAligned(rawptrToInt(map), mem_page_size));
     debug_assert_fmt(mem_isAligned(rawptrToInt(map), ptr_align), "mmap returned misaligned address");
 
@@ -120,13 +324,18 @@ static fn_scope(heap_Page_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
 #endif /* posix */
 } unscoped;
 
-static fn_(heap_Page_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+static fn_(heap_Page_resizeWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
     debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
     debug_assert_fmt(buf_align <= mem_page_size, "Page allocator only guarantees page alignment");
     // Verify the buffer address actually has the claimed alignment
     debug_assert_fmt(mem_isAligned(rawptrToInt(buf.ptr), buf_align), "Buffer address does not match the specified alignment");
 
-    $unused(ctx, buf_align);
+    $unused(buf_align);
+
+    if (opts.huge_pages) {
+        // Huge page mappings can only be unmapped as a whole, resize within mapping only
+        return heap_Page_alignedLen(opts, new_size) == heap_Page_alignedLen(opts, buf.len);
+    }
 
     let new_size_aligned = mem_alignForward(new_size, mem_page_size);
     let buf_aligned_len  = mem_alignForward(buf.len, mem_page_size);
@@ -182,13 +391,20 @@ static fn_(heap_Page_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_siz
 #endif /* posix */
 }
 
-static fn_scope(heap_Page_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+static fn_scope(heap_Page_remapWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
     debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
     debug_assert_fmt(buf_align <= mem_page_size, "Page allocator only guarantees page alignment");
     // Verify the buffer address actually has the claimed alignment
     debug_assert_fmt(mem_isAligned(rawptrToInt(buf.ptr), buf_align), "Buffer address does not match the specified alignment");
 
-    $unused(ctx, buf_align);
+    $unused(buf_align);
+
+    if (opts.huge_pages) {
+        if (heap_Page_resizeWith(opts, buf, buf_align, new_size)) {
+            return_some(buf.ptr);
+        }
+        return_none();
+    }
 
     let new_size_aligned = mem_alignForward(new_size, mem_page_size);
     let buf_aligned_len  = mem_alignForward(buf.len, mem_page_size);
@@ -224,18 +440,166 @@ static fn_scope(heap_Page_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new
 #endif /* posix */
 } unscoped;
 
-static fn_(heap_Page_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+static fn_(heap_Page_freeWith(heap_Page_Opts opts, Sli$u8 buf, u32 buf_align), void) {
     debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
     debug_assert_fmt(buf_align <= mem_page_size, "Page allocator only guarantees page alignment");
     // Verify the buffer address actually has the claimed alignment
     debug_assert_fmt(mem_isAligned(rawptrToInt(buf.ptr), buf_align), "Buffer address does not match the specified alignment");
 
-    $unused(ctx, buf_align);
+    $unused(buf_align);
 
 #if bti_plat_windows
+    $unused(opts);
     VirtualFree(buf.ptr, 0, MEM_RELEASE);
 #else  /* posix */
-    let buf_aligned_len = mem_alignForward(buf.len, mem_page_size);
+    let buf_aligned_len = heap_Page_alignedLen(opts, buf.len);
     munmap(buf.ptr, buf_aligned_len);
 #endif /* posix */
 }
+
+/*========== Reserving Page Allocator =======================================*/
+
+fn_(heap_Page_Reserve_init(usize reserve_len), heap_Page_Reserve) {
+    debug_assert_fmt(0 < reserve_len, "Reserve length must be positive");
+    return (heap_Page_Reserve){
+        .reserve_len = mem_alignForward(reserve_len, mem_page_size),
+    };
+}
+
+fn_(heap_Page_Reserve_allocator(heap_Page_Reserve* self), mem_Allocator) {
+    debug_assert_nonnull(self);
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc  = heap_Page_Reserve_alloc,
+        .resize = heap_Page_Reserve_resize,
+        .remap  = heap_Page_Reserve_remap,
+        .free   = heap_Page_Reserve_free,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt,
+    };
+}
+
+static fn_scope(heap_Page_Reserve_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+    debug_assert_fmt(align <= mem_page_size, "Page allocator can only guarantee page alignment");
+
+    let self = as$(heap_Page_Reserve*, ctx);
+    $unused(align);
+    if (self->reserve_len < len) { return_none(); }
+
+    // Reserve address space without backing it
+#if bti_plat_windows
+    let reserved = VirtualAlloc(null, self->reserve_len, MEM_RESERVE, PAGE_NOACCESS);
+    if (reserved == null) { return_none(); }
+#else  /* posix */
+#ifdef MAP_NORESERVE
+    let flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE;
+#else  /* !MAP_NORESERVE */
+    let flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#endif /* !MAP_NORESERVE */
+    let reserved = mmap(null, self->reserve_len, PROT_NONE, flags, -1, 0);
+    if (reserved == MAP_FAILED) { return_none(); }
+#endif /* posix */
+
+    // Commit pages for requested length only
+    let commit_len = mem_alignForward(len, mem_page_size);
+    if (0 < commit_len && !heap_Page_commit(reserved, commit_len)) {
+#if bti_plat_windows
+        VirtualFree(reserved, 0, MEM_RELEASE);
+#else  /* posix */
+        munmap(reserved, self->reserve_len);
+#endif /* posix */
+        return_none();
+    }
+    return_some(reserved);
+} unscoped;
+
+static fn_(heap_Page_Reserve_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+    debug_assert_fmt(mem_isAligned(rawptrToInt(buf.ptr), buf_align), "Buffer address does not match the specified alignment");
+
+    let self = as$(heap_Page_Reserve*, ctx);
+    $unused(buf_align);
+    if (self->reserve_len < new_size) { return false; }
+
+    let committed_len  = mem_alignForward(buf.len, mem_page_size);
+    let new_commit_len = mem_alignForward(new_size, mem_page_size);
+    if (committed_len < new_commit_len) {
+        // Growing: commit following pages, address never changes
+        return heap_Page_commit(as$(u8*, buf.ptr) + committed_len, new_commit_len - committed_len);
+    }
+    if (new_commit_len < committed_len) {
+        // Shrinking: give pages back but keep the reservation
+        heap_Page_decommit(as$(u8*, buf.ptr) + new_commit_len, committed_len - new_commit_len);
+    }
+    return true;
+}
+
+static fn_scope(heap_Page_Reserve_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    if (heap_Page_Reserve_resize(ctx, buf, buf_align, new_size)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} unscoped;
+
+static fn_(heap_Page_Reserve_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Page_Reserve*, ctx);
+    $unused(buf_align);
+
+#if bti_plat_windows
+    $unused(self);
+    VirtualFree(buf.ptr, 0, MEM_RELEASE);
+#else  /* posix */
+    munmap(buf.ptr, self->reserve_len);
+#endif /* posix */
+}
+
+/*========== Internal Helper Functions =====================================*/
+
+static fn_(heap_Page_hugeLen(heap_Page_Opts opts), usize) {
+    debug_assert_fmt(opts.huge_page_size == 0 || mem_isValidAlign(opts.huge_page_size), "Huge page size must be a power of 2");
+    return opts.huge_page_size != 0 ? opts.huge_page_size : heap_Page_hugePageSize();
+}
+
+static fn_(heap_Page_alignedLen(heap_Page_Opts opts, usize len), usize) {
+    // Huge page mappings (and their fallbacks) always span whole huge pages
+    return mem_alignForward(len, opts.huge_pages ? heap_Page_hugeLen(opts) : mem_page_size);
+}
+
+static fn_(heap_Page_canRetain(const heap_Page* self), bool) {
+    // Huge page mappings can only be discarded in whole huge pages, so they are always unmapped
+    return self->opts.retain_freed && !self->opts.huge_pages;
+}
+
+static fn_(heap_Page_lockRetained(heap_Page* self), void) {
+    while (atomic_swap(self->retained_locked, true, atomic_MemOrd_acquire)) {
+        atomic_spinLoopHint();
+    }
+}
+
+static fn_(heap_Page_unlockRetained(heap_Page* self), void) {
+    atomic_store(self->retained_locked, false, atomic_MemOrd_release);
+}
+
+static fn_(heap_Page_commit(anyptr addr, usize len), bool) {
+#if bti_plat_windows
+    return VirtualAlloc(addr, len, MEM_COMMIT, PAGE_READWRITE) != null;
+#else  /* posix */
+    return mprotect(addr, len, PROT_READ | PROT_WRITE) == 0;
+#endif /* posix */
+}
+
+static fn_(heap_Page_decommit(anyptr addr, usize len), void) {
+#if bti_plat_windows
+    VirtualFree(addr, len, MEM_DECOMMIT);
+#else  /* posix */
+    madvise(addr, len, MADV_DONTNEED);
+    mprotect(addr, len, PROT_NONE);
+#endif /* posix */
+}
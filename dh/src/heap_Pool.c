@@ -0,0 +1,283 @@
+#include "dh/heap/Pool.h"
+#include "dh/mem/common.h"
+#include "dh/meta/common.h"
+#include "dh/opt.h"
+#include "dh/sli.h"
+#include "dh/debug.h"
+
+// Forward declarations for allocator vtable functions
+static fn_(heap_Pool_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_Pool_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_Pool_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_Pool_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+static fn_(heap_Pool_allocMany(anyptr ctx, usize len, u32 align, Sli$Ptr$u8 out), bool);
+static fn_(heap_Pool_freeMany(anyptr ctx, Sli$Ptr$u8 bufs, usize len, u32 align), void);
+
+// Internal helper functions
+static fn_(heap_Pool_slabAlign(const heap_Pool* self), u32);
+static fn_(heap_Pool_slotsOffset(const heap_Pool* self), usize);
+static fn_(heap_Pool_slabCap(const heap_Pool* self, const heap_Pool_Slab* slab), usize);
+static fn_(heap_Pool_slabSlotAt(const heap_Pool* self, heap_Pool_Slab* slab, usize index), u8*);
+static fn_(heap_Pool_createSlab(heap_Pool* self), Opt$Ptr$heap_Pool_Slab);
+
+extern fn_(heap_Pool_allocator(heap_Pool* self), mem_Allocator) {
+    debug_assert_nonnull(self);
+    /* VTable for Pool allocator */
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc     = heap_Pool_alloc,
+        .resize    = heap_Pool_resize,
+        .remap     = heap_Pool_remap,
+        .free      = heap_Pool_free,
+        .allocMany = heap_Pool_allocMany,
+        .freeMany  = heap_Pool_freeMany,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt
+    };
+}
+
+extern fn_(heap_Pool_init(mem_Allocator child_allocator, TypeInfo slot_type), heap_Pool) {
+    debug_assert_fmt(mem_isValidAlign(slot_type.align), "Alignment must be a power of 2");
+
+    // Every slot must be able to hold a free slot header while it is free
+    let slot_align = prim_max(slot_type.align, as$(u32, alignOf(heap_Pool_Slot)));
+    let slot_size  = mem_alignForward(prim_max(as$(usize, slot_type.size), sizeOf(heap_Pool_Slot)), slot_align);
+    return (heap_Pool){
+        .child_allocator = child_allocator,
+        .slot_size       = slot_size,
+        .slot_align      = slot_align,
+        .slabs           = none$(Opt$Ptr$heap_Pool_Slab),
+        .end_index       = 0,
+        .free_list       = none$(Opt$Ptr$heap_Pool_Slot),
+    };
+}
+
+extern fn_(heap_Pool_fini(heap_Pool self), void) {
+    let slab_align = heap_Pool_slabAlign(&self);
+    // Free all slabs in the list
+    var it = self.slabs;
+    while_some(it, slab) {
+        // Save next pointer before freeing current slab
+        let next_it   = slab->next;
+        let alloc_buf = Sli_from$(Sli$u8, as$(u8*, slab), slab->len);
+        mem_Allocator_rawFree(self.child_allocator, alloc_buf, slab_align);
+        it = next_it;
+    }
+}
+
+extern fn_(heap_Pool_queryCap(const heap_Pool* self), usize) {
+    debug_assert_nonnull(self);
+    usize cap = 0;
+    var   it  = self->slabs;
+    while_some(it, slab) {
+        cap += heap_Pool_slabCap(self, slab);
+        it = slab->next;
+    }
+    return cap;
+}
+
+extern fn_(heap_Pool_reset(heap_Pool* self, heap_Pool_ResetMode mode), void) {
+    debug_assert_nonnull(self);
+
+    match_(mode) {
+    pattern_(heap_Pool_ResetMode_free_all, _) {
+        // Free all memory and reset state
+        heap_Pool_fini(*self);
+        self->slabs     = none$(Opt$Ptr$heap_Pool_Slab);
+        self->end_index = 0;
+        self->free_list = none$(Opt$Ptr$heap_Pool_Slot);
+    } break;
+    pattern_(heap_Pool_ResetMode_retain_capacity, _) {
+        // Newest slab is served by bump index again, older slabs go to free list
+        self->end_index = 0;
+        self->free_list = none$(Opt$Ptr$heap_Pool_Slot);
+        if_some(self->slabs, newest_slab) {
+            var it = newest_slab->next;
+            while_some(it, slab) {
+                let cap = heap_Pool_slabCap(self, slab);
+                for (usize i = cap; 0 < i; --i) {
+                    let slot        = as$(heap_Pool_Slot*, heap_Pool_slabSlotAt(self, slab, i - 1));
+                    slot->next      = self->free_list;
+                    self->free_list = some$(Opt$Ptr$heap_Pool_Slot, slot);
+                }
+                it = slab->next;
+            }
+        }
+    } break;
+    };
+}
+
+extern fn_(heap_Pool_ownsPtr(const heap_Pool* self, Ptr_const$u8 ptr), bool) {
+    debug_assert_nonnull(self);
+    let addr = rawptrToInt(ptr);
+    var it   = self->slabs;
+    while_some(it, slab) {
+        let begin = rawptrToInt(slab) + heap_Pool_slotsOffset(self);
+        let end   = begin + heap_Pool_slabCap(self, slab) * self->slot_size;
+        if (begin <= addr && addr < end) { return true; }
+        it = slab->next;
+    }
+    return false;
+}
+
+/*========== Allocator Interface Implementation =============================*/
+
+static fn_scope(heap_Pool_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Pool*, ctx);
+    if (self->slot_size < len || self->slot_align < align) {
+        return_none();
+    }
+
+    // Reuse a freed slot first
+    if_some(self->free_list, slot) {
+        self->free_list = slot->next;
+        return_some(as$(u8*, slot));
+    }
+
+    // Bump from newest slab, or request a new one when exhausted
+    var slab = eval({
+        var current = make$(heap_Pool_Slab*);
+        if_some(self->slabs, first_slab) {
+            current = first_slab;
+            if (heap_Pool_slabCap(self, current) <= self->end_index) {
+                current = orelse(heap_Pool_createSlab(self), eval({ return_none(); }));
+            }
+        } else {
+            current = orelse(heap_Pool_createSlab(self), eval({ return_none(); }));
+        }
+        eval_return current;
+    });
+    let slot = heap_Pool_slabSlotAt(self, slab, self->end_index);
+    self->end_index += 1;
+    return_some(slot);
+} unscoped;
+
+static fn_(heap_Pool_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Pool*, ctx);
+    $unused(buf, buf_align);
+
+    // Any size up to the slot size fits in-place
+    return new_size <= self->slot_size;
+}
+
+static fn_scope(heap_Pool_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    if (heap_Pool_resize(ctx, buf, buf_align, new_size)) {
+        return_some(buf.ptr);
+    }
+    return_none();
+} unscoped;
+
+static fn_(heap_Pool_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Pool*, ctx);
+    $unused(buf_align);
+    debug_assert_fmt(heap_Pool_ownsPtr(self, buf.ptr), "Pointer not owned by pool");
+    debug_assert_fmt(buf.len <= self->slot_size, "Slice larger than slot size");
+
+    // Push slot to free list
+    let slot        = as$(heap_Pool_Slot*, buf.ptr);
+    slot->next      = self->free_list;
+    self->free_list = some$(Opt$Ptr$heap_Pool_Slot, slot);
+}
+
+static fn_(heap_Pool_allocMany(anyptr ctx, usize len, u32 align, Sli$Ptr$u8 out), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Pool*, ctx);
+    if (self->slot_size < len || self->slot_align < align) { return false; }
+
+    var count = as$(usize, 0);
+    // Drain freed slots first
+    while (count < out.len && isSome(self->free_list)) {
+        let slot         = unwrap(self->free_list);
+        self->free_list  = slot->next;
+        out.ptr[count++] = as$(u8*, slot);
+    }
+    // Then bump the rest from newest slab, a slab at a time
+    while (count < out.len) {
+        if (isNone(self->slabs) || heap_Pool_slabCap(self, unwrap(self->slabs)) <= self->end_index) {
+            if (isNone(heap_Pool_createSlab(self))) {
+                // Give back what was taken so the batch is all or nothing
+                heap_Pool_freeMany(ctx, Sli_from$(Sli$Ptr$u8, out.ptr, count), len, align);
+                return false;
+            }
+        }
+        let slab  = unwrap(self->slabs);
+        let avail = prim_min(heap_Pool_slabCap(self, slab) - self->end_index, out.len - count);
+        for (usize i = 0; i < avail; ++i) {
+            out.ptr[count++] = heap_Pool_slabSlotAt(self, slab, self->end_index + i);
+        }
+        self->end_index += avail;
+    }
+    return true;
+}
+
+static fn_(heap_Pool_freeMany(anyptr ctx, Sli$Ptr$u8 bufs, usize len, u32 align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self = as$(heap_Pool*, ctx);
+    $unused(align);
+    debug_assert_fmt(len <= self->slot_size, "Slice larger than slot size");
+
+    // Thread all slots onto free list in one pass
+    for (usize i = bufs.len; 0 < i; --i) {
+        debug_assert_fmt(heap_Pool_ownsPtr(self, bufs.ptr[i - 1]), "Pointer not owned by pool");
+        let slot        = as$(heap_Pool_Slot*, bufs.ptr[i - 1]);
+        slot->next      = self->free_list;
+        self->free_list = some$(Opt$Ptr$heap_Pool_Slot, slot);
+    }
+}
+
+/*========== Internal Helper Functions =====================================*/
+
+static fn_(heap_Pool_slabAlign(const heap_Pool* self), u32) {
+    return prim_max(self->slot_align, as$(u32, alignOf(heap_Pool_Slab)));
+}
+
+static fn_(heap_Pool_slotsOffset(const heap_Pool* self), usize) {
+    return mem_alignForward(sizeOf(heap_Pool_Slab), self->slot_align);
+}
+
+static fn_(heap_Pool_slabCap(const heap_Pool* self, const heap_Pool_Slab* slab), usize) {
+    return (slab->len - heap_Pool_slotsOffset(self)) / self->slot_size;
+}
+
+static fn_(heap_Pool_slabSlotAt(const heap_Pool* self, heap_Pool_Slab* slab, usize index), u8*) {
+    return as$(u8*, slab) + heap_Pool_slotsOffset(self) + index * self->slot_size;
+}
+
+static fn_scope(heap_Pool_createSlab(heap_Pool* self), Opt$Ptr$heap_Pool_Slab) {
+    debug_assert_nonnull(self);
+
+    // Calculate new slab size with exponential growth
+    let prev_cap = eval({
+        usize cap = 0;
+        if_some(self->slabs, first_slab) {
+            cap = heap_Pool_slabCap(self, first_slab);
+        }
+        eval_return cap;
+    });
+    let cap = prim_max(as$(usize, heap_Pool_min_slots_per_slab), prev_cap + prev_cap / 2);
+    let len = heap_Pool_slotsOffset(self) + cap * self->slot_size;
+
+    // Allocate new slab
+    let ptr  = orelse(mem_Allocator_rawAlloc(self->child_allocator, len, heap_Pool_slabAlign(self)), eval({ return_none(); }));
+    let slab = as$(heap_Pool_Slab*, ptr);
+    slab->len  = len;
+    slab->next = self->slabs;
+    self->slabs     = some$(Opt$Ptr$heap_Pool_Slab, slab);
+    self->end_index = 0;
+
+    return_some(slab);
+} unscoped;
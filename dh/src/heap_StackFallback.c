@@ -0,0 +1,99 @@
+#include "dh/heap/StackFallback.h"
+#include "dh/mem/common.h"
+
+// Forward declarations for allocator vtable functions
+static fn_(heap_StackFallback_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8);
+static fn_(heap_StackFallback_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool);
+static fn_(heap_StackFallback_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8);
+static fn_(heap_StackFallback_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void);
+
+fn_(heap_StackFallback_allocator(heap_StackFallback* self), mem_Allocator) {
+    debug_assert_nonnull(self);
+    /* VTable for StackFallback allocator */
+    static const mem_Allocator_VT vt[1] = { {
+        .alloc  = heap_StackFallback_alloc,
+        .resize = heap_StackFallback_resize,
+        .remap  = heap_StackFallback_remap,
+        .free   = heap_StackFallback_free,
+    } };
+    return (mem_Allocator){
+        .ptr = self,
+        .vt  = vt
+    };
+}
+
+fn_(heap_StackFallback_init(Sli$u8 buf, mem_Allocator fallback_allocator), heap_StackFallback) {
+    return (heap_StackFallback){
+        .fixed              = heap_Fixed_init(buf),
+        .fallback_allocator = fallback_allocator,
+    };
+}
+
+fn_(heap_StackFallback_reset(heap_StackFallback* self), void) {
+    debug_assert_nonnull(self);
+    heap_Fixed_reset(&self->fixed);
+}
+
+fn_(heap_StackFallback_ownsInline(const heap_StackFallback* self, Ptr_const$u8 ptr), bool) {
+    debug_assert_nonnull(self);
+    return heap_Fixed_ownsPtr(&self->fixed, ptr);
+}
+
+/*========== Allocator Interface Implementation =============================*/
+
+/* Both sides are called through their vtables so the tracker only sees outer allocations */
+
+static fn_scope(heap_StackFallback_alloc(anyptr ctx, usize len, u32 align), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2");
+
+    let self  = as$(heap_StackFallback*, ctx);
+    let fixed = heap_Fixed_allocator(&self->fixed);
+    // Serve from inline buffer while it has room
+    if_some(fixed.vt->alloc(fixed.ptr, len, align), ptr) {
+        return_some(ptr);
+    }
+    let fallback = self->fallback_allocator;
+    return_(fallback.vt->alloc(fallback.ptr, len, align));
+} unscoped;
+
+static fn_(heap_StackFallback_resize(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), bool) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_StackFallback*, ctx);
+    if (heap_Fixed_ownsPtr(&self->fixed, buf.ptr)) {
+        // Fails when growing past inline buffer, caller then moves data via alloc/copy/free
+        let fixed = heap_Fixed_allocator(&self->fixed);
+        return fixed.vt->resize(fixed.ptr, buf, buf_align, new_size);
+    }
+    let fallback = self->fallback_allocator;
+    return fallback.vt->resize(fallback.ptr, buf, buf_align, new_size);
+}
+
+static fn_(heap_StackFallback_remap(anyptr ctx, Sli$u8 buf, u32 buf_align, usize new_size), Opt$Ptr$u8) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_StackFallback*, ctx);
+    if (heap_Fixed_ownsPtr(&self->fixed, buf.ptr)) {
+        let fixed = heap_Fixed_allocator(&self->fixed);
+        return fixed.vt->remap(fixed.ptr, buf, buf_align, new_size);
+    }
+    let fallback = self->fallback_allocator;
+    return fallback.vt->remap(fallback.ptr, buf, buf_align, new_size);
+}
+
+static fn_(heap_StackFallback_free(anyptr ctx, Sli$u8 buf, u32 buf_align), void) {
+    debug_assert_nonnull(ctx);
+    debug_assert_fmt(mem_isValidAlign(buf_align), "Alignment must be a power of 2");
+
+    let self = as$(heap_StackFallback*, ctx);
+    if (heap_Fixed_ownsPtr(&self->fixed, buf.ptr)) {
+        let fixed = heap_Fixed_allocator(&self->fixed);
+        fixed.vt->free(fixed.ptr, buf, buf_align);
+        return;
+    }
+    let fallback = self->fallback_allocator;
+    fallback.vt->free(fallback.ptr, buf, buf_align);
+}
@@ -163,6 +163,86 @@ mem_Allocator_rawFree_debug(mem_Allocator self, Sli$u8 buf, u32 buf_align, SrcLo
     self.vt->free(self.ptr, buf, buf_align);
 }
 
+fn_(
+#if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
+mem_Allocator_rawAllocMany(mem_Allocator self, usize len, u32 align, Sli$Ptr$u8 out)
+#else /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+mem_Allocator_rawAllocMany_debug(mem_Allocator self, usize len, u32 align, Sli$Ptr$u8 out, SrcLoc src_loc)
+#endif /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+, bool) {
+    debug_assert_nonnull(self.vt);
+    debug_assert_nonnull(self.vt->alloc);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2: %u", align);
+
+    // Special case for zero-sized allocations
+    if (len == 0) {
+        let addr = intToRawptr$(u8*, usize_limit_max & ~(align - 1));
+        for (usize i = 0; i < out.len; ++i) {
+            out.ptr[i] = addr;
+#if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
+#else  /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+            mem_Tracker_registerAlloc(addr, len, src_loc);
+#endif /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+        }
+        return true;
+    }
+
+    if (self.vt->allocMany != null) {
+        // Allocator hands out the whole batch in a single call
+        if (!self.vt->allocMany(self.ptr, len, align, out)) { return false; }
+    } else {
+        // Fallback: one dispatch per buffer, undoing the batch on failure
+        for (usize i = 0; i < out.len; ++i) {
+            let result = self.vt->alloc(self.ptr, len, align);
+            if (isNone(result)) {
+                // Newest first, so stack-like allocators can take every buffer back
+                for (usize j = i; 0 < j; --j) {
+                    self.vt->free(self.ptr, Sli_from$(Sli$u8, out.ptr[j - 1], len), align);
+                }
+                return false;
+            }
+            out.ptr[i] = unwrap(result);
+        }
+    }
+#if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
+#else  /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+    for (usize i = 0; i < out.len; ++i) { mem_Tracker_registerAlloc(out.ptr[i], len, src_loc); }
+#endif /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+    return true;
+}
+
+fn_(
+#if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
+mem_Allocator_rawFreeMany(mem_Allocator self, Sli$Ptr$u8 bufs, usize len, u32 align)
+#else /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+mem_Allocator_rawFreeMany_debug(mem_Allocator self, Sli$Ptr$u8 bufs, usize len, u32 align, SrcLoc src_loc)
+#endif /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+, void) {
+    debug_assert_nonnull(self.vt);
+    debug_assert_nonnull(self.vt->free);
+    debug_assert_fmt(mem_isValidAlign(align), "Alignment must be a power of 2: %u", align);
+
+    // Special case for zero-sized allocations
+    if (len == 0) { return; }
+
+    for (usize i = 0; i < bufs.len; ++i) {
+        // Set memory to undefined before freeing
+        bti_memset(bufs.ptr[i], 0xAA, len);
+#if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
+#else  /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+        mem_Tracker_registerFree(bufs.ptr[i], src_loc);
+#endif /* COMP_TIME && (!COMP_TIME || debug_comp_enabled) */
+    }
+
+    if (self.vt->freeMany != null) {
+        self.vt->freeMany(self.ptr, bufs, len, align);
+        return;
+    }
+    for (usize i = 0; i < bufs.len; ++i) {
+        self.vt->free(self.ptr, Sli_from$(Sli$u8, bufs.ptr[i], len), align);
+    }
+}
+
 /*========== High-level Allocator Functions =================================*/
 
 #if !COMP_TIME || (COMP_TIME && !debug_comp_enabled)
@@ -209,6 +289,31 @@ void) {
     mem_Allocator_rawFree(self, mem, info.align);
 }
 
+fn_scope(mem_Allocator_createMany(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 out), mem_Allocator_Err$void) {
+    // Special case for zero-sized types
+    if (type.size == 0) {
+        let addr = intToRawptr$(u8*, usize_limit_max & ~(type.align - 1));
+        for (usize i = 0; i < out.len; ++i) { out.ptr[i] = addr; }
+        return_ok({});
+    }
+
+    if (!mem_Allocator_rawAllocMany(self, type.size, type.align, out)) {
+        return_err(mem_Allocator_Err_OutOfMemory());
+    }
+
+    // Initialize memory to undefined pattern
+    for (usize i = 0; i < out.len; ++i) { bti_memset(out.ptr[i], 0xAA, type.size); }
+    return_ok({});
+} unscoped;
+
+fn_(mem_Allocator_destroyMany(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 ptrs), void) {
+    // Special case for zero-sized types
+    if (type.size == 0) {
+        return;
+    }
+    mem_Allocator_rawFreeMany(self, ptrs, type.size, type.align);
+}
+
 fn_scope( mem_Allocator_alloc(mem_Allocator self, TypeInfo type, usize count),
 mem_Allocator_Err$meta_Sli) {
     // Special case for zero-sized types or zero count
@@ -504,6 +609,31 @@ fn_(mem_Allocator_destroy_debug(mem_Allocator self, AnyType ptr, SrcLoc src_loc)
     mem_Allocator_rawFree_debug(self, mem, info.align, src_loc);
 }
 
+fn_scope(mem_Allocator_createMany_debug(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 out, SrcLoc src_loc), mem_Allocator_Err$void) {
+    // Special case for zero-sized types
+    if (type.size == 0) {
+        let addr = intToRawptr$(u8*, usize_limit_max & ~(type.align - 1));
+        for (usize i = 0; i < out.len; ++i) { out.ptr[i] = addr; }
+        return_ok({});
+    }
+
+    if (!mem_Allocator_rawAllocMany_debug(self, type.size, type.align, out, src_loc)) {
+        return_err(mem_Allocator_Err_OutOfMemory());
+    }
+
+    // Initialize memory to undefined pattern
+    for (usize i = 0; i < out.len; ++i) { bti_memset(out.ptr[i], 0xAA, type.size); }
+    return_ok({});
+} unscoped;
+
+fn_(mem_Allocator_destroyMany_debug(mem_Allocator self, TypeInfo type, Sli$Ptr$u8 ptrs, SrcLoc src_loc), void) {
+    // Special case for zero-sized types
+    if (type.size == 0) {
+        return;
+    }
+    mem_Allocator_rawFreeMany_debug(self, ptrs, type.size, type.align, src_loc);
+}
+
 fn_scope(mem_Allocator_alloc_debug(mem_Allocator self, TypeInfo type, usize count, SrcLoc src_loc), mem_Allocator_Err$meta_Sli) {
     // Special case for zero-sized types or zero count
     if (type.size == 0 || count == 0) {
@@ -4,7 +4,7 @@
  * @file    mem_Tracker.c
  * @author  Gyeongtae Kim(dev-dasae) <codingpelican@gmail.com>
  * @date    2025-01-09 (date of creation)
- * @updated 2025-03-22 (date of last update)
+ * @updated 2025-04-22 (date of last update)
  * @version v0.1-alpha.2
  * @ingroup dasae-headers(dh)/mem
  * @prefix  mem_Tracker
@@ -13,10 +13,13 @@
  * @details Implementation of memory allocation tracking functionality
  */
 
+#if !defined(_GNU_SOURCE)
+#define _GNU_SOURCE /* For dladdr */
+#endif /* !defined(_GNU_SOURCE) */
+
 #include "dh/mem/Tracker.h"
 #include "dh/mem/common.h"
-#include "dh/heap/Classic.h"
-#include "dh/ArrList.h"
+#include "dh/mem/Allocator.h"
 #include "dh/err_res.h"
 #include "dh/core/src_loc.h"
 #include "dh/fs/dir.h"
@@ -24,26 +27,127 @@
 #include "dh/Str.h"
 #include "dh/Arr.h"
 #include "dh/time.h"
+#include "dh/atomic.h"
+#include "dh/debug.h"
+#include "dh/claim/assert_static.h"
 
-#include <stdlib.h> // For malloc, free, and atexit
+#include <stdlib.h> // For malloc, calloc, free, qsort, and atexit
 
 #if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
 #else
 
+#if bti_plat_windows
+#include "dh/os/windows/common.h" // For RtlCaptureStackBackTrace and FlsAlloc
+#define mem_Tracker_has_backtrace (1)
+#elif (bti_plat_linux && defined(__GLIBC__)) || bti_plat_darwin || bti_plat_bsd
+#include <execinfo.h> // For backtrace
+#include <dlfcn.h>    // For dladdr
+#define mem_Tracker_has_backtrace (1)
+#else  /* others */
+#define mem_Tracker_has_backtrace (0)
+#endif /* others */
+
+#if bti_plat_windows
+#define mem_Tracker_has_thrd_exit (1)
+#elif bti_plat_posix
+#include <pthread.h> // For pthread_key_create
+#define mem_Tracker_has_thrd_exit (1)
+#else  /* others */
+#define mem_Tracker_has_thrd_exit (0)
+#endif /* others */
+
 /*========== Constants and Default Configuration ===========================*/
 
 static const Str_const mem_Tracker_default_log_file = Str_l("log/mem.log");
+/// Initial capacity of each shard's allocation table (power of two)
+#define mem_Tracker_shard_init_cap (64)
+/// Shard is picked from the top hash bits: 64 - log2(mem_Tracker_shard_count)
+#define mem_Tracker_shard_shift    (64 - __builtin_ctzll(mem_Tracker_shard_count))
+claim_assert_static_msg(
+    1 < mem_Tracker_shard_count && (mem_Tracker_shard_count & (mem_Tracker_shard_count - 1)) == 0,
+    "Shard count must be a power of two greater than one"
+);
+/// Slot is picked from hash bits below the shard bits
+#define mem_Tracker_slot_shift     (26)
+/// Backtrace frames belonging to the tracker itself (captureStack, sampleAlloc, registerAlloc)
+#define mem_Tracker_profile_skip_frames (3)
+
+/*========== Tracker Internal Types ========================================*/
+
+/// Live allocation record (slot of open-addressing table, empty when ptr is null)
+typedef struct mem_Tracker_Entry {
+    anyptr                     ptr;       /* Allocated pointer */
+    usize                      size;      /* Allocation size */
+    SrcLoc                     src_loc;   /* Source location*/
+    time_Instant               timestamp; /* Allocation time */
+    struct mem_Tracker_Sample* sample;    /* Profile sample (null when not sampled) */
+} mem_Tracker_Entry;
+
+/// Allocation table for the pointers hashing into this shard
+typedef struct mem_Tracker_Shard {
+    atomic_Value$(bool) locked;
+    mem_Tracker_Entry*  entries; /* Open-addressing table of live allocations */
+    usize               cap;     /* Table capacity (power of two) */
+    usize               len;     /* Number of live allocations */
+} __attribute__((aligned(atomic_cache_line))) mem_Tracker_Shard;
 
-/*========== Tracker Leak Report Types =====================================*/
+/// Kind of recorded event
+typedef enum mem_Tracker_EventKind {
+    mem_Tracker_EventKind_alloc = 0,
+    mem_Tracker_EventKind_remap,
+    mem_Tracker_EventKind_free,
+    mem_Tracker_EventKind_invalid_free,
+    mem_Tracker_EventKind_untracked,
+} mem_Tracker_EventKind;
 
-/// Individual allocation record
-typedef struct mem_Allocation {
-    anyptr                 ptr;       /* Allocated pointer */
-    usize                  size;      /* Allocation size */
-    SrcLoc                 src_loc;   /* Source location*/
-    time_Instant           timestamp; /* Allocation time */
-    struct mem_Allocation* next;
-} mem_Allocation;
+/// Binary event record (formatted only when report is generated)
+typedef struct mem_Tracker_Event {
+    mem_Tracker_EventKind kind;
+    u32                   thrd_id;      /* Recording thread */
+    u64                   seq;          /* Global order across threads */
+    anyptr                ptr;
+    anyptr                old_ptr;
+    usize                 size;
+    usize                 old_size;
+    usize                 total;
+    SrcLoc                src_loc;
+    SrcLoc                orig_src_loc; /* Allocation site of freed pointer */
+    time_Duration         age;          /* Lifetime of freed pointer */
+} mem_Tracker_Event;
+
+/// Event buffer owned by one thread (merged and released when the thread exits or the report is generated)
+typedef struct mem_Tracker_ThrdBuf mem_Tracker_ThrdBuf;
+struct mem_Tracker_ThrdBuf {
+    mem_Tracker_ThrdBuf* next;    /* Previously registered buffer */
+    atomic_Value$(bool)  locked;  /* Held by the owner while appending, by others while merging */
+    bool                 retired; /* Merged into a generated report and unregistered, only the owner refers to it */
+    u32                  thrd_id;
+    usize                len;
+    mem_Tracker_Event    events[mem_Tracker_event_buf_len];
+};
+
+/// Sampled allocation (stack is stored leaf first)
+typedef struct mem_Tracker_Sample {
+    usize  weight;     /* Estimated bytes represented by this sample */
+    SrcLoc src_loc;    /* Allocation site */
+    u32    frames_len;
+    anyptr frames[mem_Tracker_profile_max_frames];
+} mem_Tracker_Sample;
+
+/// Heap profiling state
+typedef struct mem_Tracker_Profile {
+    atomic_Value$(bool)  enabled;
+    atomic_Value$(bool)  writing;        /* Guards automatic snapshot writes */
+    usize                sample_interval;
+    usize                snapshot_interval;
+    Arr$$(192, u8)       path_prefix;    /* Null-terminated copy of snapshot path prefix */
+    atomic_Value$(usize) live_bytes;     /* Estimated live bytes of sampled allocations */
+    atomic_Value$(usize) live_samples;   /* Number of live samples */
+    atomic_Value$(usize) since_snapshot; /* Estimated bytes allocated since last periodic snapshot */
+    atomic_Value$(usize) peak_bytes;     /* Highest estimated live bytes seen */
+    atomic_Value$(usize) peak_written;   /* Estimated live bytes of last peak snapshot */
+    usize                snapshot_count;
+} mem_Tracker_Profile;
 
 /// Leak site for aggregated reporting
 typedef struct LeakSite {
@@ -52,12 +156,69 @@ typedef struct LeakSite {
     usize  total_bytes;
 } LeakSite;
 
+// Internal helper functions
+static fn_(mem_Tracker_hashPtr(anyptr ptr), u64);
+static fn_(mem_Tracker_lockShard(u64 hash), mem_Tracker_Shard*);
+static fn_(mem_Tracker_unlockShard(mem_Tracker_Shard* shard), void);
+static fn_(mem_Tracker_findIndex(const mem_Tracker_Shard* shard, anyptr ptr, u64 hash), usize);
+static fn_(mem_Tracker_insert(mem_Tracker_Shard* shard, mem_Tracker_Entry entry, u64 hash, mem_Tracker_Entry* out_stale), bool);
+static fn_(mem_Tracker_removeAt(mem_Tracker_Shard* shard, usize index), void);
+static fn_(mem_Tracker_freeEntries(mem_Tracker_Entry* entries, usize cap), void);
+static fn_(mem_Tracker_lockSpill(void), void);
+static fn_(mem_Tracker_unlockSpill(void), void);
+static fn_(mem_Tracker_record(mem_Tracker_Event event), void);
+static fn_(mem_Tracker_acquireThrdBuf(void), mem_Tracker_ThrdBuf*);
+static fn_(mem_Tracker_lockThrdBuf(mem_Tracker_ThrdBuf* buf), void);
+static fn_(mem_Tracker_unlockThrdBuf(mem_Tracker_ThrdBuf* buf), void);
+static fn_(mem_Tracker_releaseThrdBuf(mem_Tracker_ThrdBuf* buf), void);
+static fn_(mem_Tracker_watchThrdExit(mem_Tracker_ThrdBuf* buf), void);
+static fn_(mem_Tracker_mergeThrdBuf(mem_Tracker_ThrdBuf* buf), void);
+static fn_(mem_Tracker_formatSpill(FILE* spill), void);
+static fn_(mem_Tracker_formatEvents(const mem_Tracker_Event* events, usize len), void);
+static fn_(mem_Tracker_cmpEvent(const void* lhs, const void* rhs), int);
+static fn_(mem_Tracker_isSameSite(SrcLoc lhs, SrcLoc rhs), bool);
+static no_inline fn_(mem_Tracker_sampleAlloc(usize size, SrcLoc src_loc), mem_Tracker_Sample*);
+static no_inline fn_(mem_Tracker_captureStack(anyptr* frames, u32 frames_cap), u32);
+static fn_(mem_Tracker_releaseSample(mem_Tracker_Sample* sample), void);
+static fn_(mem_Tracker_maybeSnapshot(void), void);
+static fn_(mem_Tracker_writeFolded(const char* path), bool);
+static fn_(mem_Tracker_cmpSample(const void* lhs, const void* rhs), int);
+static fn_(mem_Tracker_writeFrame(FILE* file, anyptr frame), void);
+
 /*========== Singleton Instance ============================================*/
 
-static mem_Tracker mem_Tracker_s_instance = cleared();
+static mem_Tracker                        mem_Tracker_s_instance                        = cleared();
+static mem_Tracker_Shard                  mem_Tracker_s_shards[mem_Tracker_shard_count] = {};
+static $thread_local mem_Tracker_ThrdBuf* mem_Tracker_s_thrd_buf                        = null;
+static atomic_Value$(u32)                 mem_Tracker_s_next_thrd_id                    = {};
+#if bti_plat_windows
+static DWORD                              mem_Tracker_s_thrd_exit_key                   = FLS_OUT_OF_INDEXES;
+#elif mem_Tracker_has_thrd_exit
+static pthread_key_t                      mem_Tracker_s_thrd_exit_key                   = {};
+static bool                               mem_Tracker_s_thrd_exit_key_valid             = false;
+#endif /* mem_Tracker_has_thrd_exit */
+static mem_Tracker_Profile                mem_Tracker_s_profile                         = {};
+/// Bytes this thread may still allocate before next sample (zero means unassigned)
+static $thread_local usize                mem_Tracker_s_sample_bytes_left               = 0;
+
+#if bti_plat_windows
+static VOID NTAPI mem_Tracker_onThrdExit(PVOID buf) {
+    mem_Tracker_releaseThrdBuf(as$(mem_Tracker_ThrdBuf*, buf));
+}
+#elif mem_Tracker_has_thrd_exit
+static fn_(mem_Tracker_onThrdExit(anyptr buf), void) {
+    mem_Tracker_releaseThrdBuf(as$(mem_Tracker_ThrdBuf*, buf));
+}
+#endif /* mem_Tracker_has_thrd_exit */
 
 /// Automatic initialization at program start
 static $on_load fn_(mem_Tracker_init(void), void) {
+    // Buffers of exited threads are merged and freed by the thread itself
+#if bti_plat_windows
+    mem_Tracker_s_thrd_exit_key = FlsAlloc(mem_Tracker_onThrdExit);
+#elif mem_Tracker_has_thrd_exit
+    mem_Tracker_s_thrd_exit_key_valid = pthread_key_create(&mem_Tracker_s_thrd_exit_key, mem_Tracker_onThrdExit) == 0;
+#endif /* mem_Tracker_has_thrd_exit */
     catch_from(mem_Tracker_initWithPath(mem_Tracker_default_log_file), err, eval({
          /* If initialization fails, try to log to stderr */
         printf("ERROR: Failed to initialize memory tracker: [%s] %s\n",
@@ -82,6 +243,7 @@ fn_scope_ext(mem_Tracker_initWithPath(Str_const log_path), Err$void) {
 
     // Open log file
     Arr$$(256, u8) path_str = Arr_zero();
+    if (Arr_len(path_str) <= log_path.len) { return_err(Err_InvalidArgument()); }
     mem_copy(path_str.buf, log_path.ptr, log_path.len);
     Arr_setAt(path_str, log_path.len, '\0');
 
@@ -89,16 +251,37 @@ fn_scope_ext(mem_Tracker_initWithPath(Str_const log_path), Err$void) {
     if (!log_file) { return_err(io_FileErr_OpenFailed()); }
     errdefer_($ignore fclose(log_file));
 
+    // Tracker bookkeeping bypasses the tracked allocators
+    Arr$$(mem_Tracker_shard_count, mem_Tracker_Entry*) entries = Arr_zero();
+    errdefer_(for (usize i = 0; i < mem_Tracker_shard_count; ++i) { free(Arr_getAt(entries, i)); });
+    for (usize i = 0; i < mem_Tracker_shard_count; ++i) {
+        let shard_entries = as$(mem_Tracker_Entry*, calloc(mem_Tracker_shard_init_cap, sizeof(mem_Tracker_Entry)));
+        if (!shard_entries) { return_err(mem_Allocator_Err_OutOfMemory()); }
+        Arr_setAt(entries, i, shard_entries);
+    }
+
     // Close previous log file if it exists
     if (mem_Tracker_s_instance.log_file) {
         $ignore fclose(mem_Tracker_s_instance.log_file);
     }
+    if (mem_Tracker_s_instance.events_spill) {
+        $ignore fclose(mem_Tracker_s_instance.events_spill);
+    }
 
     // Set up the tracker instance
-    mem_Tracker_s_instance.log_file        = log_file;
-    mem_Tracker_s_instance.allocations     = null;
-    mem_Tracker_s_instance.total_allocated = 0;
-    mem_Tracker_s_instance.active_allocs   = 0;
+    for (usize i = 0; i < mem_Tracker_shard_count; ++i) {
+        let shard = &mem_Tracker_s_shards[i];
+        mem_Tracker_freeEntries(shard->entries, shard->cap);
+        shard->entries = Arr_getAt(entries, i);
+        shard->cap     = mem_Tracker_shard_init_cap;
+        shard->len     = 0;
+    }
+    mem_Tracker_s_instance.shards       = mem_Tracker_s_shards;
+    mem_Tracker_s_instance.events_spill = null;
+    mem_Tracker_s_instance.log_file     = log_file;
+    atomic_store(mem_Tracker_s_instance.total_allocated, 0, atomic_MemOrd_release);
+    atomic_store(mem_Tracker_s_instance.active_allocs, 0, atomic_MemOrd_release);
+    atomic_store(mem_Tracker_s_instance.enabled, true, atomic_MemOrd_release);
 
     // clang-format off
     // Write header
@@ -110,21 +293,70 @@ fn_scope_ext(mem_Tracker_initWithPath(Str_const log_path), Err$void) {
     return_ok({});
 } unscoped_ext;
 
-fn_scope_ext(mem_Tracker_finiAndGenerateReport(void), void) {
-    if (!mem_Tracker_s_instance.log_file) { return; }
+fn_(mem_Tracker_finiAndGenerateReport(void), void) {
+    // Only the first call reports, later registrations are ignored from here on
+    if (!atomic_swap(mem_Tracker_s_instance.enabled, false, atomic_MemOrd_acq_rel)) { return; }
+
+    // Merge events still held by every thread, then format the whole history.
+    // Each buffer is locked, so an owner still appending finishes before its buffer is merged
+    mem_Tracker_lockSpill();
+    for (var buf = mem_Tracker_s_instance.thrd_bufs; buf;) {
+        let next = buf->next;
+        mem_Tracker_lockThrdBuf(buf);
+        mem_Tracker_mergeThrdBuf(buf);
+        if (buf == mem_Tracker_s_thrd_buf) {
+            // Own buffer is not in use, the ones of other threads are freed by their owners
+            mem_Tracker_unlockThrdBuf(buf);
+            mem_Tracker_s_thrd_buf = null;
+            mem_Tracker_watchThrdExit(null);
+            free(buf);
+        } else {
+            buf->retired = true;
+            mem_Tracker_unlockThrdBuf(buf);
+        }
+        buf = next;
+    }
+    mem_Tracker_s_instance.thrd_bufs = null;
+    if (mem_Tracker_s_instance.events_spill) {
+        mem_Tracker_formatSpill(mem_Tracker_s_instance.events_spill);
+        $ignore fclose(mem_Tracker_s_instance.events_spill);
+        mem_Tracker_s_instance.events_spill = null;
+    }
+    mem_Tracker_unlockSpill();
+
+    // Final heap profile holds sampled allocations still alive at exit
+    if (atomic_load(mem_Tracker_s_profile.enabled, atomic_MemOrd_acquire)) {
+        mem_Tracker_stopProfile();
+        Arr$$(256, u8) path = Arr_zero();
+        let path_len        = snprintf(as$(char*, path.buf), Arr_len(path), "%s-final.folded", as$(const char*, mem_Tracker_s_profile.path_prefix.buf));
+        if (0 <= path_len && as$(usize, path_len) < Arr_len(path)) {
+            $ignore mem_Tracker_writeFolded(as$(const char*, path.buf));
+        }
+        $ignore fprintf(mem_Tracker_s_instance.log_file, "\nHeap Profile\n");
+        $ignore fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
+        $ignore fprintf(mem_Tracker_s_instance.log_file, "Snapshots written: %zu (%s-*.folded)\n",
+            mem_Tracker_s_profile.snapshot_count, as$(const char*, mem_Tracker_s_profile.path_prefix.buf)
+        );
+        $ignore fprintf(mem_Tracker_s_instance.log_file, "Estimated peak live heap: %zu bytes\n",
+            atomic_load(mem_Tracker_s_profile.peak_bytes, atomic_MemOrd_acquire)
+        );
+    }
+
+    let total_allocated = atomic_load(mem_Tracker_s_instance.total_allocated, atomic_MemOrd_acquire);
+    let active_allocs   = atomic_load(mem_Tracker_s_instance.active_allocs, atomic_MemOrd_acquire);
 
     // clang-format off
     $ignore fprintf(mem_Tracker_s_instance.log_file, "\nMemory Leak Report\n");
     $ignore fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
     $ignore fprintf(mem_Tracker_s_instance.log_file, "Total allocations: %zu bytes\n",
-        mem_Tracker_s_instance.total_allocated
+        total_allocated
     );
     $ignore fprintf(mem_Tracker_s_instance.log_file, "Active allocations: %zu\n",
-        mem_Tracker_s_instance.active_allocs
+        active_allocs
     );
     // clang-format on
 
-    if (mem_Tracker_s_instance.active_allocs > 0) {
+    if (active_allocs > 0) {
         $ignore fprintf(mem_Tracker_s_instance.log_file, "\nDetected Memory Leaks:\n");
         $ignore fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
 
@@ -132,69 +364,61 @@ fn_scope_ext(mem_Tracker_finiAndGenerateReport(void), void) {
         time_Instant now = time_Instant_now();
 
         // Track all leaks
-        mem_Allocation* curr         = mem_Tracker_s_instance.allocations;
-        usize           leak_count   = 0;
-        usize           total_leaked = 0;
-
-        // Create a dynamic array for leak sites
-        var sites = type$(ArrList$$(LeakSite), ArrList_init(typeInfo$(LeakSite), heap_Classic_allocator(create$(heap_Classic))));
-        defer_(ArrList_fini(sites.base));
-
-        // Process each leak
-        while (curr) {
-            leak_count++;
-            total_leaked += curr->size;
-
-            // Calculate age of leak
-            time_Duration age      = time_Instant_durationSince(now, curr->timestamp);
-            f64           age_secs = time_Duration_asSecs_f64(age);
-
-            // Log individual leak
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "Leak #%zu:\n", leak_count);
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "  Address: %p\n", curr->ptr);
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "  Size: %zu bytes\n", curr->size);
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "  Location: %s:%d\n", curr->src_loc.file_name, curr->src_loc.line);
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "  Function: %s\n", curr->src_loc.fn_name);
-            $ignore fprintf(mem_Tracker_s_instance.log_file, "  Age: %.2f seconds\n", age_secs);
-
-            // Find or add to leak sites
-            bool found = false;
-            for_slice_indexed (sites.items, site_ptr, i) {
-                LeakSite* site = site_ptr;
-
-                // Check if it's the same location
-                if (Str_eql(Str_viewZ(as$(u8*, site->src_loc.file_name)), Str_viewZ(as$(u8*, curr->src_loc.file_name)))
-                    && site->src_loc.line == curr->src_loc.line
-                    && Str_eql(Str_viewZ(as$(u8*, site->src_loc.fn_name)), Str_viewZ(as$(u8*, curr->src_loc.fn_name)))) {
-
-                    site->count++;
-                    site->total_bytes += curr->size;
-                    found = true;
-                    break;
-                }
-            }
+        usize leak_count   = 0;
+        usize total_leaked = 0;
 
-            if (!found) {
-                // Add new leak site
-                catch_(ArrList_addBackOne(sites.base), ({ $ignore fprintf(mem_Tracker_s_instance.log_file, "ERROR: Failed to track leak site\n");
-                }));
+        // Leak sites are aggregated outside tracked allocators (at most one per leak)
+        let   sites     = as$(LeakSite*, calloc(active_allocs, sizeof(LeakSite)));
+        usize sites_len = 0;
+        if (!sites) {
+            $ignore fprintf(mem_Tracker_s_instance.log_file, "ERROR: Failed to track leak sites\n");
+        }
+
+        // Process each leak, one shard at a time
+        for (usize shard_index = 0; shard_index < mem_Tracker_shard_count; ++shard_index) {
+            let shard = &mem_Tracker_s_shards[shard_index];
+            while (atomic_swap(shard->locked, true, atomic_MemOrd_acquire)) { atomic_spinLoopHint(); }
+            for (usize i = 0; i < shard->cap; ++i) {
+                let curr = &shard->entries[i];
+                if (!curr->ptr) { continue; }
+                leak_count++;
+                total_leaked += curr->size;
+
+                // Calculate age of leak
+                time_Duration age      = time_Instant_durationSince(now, curr->timestamp);
+                f64           age_secs = time_Duration_asSecs_f64(age);
 
-                if_some(ArrList_popOrNull(sites.base), site_ptr) {
-                    let site          = meta_cast$(LeakSite*, site_ptr);
-                    site->src_loc     = curr->src_loc;
-                    site->count       = 1;
-                    site->total_bytes = curr->size;
+                // Log individual leak
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "Leak #%zu:\n", leak_count);
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "  Address: %p\n", curr->ptr);
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "  Size: %zu bytes\n", curr->size);
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "  Location: %s:%d\n", curr->src_loc.file_name, curr->src_loc.line);
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "  Function: %s\n", curr->src_loc.fn_name);
+                $ignore fprintf(mem_Tracker_s_instance.log_file, "  Age: %.2f seconds\n", age_secs);
+
+                if (!sites) { continue; }
+                // Find or add to leak sites
+                usize site_index = 0;
+                while (site_index < sites_len && !mem_Tracker_isSameSite(sites[site_index].src_loc, curr->src_loc)) {
+                    site_index++;
+                }
+                if (site_index == sites_len) {
+                    // Other threads may still allocate while report is generated
+                    if (sites_len == active_allocs) { continue; }
+                    sites[sites_len++] = (LeakSite){ .src_loc = curr->src_loc };
                 }
+                sites[site_index].count++;
+                sites[site_index].total_bytes += curr->size;
             }
-
-            curr = curr->next;
+            mem_Tracker_unlockShard(shard);
         }
 
         // Print leak summary by allocation site
         $ignore fprintf(mem_Tracker_s_instance.log_file, "\nLeak Summary by Location:\n");
         $ignore fprintf(mem_Tracker_s_instance.log_file, "=====================================\n");
 
-        for_slice (sites.items, site) {
+        for (usize i = 0; i < sites_len; ++i) {
+            let site = &sites[i];
             $ignore fprintf(
                 mem_Tracker_s_instance.log_file,
                 "Location: %s:%d in %s\n"
@@ -207,148 +431,666 @@ fn_scope_ext(mem_Tracker_finiAndGenerateReport(void), void) {
                 site->total_bytes
             );
         }
+        free(sites);
 
         $ignore fprintf(mem_Tracker_s_instance.log_file, "\nTotal leaked memory: %zu bytes\n", total_leaked);
     }
 
-    // Cleanup the tracker's linked list of allocations
-    mem_Allocation* curr = mem_Tracker_s_instance.allocations;
-    while (curr) {
-        mem_Allocation* next = curr->next;
-        free(curr);
-        curr = next;
+    // Cleanup the tracker's allocation tables, registrations racing with this find them empty
+    for (usize i = 0; i < mem_Tracker_shard_count; ++i) {
+        let shard = &mem_Tracker_s_shards[i];
+        while (atomic_swap(shard->locked, true, atomic_MemOrd_acquire)) { atomic_spinLoopHint(); }
+        mem_Tracker_freeEntries(shard->entries, shard->cap);
+        shard->entries = null;
+        shard->cap     = 0;
+        shard->len     = 0;
+        mem_Tracker_unlockShard(shard);
     }
 
     $ignore fclose(mem_Tracker_s_instance.log_file);
-    mem_Tracker_s_instance.log_file    = null;
-    mem_Tracker_s_instance.allocations = null;
-    return_void();
-} unscoped_ext;
+    mem_Tracker_s_instance.log_file = null;
+}
 
 fn_(mem_Tracker_registerAlloc(anyptr ptr, usize size, SrcLoc src_loc), void) {
-    if (!ptr || !mem_Tracker_s_instance.log_file) { return; }
+    if (!ptr || !atomic_load(mem_Tracker_s_instance.enabled, atomic_MemOrd_acquire)) { return; }
+
+    // Sample before locking, capturing the backtrace is the slow part
+    let sample = mem_Tracker_sampleAlloc(size, src_loc);
 
     // Create new allocation record
-    let alloc = as$(mem_Allocation*, malloc(sizeof(mem_Allocation)));
-    if (!alloc) {
-        // clang-format off
-        $ignore fprintf(mem_Tracker_s_instance.log_file, "Failed to allocate memory for tracker at %s:%d\n",
-            src_loc.file_name, src_loc.line
-        );
-        // clang-format on
+    let hash                       = mem_Tracker_hashPtr(ptr);
+    let shard                      = mem_Tracker_lockShard(hash);
+    var_(stale, mem_Tracker_Entry) = {};
+    let inserted                   = mem_Tracker_insert(shard, (mem_Tracker_Entry){
+        .ptr       = ptr,
+        .size      = size,
+        .src_loc   = src_loc,
+        .timestamp = time_Instant_now(),
+        .sample    = sample,
+    }, hash, &stale);
+    mem_Tracker_unlockShard(shard);
+    if (!inserted) {
+        mem_Tracker_releaseSample(sample);
+        mem_Tracker_record((mem_Tracker_Event){ .kind = mem_Tracker_EventKind_untracked, .ptr = ptr, .src_loc = src_loc });
         return;
     }
-
-    // Fill allocation info
-    alloc->ptr       = ptr;
-    alloc->size      = size;
-    alloc->src_loc   = src_loc;
-    alloc->timestamp = time_Instant_now();
-
-    // Add to linked list
-    alloc->next                        = mem_Tracker_s_instance.allocations;
-    mem_Tracker_s_instance.allocations = alloc;
+    mem_Tracker_releaseSample(stale.sample);
+    if (sample) { mem_Tracker_maybeSnapshot(); }
 
     // Update stats
-    mem_Tracker_s_instance.total_allocated += size;
-    mem_Tracker_s_instance.active_allocs++;
+    let total = atomic_fetchAdd$(usize, &mem_Tracker_s_instance.total_allocated.raw, size - stale.size, atomic_MemOrd_acq_rel) + size - stale.size;
+    if (!stale.ptr) {
+        atomic_fetchAdd$(usize, &mem_Tracker_s_instance.active_allocs.raw, 1, atomic_MemOrd_acq_rel);
+    }
 
-    // clang-format off
-    // Log allocation with total bytes
-    $ignore fprintf(mem_Tracker_s_instance.log_file, "ALLOC: %p (%zu bytes) at %s:%d in %s (Total: %zu bytes)\n",
-        ptr, size, src_loc.file_name, src_loc.line, src_loc.fn_name, mem_Tracker_s_instance.total_allocated
-    );
-    // clang-format on
+    // Record allocation with total bytes
+    mem_Tracker_record((mem_Tracker_Event){
+        .kind    = mem_Tracker_EventKind_alloc,
+        .ptr     = ptr,
+        .size    = size,
+        .total   = total,
+        .src_loc = src_loc,
+    });
 }
 
 fn_(mem_Tracker_registerRemap(anyptr old_ptr, anyptr new_ptr, usize new_size, SrcLoc src_loc), void) {
-    if (!mem_Tracker_s_instance.log_file) { return; }
+    if (!atomic_load(mem_Tracker_s_instance.enabled, atomic_MemOrd_acquire)) { return; }
 
-    // First, find the old allocation
-    usize old_size = 0;
+    // First, find the old allocation (shards are locked one at a time, never nested)
+    usize               old_size   = 0;
+    bool                old_found  = false;
+    mem_Tracker_Sample* old_sample = null; /* Moved allocation keeps its sample */
     if (old_ptr) {
-        mem_Allocation* curr = mem_Tracker_s_instance.allocations;
-        while (curr) {
-            if (curr->ptr == old_ptr) {
-                old_size = curr->size;
-                break;
+        let hash  = mem_Tracker_hashPtr(old_ptr);
+        let shard = mem_Tracker_lockShard(hash);
+        let index = mem_Tracker_findIndex(shard, old_ptr, hash);
+        if (index < shard->cap) {
+            old_found = true;
+            old_size  = shard->entries[index].size;
+            if (old_ptr == new_ptr) {
+                // In-place remap only changes the recorded size
+                shard->entries[index].size    = new_size;
+                shard->entries[index].src_loc = src_loc;
+            } else {
+                old_sample = shard->entries[index].sample;
+                mem_Tracker_removeAt(shard, index);
             }
-            curr = curr->next;
         }
+        mem_Tracker_unlockShard(shard);
     }
 
-    // clang-format off
-    // Log the remap operation
-    $ignore fprintf(mem_Tracker_s_instance.log_file, "REMAP: %p (%zu bytes) -> %p (%zu bytes) at %s:%d in %s\n",
-        old_ptr, old_size, new_ptr, new_size, src_loc.file_name, src_loc.line, src_loc.fn_name
-    );
-    // clang-format on
+    // Record the remap operation
+    mem_Tracker_record((mem_Tracker_Event){
+        .kind     = mem_Tracker_EventKind_remap,
+        .ptr      = new_ptr,
+        .old_ptr  = old_ptr,
+        .size     = new_size,
+        .old_size = old_size,
+        .src_loc  = src_loc,
+    });
 
-    // If we found the old allocation, update it
-    if (0 < old_size) {
-        // For remap, remove the old allocation and add a new one
-        mem_Tracker_registerFree(old_ptr, src_loc);
+    if (old_found) {
+        atomic_fetchSub$(usize, &mem_Tracker_s_instance.total_allocated.raw, old_size, atomic_MemOrd_acq_rel);
+        if (old_ptr == new_ptr) {
+            atomic_fetchAdd$(usize, &mem_Tracker_s_instance.total_allocated.raw, new_size, atomic_MemOrd_acq_rel);
+            return;
+        }
+        atomic_fetchSub$(usize, &mem_Tracker_s_instance.active_allocs.raw, 1, atomic_MemOrd_acq_rel);
     }
 
     // Register the new allocation if it's valid
     if (new_ptr) {
-        mem_Tracker_registerAlloc(new_ptr, new_size, src_loc);
+        let hash                       = mem_Tracker_hashPtr(new_ptr);
+        let shard                      = mem_Tracker_lockShard(hash);
+        var_(stale, mem_Tracker_Entry) = {};
+        let inserted                   = mem_Tracker_insert(shard, (mem_Tracker_Entry){
+            .ptr       = new_ptr,
+            .size      = new_size,
+            .src_loc   = src_loc,
+            .timestamp = time_Instant_now(),
+            .sample    = old_sample,
+        }, hash, &stale);
+        mem_Tracker_unlockShard(shard);
+        if (!inserted) {
+            mem_Tracker_releaseSample(old_sample);
+            mem_Tracker_record((mem_Tracker_Event){ .kind = mem_Tracker_EventKind_untracked, .ptr = new_ptr, .src_loc = src_loc });
+            return;
+        }
+        mem_Tracker_releaseSample(stale.sample);
+        atomic_fetchAdd$(usize, &mem_Tracker_s_instance.total_allocated.raw, new_size - stale.size, atomic_MemOrd_acq_rel);
+        if (!stale.ptr) {
+            atomic_fetchAdd$(usize, &mem_Tracker_s_instance.active_allocs.raw, 1, atomic_MemOrd_acq_rel);
+        }
+    } else {
+        mem_Tracker_releaseSample(old_sample);
     }
 }
 
 fn_(mem_Tracker_registerFree(anyptr ptr, SrcLoc src_loc), bool) {
-    if (!ptr || !mem_Tracker_s_instance.log_file) { return false; }
+    if (!ptr || !atomic_load(mem_Tracker_s_instance.enabled, atomic_MemOrd_acquire)) { return false; }
+
+    // Search for the allocation and take it out of its shard
+    let hash  = mem_Tracker_hashPtr(ptr);
+    let shard = mem_Tracker_lockShard(hash);
+    let index = mem_Tracker_findIndex(shard, ptr, hash);
+    if (shard->cap <= index) {
+        mem_Tracker_unlockShard(shard);
+        // Double free or invalid free detected
+        mem_Tracker_record((mem_Tracker_Event){ .kind = mem_Tracker_EventKind_invalid_free, .ptr = ptr, .src_loc = src_loc });
+        return false;
+    }
+    let entry = shard->entries[index];
+    mem_Tracker_removeAt(shard, index);
+    mem_Tracker_unlockShard(shard);
+    mem_Tracker_releaseSample(entry.sample);
+
+    // Update stats
+    let total = atomic_fetchSub$(usize, &mem_Tracker_s_instance.total_allocated.raw, entry.size, atomic_MemOrd_acq_rel) - entry.size;
+    atomic_fetchSub$(usize, &mem_Tracker_s_instance.active_allocs.raw, 1, atomic_MemOrd_acq_rel);
 
-    mem_Allocation** curr = &mem_Tracker_s_instance.allocations;
+    // Record deallocation with original allocation info
+    mem_Tracker_record((mem_Tracker_Event){
+        .kind         = mem_Tracker_EventKind_free,
+        .ptr          = ptr,
+        .size         = entry.size,
+        .total        = total,
+        .src_loc      = src_loc,
+        .orig_src_loc = entry.src_loc,
+        .age          = time_Instant_durationSince(time_Instant_now(), entry.timestamp),
+    });
+    return true;
+}
+
+fn_scope(mem_Tracker_startProfile(mem_Tracker_ProfileCfg cfg), Err$void) {
+    if (!atomic_load(mem_Tracker_s_instance.enabled, atomic_MemOrd_acquire)) { return_err(io_FileErr_OpenFailed()); }
+    // Room is left for the longest snapshot suffix within a 256 byte path
+    if (Arr_len(mem_Tracker_s_profile.path_prefix) <= cfg.snapshot_path_prefix.len) { return_err(Err_InvalidArgument()); }
+
+    // Reconfigure with sampling paused, samples already taken keep their weights
+    atomic_store(mem_Tracker_s_profile.enabled, false, atomic_MemOrd_release);
+    while (atomic_swap(mem_Tracker_s_profile.writing, true, atomic_MemOrd_acquire)) { atomic_spinLoopHint(); }
+    mem_Tracker_s_profile.sample_interval   = cfg.sample_interval ? cfg.sample_interval : mem_Tracker_profile_default_sample_interval;
+    mem_Tracker_s_profile.snapshot_interval = cfg.snapshot_interval;
+    bti_memset(mem_Tracker_s_profile.path_prefix.buf, 0, sizeof(mem_Tracker_s_profile.path_prefix.buf));
+    mem_copy(mem_Tracker_s_profile.path_prefix.buf, cfg.snapshot_path_prefix.ptr, cfg.snapshot_path_prefix.len);
+    atomic_store(mem_Tracker_s_profile.since_snapshot, 0, atomic_MemOrd_release);
+    atomic_store(mem_Tracker_s_profile.writing, false, atomic_MemOrd_release);
+    atomic_store(mem_Tracker_s_profile.enabled, true, atomic_MemOrd_release);
+    return_ok({});
+} unscoped;
+
+fn_(mem_Tracker_stopProfile(void), void) {
+    atomic_store(mem_Tracker_s_profile.enabled, false, atomic_MemOrd_release);
+}
 
-    // Search for the allocation
-    while (*curr && (*curr)->ptr != ptr) {
-        curr = &(*curr)->next;
+fn_scope(mem_Tracker_writeProfile(Str_const path), Err$void) {
+    Arr$$(256, u8) path_str = Arr_zero();
+    if (Arr_len(path_str) <= path.len) { return_err(Err_InvalidArgument()); }
+    mem_copy(path_str.buf, path.ptr, path.len);
+    if (!mem_Tracker_writeFolded(as$(const char*, path_str.buf))) {
+        return_err(io_FileErr_OpenFailed());
     }
+    return_ok({});
+} unscoped;
 
-    if (!*curr) {
+fn_(mem_Tracker_instance(void), mem_Tracker*) {
+    return &mem_Tracker_s_instance;
+}
+
+/*========== Internal Helper Functions =====================================*/
+
+static fn_(mem_Tracker_hashPtr(anyptr ptr), u64) {
+    // Fibonacci hashing, upper bits are well mixed even though low pointer bits are mostly zero
+    return as$(u64, rawptrToInt(ptr)) * 0x9E3779B97F4A7C15ull;
+}
+
+static fn_(mem_Tracker_lockShard(u64 hash), mem_Tracker_Shard*) {
+    let shard = &mem_Tracker_s_shards[hash >> mem_Tracker_shard_shift];
+    while (atomic_swap(shard->locked, true, atomic_MemOrd_acquire)) {
+        atomic_spinLoopHint();
+    }
+    return shard;
+}
+
+static fn_(mem_Tracker_unlockShard(mem_Tracker_Shard* shard), void) {
+    atomic_store(shard->locked, false, atomic_MemOrd_release);
+}
+
+/// Index of entry for pointer, or shard capacity when it is not tracked
+static fn_(mem_Tracker_findIndex(const mem_Tracker_Shard* shard, anyptr ptr, u64 hash), usize) {
+    // Tables are gone once the report is generated
+    if (shard->cap == 0) { return shard->cap; }
+    let mask  = shard->cap - 1;
+    var index = as$(usize, hash >> mem_Tracker_slot_shift) & mask;
+    while (shard->entries[index].ptr) {
+        if (shard->entries[index].ptr == ptr) { return index; }
+        index = (index + 1) & mask;
+    }
+    return shard->cap;
+}
+
+static fn_(mem_Tracker_insert(mem_Tracker_Shard* shard, mem_Tracker_Entry entry, u64 hash, mem_Tracker_Entry* out_stale), bool) {
+    if (shard->cap == 0) { return false; }
+    // Keep load factor below 3/4, growing by rehashing into a table twice as large
+    if (shard->cap * 3 <= (shard->len + 1) * 4) {
+        let old_entries = shard->entries;
+        let old_cap     = shard->cap;
+        let new_cap     = old_cap * 2;
+        let new_entries = as$(mem_Tracker_Entry*, calloc(new_cap, sizeof(mem_Tracker_Entry)));
+        if (!new_entries) { return false; }
+
+        for (usize i = 0; i < old_cap; ++i) {
+            if (!old_entries[i].ptr) { continue; }
+            var index = as$(usize, mem_Tracker_hashPtr(old_entries[i].ptr) >> mem_Tracker_slot_shift) & (new_cap - 1);
+            while (new_entries[index].ptr) { index = (index + 1) & (new_cap - 1); }
+            new_entries[index] = old_entries[i];
+        }
+        shard->entries = new_entries;
+        shard->cap     = new_cap;
+        free(old_entries);
+    }
+
+    let mask  = shard->cap - 1;
+    var index = as$(usize, hash >> mem_Tracker_slot_shift) & mask;
+    while (shard->entries[index].ptr && shard->entries[index].ptr != entry.ptr) {
+        index = (index + 1) & mask;
+    }
+    // Same address handed out again without free in between: replace stale record
+    *out_stale = shard->entries[index];
+    if (!shard->entries[index].ptr) { shard->len++; }
+    shard->entries[index] = entry;
+    return true;
+}
+
+static fn_(mem_Tracker_removeAt(mem_Tracker_Shard* shard, usize index), void) {
+    // Backward shift deletion keeps probe sequences intact without tombstones
+    let entries = shard->entries;
+    let mask    = shard->cap - 1;
+    var hole    = index;
+    var next    = (hole + 1) & mask;
+    while (entries[next].ptr) {
+        let home = as$(usize, mem_Tracker_hashPtr(entries[next].ptr) >> mem_Tracker_slot_shift) & mask;
+        // Entry may move into hole unless its home lies cyclically within (hole, next]
+        if (((next - hole) & mask) <= ((next - home) & mask)) {
+            entries[hole] = entries[next];
+            hole          = next;
+        }
+        next = (next + 1) & mask;
+    }
+    entries[hole] = (mem_Tracker_Entry){};
+    shard->len--;
+}
+
+static fn_(mem_Tracker_freeEntries(mem_Tracker_Entry* entries, usize cap), void) {
+    if (!entries) { return; }
+    for (usize i = 0; i < cap; ++i) {
+        if (entries[i].ptr) { mem_Tracker_releaseSample(entries[i].sample); }
+    }
+    free(entries);
+}
+
+static fn_(mem_Tracker_lockSpill(void), void) {
+    while (atomic_swap(mem_Tracker_s_instance.spill_locked, true, atomic_MemOrd_acquire)) {
+        atomic_spinLoopHint();
+    }
+}
+
+static fn_(mem_Tracker_unlockSpill(void), void) {
+    atomic_store(mem_Tracker_s_instance.spill_locked, false, atomic_MemOrd_release);
+}
+
+static fn_(mem_Tracker_record(mem_Tracker_Event event), void) {
+    let buf = mem_Tracker_acquireThrdBuf();
+    if (!buf) { return; }
+    if (buf->len == mem_Tracker_event_buf_len) {
+        // Full buffer is merged in bulk, the only point where threads synchronize on events.
+        // Spill lock is always taken before a buffer lock, so the buffer is let go meanwhile
+        mem_Tracker_unlockThrdBuf(buf);
+        mem_Tracker_lockSpill();
+        mem_Tracker_lockThrdBuf(buf);
+        let retired = buf->retired;
+        if (!retired) { mem_Tracker_mergeThrdBuf(buf); }
+        mem_Tracker_unlockSpill();
+        if (retired) {
+            // Report was generated in between, this event comes too late for it
+            mem_Tracker_unlockThrdBuf(buf);
+            return;
+        }
+    }
+    event.thrd_id           = buf->thrd_id;
+    event.seq               = atomic_fetchAdd$(u64, &mem_Tracker_s_instance.next_seq.raw, 1, atomic_MemOrd_monotonic);
+    buf->events[buf->len++] = event;
+    mem_Tracker_unlockThrdBuf(buf);
+}
+
+/// Locked event buffer of the calling thread, registered on first use (null once the report is generated)
+static fn_(mem_Tracker_acquireThrdBuf(void), mem_Tracker_ThrdBuf*) {
+    var buf = mem_Tracker_s_thrd_buf;
+    if (buf) {
+        mem_Tracker_lockThrdBuf(buf);
+        if (!buf->retired) { return buf; }
+        // Merged into a report and unregistered, nothing else refers to it anymore
+        mem_Tracker_unlockThrdBuf(buf);
+        mem_Tracker_s_thrd_buf = null;
+        mem_Tracker_watchThrdExit(null);
+        free(buf);
+    }
+
+    // First event of this thread: create and register its buffer
+    buf = as$(mem_Tracker_ThrdBuf*, malloc(sizeof(mem_Tracker_ThrdBuf)));
+    if (!buf) { return null; }
+    atomic_init(buf->locked, true);
+    buf->retired = false;
+    buf->thrd_id = atomic_fetchAdd$(u32, &mem_Tracker_s_next_thrd_id.raw, 1, atomic_MemOrd_monotonic) + 1;
+    buf->len     = 0;
+    // Registration is ordered against the report by spill lock, so every registered buffer gets merged
+    mem_Tracker_lockSpill();
+    let enabled = atomic_load(mem_Tracker_s_instance.enabled, atomic_MemOrd_acquire);
+    if (enabled) {
+        buf->next                        = mem_Tracker_s_instance.thrd_bufs;
+        mem_Tracker_s_instance.thrd_bufs = buf;
+    }
+    mem_Tracker_unlockSpill();
+    if (!enabled) {
+        free(buf);
+        return null;
+    }
+    mem_Tracker_s_thrd_buf = buf;
+    mem_Tracker_watchThrdExit(buf);
+    return buf;
+}
+
+static fn_(mem_Tracker_lockThrdBuf(mem_Tracker_ThrdBuf* buf), void) {
+    // Uncontended unless the buffer is being merged by another thread
+    while (atomic_swap(buf->locked, true, atomic_MemOrd_acquire)) {
+        atomic_spinLoopHint();
+    }
+}
+
+static fn_(mem_Tracker_unlockThrdBuf(mem_Tracker_ThrdBuf* buf), void) {
+    atomic_store(buf->locked, false, atomic_MemOrd_release);
+}
+
+/// Merge and free the buffer of an exiting thread
+static fn_(mem_Tracker_releaseThrdBuf(mem_Tracker_ThrdBuf* buf), void) {
+    mem_Tracker_lockSpill();
+    mem_Tracker_lockThrdBuf(buf);
+    if (!buf->retired) {
+        mem_Tracker_mergeThrdBuf(buf);
+        var link = &mem_Tracker_s_instance.thrd_bufs;
+        while (*link != buf) { link = &(*link)->next; }
+        *link = buf->next;
+    }
+    mem_Tracker_unlockThrdBuf(buf);
+    mem_Tracker_unlockSpill();
+    if (mem_Tracker_s_thrd_buf == buf) { mem_Tracker_s_thrd_buf = null; }
+    free(buf);
+}
+
+/// Have the calling thread release its buffer on exit (null stops watching)
+static fn_(mem_Tracker_watchThrdExit(mem_Tracker_ThrdBuf* buf), void) {
+#if bti_plat_windows
+    if (mem_Tracker_s_thrd_exit_key != FLS_OUT_OF_INDEXES) {
+        $ignore FlsSetValue(mem_Tracker_s_thrd_exit_key, buf);
+    }
+#elif mem_Tracker_has_thrd_exit
+    if (mem_Tracker_s_thrd_exit_key_valid) {
+        $ignore pthread_setspecific(mem_Tracker_s_thrd_exit_key, buf);
+    }
+#else  /* others */
+    $unused(buf);
+#endif /* others */
+}
+
+/// Spill buffered events of a thread (spill lock and buffer lock must be held)
+static fn_(mem_Tracker_mergeThrdBuf(mem_Tracker_ThrdBuf* buf), void) {
+    if (buf->len == 0) { return; }
+
+    // Spill raw events in one write, source locations stay valid for the whole process
+    if (!mem_Tracker_s_instance.events_spill) {
+        mem_Tracker_s_instance.events_spill = tmpfile();
+    }
+    let written = mem_Tracker_s_instance.events_spill
+                    ? fwrite(buf->events, sizeof(mem_Tracker_Event), buf->len, mem_Tracker_s_instance.events_spill)
+                    : 0;
+    if (written != buf->len) {
+        // No spill file available, format right away so no history is lost
+        mem_Tracker_formatEvents(buf->events + written, buf->len - written);
+    }
+    buf->len = 0;
+}
+
+/// Format spilled events ordered by sequence number (spill lock must be held)
+static fn_(mem_Tracker_formatSpill(FILE* spill), void) {
+    // Spill holds one sorted run per merged buffer, runs of different threads interleave in time
+    var events = as$(mem_Tracker_Event*, null);
+    var len    = as$(usize, 0);
+    if (fseek(spill, 0, SEEK_END) == 0) {
+        let bytes = ftell(spill);
+        if (0 < bytes) {
+            len    = as$(usize, bytes) / sizeof(mem_Tracker_Event);
+            events = as$(mem_Tracker_Event*, malloc(len * sizeof(mem_Tracker_Event)));
+        }
+    }
+    rewind(spill);
+    if (events) {
+        len = fread(events, sizeof(mem_Tracker_Event), len, spill);
+        qsort(events, len, sizeof(mem_Tracker_Event), mem_Tracker_cmpEvent);
+        mem_Tracker_formatEvents(events, len);
+        free(events);
+        return;
+    }
+
+    // Not enough memory to sort the whole history, keep the order events were merged in
+    $ignore fprintf(mem_Tracker_s_instance.log_file, "NOTE: Events below are ordered per thread only\n");
+    Arr$$(256, mem_Tracker_Event) chunk = Arr_zero();
+    while (0 < (len = fread(chunk.buf, sizeof(mem_Tracker_Event), Arr_len(chunk), spill))) {
+        mem_Tracker_formatEvents(chunk.buf, len);
+    }
+}
+
+static fn_(mem_Tracker_formatEvents(const mem_Tracker_Event* events, usize len), void) {
+    let log_file = mem_Tracker_s_instance.log_file;
+    for (usize i = 0; i < len; ++i) {
+        let event = &events[i];
+        // Thread and global sequence number
+        $ignore fprintf(log_file, "[T%u #%llu] ", event->thrd_id, as$(unsigned long long, event->seq));
         // clang-format off
-        // Double free or invalid free detected
-        $ignore fprintf(mem_Tracker_s_instance.log_file, "ERROR: DOUBLE FREE or INVALID FREE of %p at %s:%d in %s\n",
-            ptr, src_loc.file_name, src_loc.line, src_loc.fn_name
-        );
+        switch (event->kind) {
+        case mem_Tracker_EventKind_alloc:
+            $ignore fprintf(log_file, "ALLOC: %p (%zu bytes) at %s:%d in %s (Total: %zu bytes)\n",
+                event->ptr, event->size, event->src_loc.file_name, event->src_loc.line, event->src_loc.fn_name, event->total
+            );
+            break;
+        case mem_Tracker_EventKind_remap:
+            $ignore fprintf(log_file, "REMAP: %p (%zu bytes) -> %p (%zu bytes) at %s:%d in %s\n",
+                event->old_ptr, event->old_size, event->ptr, event->size, event->src_loc.file_name, event->src_loc.line, event->src_loc.fn_name
+            );
+            break;
+        case mem_Tracker_EventKind_free:
+            $ignore fprintf(log_file,
+                "FREE: %p (%zu bytes) at %s:%d in %s\n"
+                "      Originally allocated at %s:%d in %s (%.2f seconds ago)\n"
+                "      (Total remaining: %zu bytes)\n",
+                event->ptr, event->size, event->src_loc.file_name, event->src_loc.line, event->src_loc.fn_name,
+                event->orig_src_loc.file_name, event->orig_src_loc.line, event->orig_src_loc.fn_name, time_Duration_asSecs_f64(event->age),
+                event->total
+            );
+            break;
+        case mem_Tracker_EventKind_invalid_free:
+            $ignore fprintf(log_file, "ERROR: DOUBLE FREE or INVALID FREE of %p at %s:%d in %s\n",
+                event->ptr, event->src_loc.file_name, event->src_loc.line, event->src_loc.fn_name
+            );
+            break;
+        case mem_Tracker_EventKind_untracked:
+            $ignore fprintf(log_file, "Failed to allocate memory for tracker at %s:%d\n",
+                event->src_loc.file_name, event->src_loc.line
+            );
+            break;
+        }
         // clang-format on
-        return false;
     }
+}
 
-    // Calculate elapsed time since allocation
-    let elapsed     = time_Instant_durationSince(time_Instant_now(), (*curr)->timestamp);
-    let elapsed_sec = time_Duration_asSecs_f64(elapsed);
+static fn_(mem_Tracker_cmpEvent(const void* lhs, const void* rhs), int) {
+    return prim_cmp(as$(const mem_Tracker_Event*, lhs)->seq, as$(const mem_Tracker_Event*, rhs)->seq);
+}
 
-    // Get the original allocation info
-    let orig_size    = (*curr)->size;
-    let orig_src_loc = (*curr)->src_loc;
+static fn_(mem_Tracker_isSameSite(SrcLoc lhs, SrcLoc rhs), bool) {
+    return lhs.line == rhs.line
+        && Str_eql(Str_viewZ(as$(const u8*, lhs.file_name)), Str_viewZ(as$(const u8*, rhs.file_name)))
+        && Str_eql(Str_viewZ(as$(const u8*, lhs.fn_name)), Str_viewZ(as$(const u8*, rhs.fn_name)));
+}
 
-    // Update stats
-    mem_Tracker_s_instance.total_allocated -= orig_size;
-    mem_Tracker_s_instance.active_allocs--;
+static no_inline fn_(mem_Tracker_sampleAlloc(usize size, SrcLoc src_loc), mem_Tracker_Sample*) {
+    if (!atomic_load(mem_Tracker_s_profile.enabled, atomic_MemOrd_acquire)) { return null; }
 
-    // clang-format off
-    // Log deallocation with details
-    $ignore fprintf(mem_Tracker_s_instance.log_file,
-        "FREE: %p (%zu bytes) at %s:%d in %s\n"
-        "      Originally allocated at %s:%d in %s (%.2f seconds ago)\n"
-        "      (Total remaining: %zu bytes)\n",
-        ptr, orig_size, src_loc.file_name, src_loc.line, src_loc.fn_name,
-        orig_src_loc.file_name, orig_src_loc.line, orig_src_loc.fn_name, elapsed_sec,
-        mem_Tracker_s_instance.total_allocated
-    );
-    // clang-format on
+    // Each thread counts down bytes to its next sampling point
+    let interval = mem_Tracker_s_profile.sample_interval;
+    var left     = mem_Tracker_s_sample_bytes_left;
+    if (left == 0 || interval < left) { left = interval; }
+    if (size < left) {
+        mem_Tracker_s_sample_bytes_left = left - size;
+        return null;
+    }
+    // Allocation covers every sampling point it crosses, so large allocations are weighted by their size
+    let crossed                     = 1 + (size - left) / interval;
+    mem_Tracker_s_sample_bytes_left = interval - (size - left) % interval;
 
-    // Remove from list
-    mem_Allocation* to_free = *curr;
-    *curr                   = to_free->next;
-    free(to_free);
-    return true;
+    let sample = as$(mem_Tracker_Sample*, malloc(sizeof(mem_Tracker_Sample)));
+    if (!sample) { return null; }
+    sample->weight     = crossed * interval;
+    sample->src_loc    = src_loc;
+    sample->frames_len = mem_Tracker_captureStack(sample->frames, mem_Tracker_profile_max_frames);
+
+    let live = atomic_fetchAdd$(usize, &mem_Tracker_s_profile.live_bytes.raw, sample->weight, atomic_MemOrd_acq_rel) + sample->weight;
+    var peak = atomic_load(mem_Tracker_s_profile.peak_bytes, atomic_MemOrd_monotonic);
+    while (peak < live && !atomic_cmpxchgWeak$(usize, &mem_Tracker_s_profile.peak_bytes.raw, &peak, live, atomic_MemOrd_release, atomic_MemOrd_monotonic)) {}
+    atomic_fetchAdd$(usize, &mem_Tracker_s_profile.live_samples.raw, 1, atomic_MemOrd_acq_rel);
+    atomic_fetchAdd$(usize, &mem_Tracker_s_profile.since_snapshot.raw, sample->weight, atomic_MemOrd_acq_rel);
+    return sample;
 }
 
-fn_(mem_Tracker_instance(void), mem_Tracker*) {
-    return &mem_Tracker_s_instance;
+static no_inline fn_(mem_Tracker_captureStack(anyptr* frames, u32 frames_cap), u32) {
+#if bti_plat_windows
+    return as$(u32, RtlCaptureStackBackTrace(mem_Tracker_profile_skip_frames, frames_cap, frames, null));
+#elif mem_Tracker_has_backtrace
+    anyptr raw[mem_Tracker_profile_max_frames + mem_Tracker_profile_skip_frames] = {};
+    let    raw_len = as$(u32, prim_max(backtrace(raw, as$(int, frames_cap + mem_Tracker_profile_skip_frames)), 0));
+    if (raw_len <= mem_Tracker_profile_skip_frames) { return 0; }
+    let len = raw_len - mem_Tracker_profile_skip_frames;
+    mem_copy(frames, raw + mem_Tracker_profile_skip_frames, len * sizeof(anyptr));
+    return len;
+#else  /* others */
+    $unused(frames, frames_cap);
+    // Without unwinder samples are attributed to their allocation site only
+    return 0;
+#endif /* others */
+}
+
+static fn_(mem_Tracker_releaseSample(mem_Tracker_Sample* sample), void) {
+    if (!sample) { return; }
+    atomic_fetchSub$(usize, &mem_Tracker_s_profile.live_bytes.raw, sample->weight, atomic_MemOrd_acq_rel);
+    atomic_fetchSub$(usize, &mem_Tracker_s_profile.live_samples.raw, 1, atomic_MemOrd_acq_rel);
+    free(sample);
+}
+
+static fn_(mem_Tracker_maybeSnapshot(void), void) {
+    let step = mem_Tracker_s_profile.snapshot_interval;
+    if (step == 0) { return; }
+
+    let since       = atomic_load(mem_Tracker_s_profile.since_snapshot, atomic_MemOrd_acquire);
+    let live        = atomic_load(mem_Tracker_s_profile.live_bytes, atomic_MemOrd_acquire);
+    let is_periodic = step <= since;
+    let is_peak     = atomic_load(mem_Tracker_s_profile.peak_written, atomic_MemOrd_acquire) + step <= live;
+    if (!is_periodic && !is_peak) { return; }
+    // Skip when another thread is already writing, it captures nearly the same heap
+    if (atomic_swap(mem_Tracker_s_profile.writing, true, atomic_MemOrd_acquire)) { return; }
+
+    let            prefix = as$(const char*, mem_Tracker_s_profile.path_prefix.buf);
+    Arr$$(256, u8) path   = Arr_zero();
+    if (is_periodic) {
+        atomic_fetchSub$(usize, &mem_Tracker_s_profile.since_snapshot.raw, since, atomic_MemOrd_acq_rel);
+        let path_len = snprintf(as$(char*, path.buf), Arr_len(path), "%s-%zu.folded", prefix, mem_Tracker_s_profile.snapshot_count++);
+        // Truncated path would name a different file
+        if (0 <= path_len && as$(usize, path_len) < Arr_len(path)) {
+            $ignore mem_Tracker_writeFolded(as$(const char*, path.buf));
+        }
+    }
+    if (is_peak) {
+        // Overwritten on every new high, so the file ends up holding the heap at its peak
+        atomic_store(mem_Tracker_s_profile.peak_written, live, atomic_MemOrd_release);
+        let path_len = snprintf(as$(char*, path.buf), Arr_len(path), "%s-peak.folded", prefix);
+        if (0 <= path_len && as$(usize, path_len) < Arr_len(path)) {
+            $ignore mem_Tracker_writeFolded(as$(const char*, path.buf));
+        }
+    }
+    atomic_store(mem_Tracker_s_profile.writing, false, atomic_MemOrd_release);
+}
+
+static fn_(mem_Tracker_writeFolded(const char* path), bool) {
+    // Copy live samples one shard at a time, so allocating threads are only briefly blocked
+    let   samples_cap = atomic_load(mem_Tracker_s_profile.live_samples, atomic_MemOrd_acquire) + mem_Tracker_shard_count;
+    let   samples     = as$(mem_Tracker_Sample*, malloc(samples_cap * sizeof(mem_Tracker_Sample)));
+    usize samples_len = 0;
+    if (!samples) { return false; }
+    for (usize shard_index = 0; shard_index < mem_Tracker_shard_count; ++shard_index) {
+        let shard = &mem_Tracker_s_shards[shard_index];
+        while (atomic_swap(shard->locked, true, atomic_MemOrd_acquire)) { atomic_spinLoopHint(); }
+        for (usize i = 0; i < shard->cap && samples_len < samples_cap; ++i) {
+            if (!shard->entries[i].ptr || !shard->entries[i].sample) { continue; }
+            samples[samples_len++] = *shard->entries[i].sample;
+        }
+        mem_Tracker_unlockShard(shard);
+    }
+
+    let file = fopen(path, "w");
+    if (!file) {
+        free(samples);
+        return false;
+    }
+
+    // Identical stacks become adjacent, each distinct stack is written once with summed weight
+    qsort(samples, samples_len, sizeof(mem_Tracker_Sample), mem_Tracker_cmpSample);
+    for (usize begin = 0, end = 0; begin < samples_len; begin = end) {
+        usize weight = 0;
+        for (end = begin; end < samples_len && mem_Tracker_cmpSample(&samples[begin], &samples[end]) == 0; ++end) {
+            weight += samples[end].weight;
+        }
+
+        // Collapsed stack runs root to leaf, ending with the allocation site
+        let sample = &samples[begin];
+        for (u32 i = sample->frames_len; 0 < i; --i) {
+            mem_Tracker_writeFrame(file, sample->frames[i - 1]);
+            $ignore fputc(';', file);
+        }
+        $ignore fprintf(file, "%s [%s:%d] %zu\n", sample->src_loc.fn_name, sample->src_loc.file_name, sample->src_loc.line, weight);
+    }
+
+    free(samples);
+    return fclose(file) == 0;
+}
+
+static fn_(mem_Tracker_cmpSample(const void* lhs, const void* rhs), int) {
+    let l = as$(const mem_Tracker_Sample*, lhs);
+    let r = as$(const mem_Tracker_Sample*, rhs);
+    if (l->src_loc.line != r->src_loc.line) { return l->src_loc.line < r->src_loc.line ? -1 : 1; }
+    if (l->src_loc.file_name != r->src_loc.file_name) { return rawptrToInt(l->src_loc.file_name) < rawptrToInt(r->src_loc.file_name) ? -1 : 1; }
+    if (l->src_loc.fn_name != r->src_loc.fn_name) { return rawptrToInt(l->src_loc.fn_name) < rawptrToInt(r->src_loc.fn_name) ? -1 : 1; }
+    if (l->frames_len != r->frames_len) { return l->frames_len < r->frames_len ? -1 : 1; }
+    return bti_memcmp(l->frames, r->frames, l->frames_len * sizeof(anyptr));
+}
+
+static fn_(mem_Tracker_writeFrame(FILE* file, anyptr frame), void) {
+#if !bti_plat_windows && mem_Tracker_has_backtrace
+    // Symbolized only when written, sampling itself just stores return addresses
+    Dl_info info = {};
+    if (dladdr(frame, &info) && info.dli_sname) {
+        $ignore fputs(info.dli_sname, file);
+        return;
+    }
+#endif /* !bti_plat_windows && mem_Tracker_has_backtrace */
+    $ignore fprintf(file, "%p", frame);
 }
 
 #endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */
@@ -0,0 +1,107 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/BTreeMap.h"
+
+use_BTreeMap$(i64, i64);
+use_Opt$(Ptr$i64);
+
+static fn_(cmpI64(anyptr_const lhs, anyptr_const rhs), cmp_Ord) {
+    return prim_cmp(*as$(const i64*, lhs), *as$(const i64*, rhs));
+}
+
+fn_TEST_scope_ext("BTreeMap Keeps Order Through Splits And Merges") {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(BTreeMap$i64$i64, BTreeMap_init(typeInfo$(i64), typeInfo$(i64), wrapFn(cmpI64), heap_Classic_allocator(&classic)));
+    defer_(BTreeMap_fini(map.base));
+
+    // Scrambled inserts of 0 .. 999 split leaves and inner nodes
+    for (i64 i = 0; i < 1000; ++i) {
+        var_(key, i64) = (i * 7919) % 1000;
+        var_(val, i64) = key * 2;
+        try_(BTreeMap_put(map.base, meta_refPtr(&key), meta_refPtr(&val)));
+    }
+    try_(TEST_expect(map.len == 1000 && 1 < map.height));
+
+    var_(key, i64) = 500;
+    var_(val, i64) = -1;
+    try_(BTreeMap_put(map.base, meta_refPtr(&key), meta_refPtr(&val)));
+    let found = meta_castOpt$(Opt$Ptr$i64, BTreeMap_getPtr(map.base, meta_refPtr(&key)));
+    try_(TEST_expect(map.len == 1000 && isSome(found) && *unwrap(found) == -1));
+
+    var expected = as$(i64, 0);
+    var cursor   = BTreeMap_iter(map.base);
+    for (var entry = BTreeMap_Cursor_next(&cursor); isSome(entry); entry = BTreeMap_Cursor_next(&cursor)) {
+        try_(TEST_expect(*as$(const i64*, unwrap(entry).key.addr) == expected));
+        expected++;
+    }
+    try_(TEST_expect(expected == 1000));
+
+    // Removing every even key underfills nodes until they borrow or merge
+    for (i64 i = 0; i < 1000; i += 2) {
+        var_(gone, i64) = i;
+        try_(TEST_expect(BTreeMap_remove(map.base, meta_refPtr(&gone))));
+    }
+    try_(TEST_expect(map.len == 500 && !BTreeMap_contains(map.base, meta_refPtr(&key))));
+
+    expected = 1;
+    cursor   = BTreeMap_iter(map.base);
+    for (var entry = BTreeMap_Cursor_next(&cursor); isSome(entry); entry = BTreeMap_Cursor_next(&cursor)) {
+        try_(TEST_expect(*as$(const i64*, unwrap(entry).key.addr) == expected));
+        try_(TEST_expect(*meta_castPtr$(i64*, unwrap(entry).val) == expected * 2));
+        expected += 2;
+    }
+    try_(TEST_expect(expected == 1001));
+
+    for (i64 i = 1; i < 1000; i += 2) {
+        var_(gone, i64) = i;
+        try_(TEST_expect(BTreeMap_remove(map.base, meta_refPtr(&gone))));
+    }
+    try_(TEST_expect(map.len == 0 && map.root == null));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("BTreeMap Bulk Loads Sorted Slice And Walks Ranges") {
+    static i64 keys[777] = { 0 };
+    static i64 vals[777] = { 0 };
+    for (usize i = 0; i < countOf(keys); ++i) {
+        keys[i] = as$(i64, i) * 3;
+        vals[i] = as$(i64, i);
+    }
+    var_(classic, heap_Classic) = {};
+    let key_sli                 = (meta_Sli_const){ .type = typeInfo$(i64), .addr = keys, .len = countOf(keys) };
+    let val_sli                 = (meta_Sli_const){ .type = typeInfo$(i64), .addr = vals, .len = countOf(vals) };
+    var map                     = type$(BTreeMap$i64$i64, try_(BTreeMap_initSorted(key_sli, val_sli, wrapFn(cmpI64), heap_Classic_allocator(&classic))));
+    defer_(BTreeMap_fini(map.base));
+    try_(TEST_expect(map.len == countOf(keys)));
+
+    // Keys in [100, 200) are the multiples of 3 from 102 to 198
+    var_(lo, i64) = 100;
+    var_(hi, i64) = 200;
+    var count     = as$(usize, 0);
+    var expected  = as$(i64, 102);
+    var cursor    = BTreeMap_range(map.base, meta_refPtr(&lo), meta_refPtr(&hi));
+    for (var entry = BTreeMap_Cursor_next(&cursor); isSome(entry); entry = BTreeMap_Cursor_next(&cursor)) {
+        try_(TEST_expect(*as$(const i64*, unwrap(entry).key.addr) == expected));
+        expected += 3;
+        count++;
+    }
+    try_(TEST_expect(count == 33));
+
+    var_(at, i64) = 300;
+    var lower     = BTreeMap_lowerBound(map.base, meta_refPtr(&at));
+    var upper     = BTreeMap_upperBound(map.base, meta_refPtr(&at));
+    try_(TEST_expect(*as$(const i64*, unwrap(BTreeMap_Cursor_peek(&lower)).key.addr) == 300));
+    try_(TEST_expect(*as$(const i64*, unwrap(BTreeMap_Cursor_peek(&upper)).key.addr) == 303));
+
+    // Bulk-loaded tree keeps accepting inserts in between existing keys
+    for (i64 i = 1; i < 300; i += 3) {
+        var_(key, i64) = i;
+        let result     = try_(BTreeMap_getOrPut(map.base, meta_refPtr(&key)));
+        try_(TEST_expect(!result.found_existing));
+        *meta_castPtr$(i64*, result.val) = -i;
+    }
+    var_(last, i64) = 776 * 3;
+    upper           = BTreeMap_upperBound(map.base, meta_refPtr(&last));
+    try_(TEST_expect(map.len == countOf(keys) + 100 && isNone(BTreeMap_Cursor_peek(&upper))));
+} TEST_unscoped_ext;
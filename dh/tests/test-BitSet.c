@@ -0,0 +1,77 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/BitSet.h"
+
+fn_TEST_scope("BitSet Fixed Storage Set And Test") {
+    var set = BitSet_fixed$(100);
+    try_(TEST_expect(BitSet_count(set) == 0));
+
+    BitSet_set(set, 0);
+    BitSet_set(set, 63);
+    BitSet_set(set, 64);
+    BitSet_setValue(set, 99, true);
+    BitSet_toggle(set, 63);
+    try_(TEST_expect(BitSet_isSet(set, 0)));
+    try_(TEST_expect(!BitSet_isSet(set, 63)));
+    try_(TEST_expect(BitSet_isSet(set, 64)));
+    try_(TEST_expect(BitSet_isSet(set, 99)));
+    try_(TEST_expect(BitSet_count(set) == 3));
+
+    // Toggling all keeps bits past the length zero
+    BitSet_toggleAll(set);
+    try_(TEST_expect(BitSet_count(set) == 97));
+    try_(TEST_expect(set.words[1] >> 36 == 0));
+} TEST_unscoped;
+
+fn_TEST_scope_ext("DynBitSet Bulk Operations Across Words") {
+    var_(classic, heap_Classic) = {};
+    let allocator               = heap_Classic_allocator(&classic);
+
+    var lhs = try_(DynBitSet_initEmpty(allocator, 200));
+    defer_(DynBitSet_fini(&lhs));
+    var rhs = try_(DynBitSet_initEmpty(allocator, 200));
+    defer_(DynBitSet_fini(&rhs));
+
+    BitSet_setRangeValue(lhs.set, 10, 150, true);
+    BitSet_setRangeValue(rhs.set, 100, 200, true);
+    try_(TEST_expect(BitSet_count(lhs.set) == 140));
+
+    var both = try_(DynBitSet_clone(&lhs, allocator));
+    defer_(DynBitSet_fini(&both));
+    BitSet_and(both.set, rhs.set);
+    try_(TEST_expect(BitSet_count(both.set) == 50));
+
+    BitSet_andNot(lhs.set, both.set);
+    try_(TEST_expect(BitSet_count(lhs.set) == 90));
+    BitSet_or(lhs.set, rhs.set);
+    try_(TEST_expect(BitSet_count(lhs.set) == 190));
+    BitSet_xor(lhs.set, rhs.set);
+    try_(TEST_expect(BitSet_count(lhs.set) == 90));
+
+    // Remaining bits are [10, 100), visited in ascending order
+    let first = BitSet_findFirstSet(lhs.set);
+    try_(TEST_expect(isSome(first) && unwrap(first) == 10));
+    var expected = as$(usize, 10);
+    var iter     = BitSet_iter(lhs.set);
+    for (var index = BitSet_Iter_next(&iter); isSome(index); index = BitSet_Iter_next(&iter)) {
+        try_(TEST_expect(unwrap(index) == expected));
+        expected += 1;
+    }
+    try_(TEST_expect(expected == 100));
+
+    // Growing fills new bits, shrinking drops them
+    try_(DynBitSet_resize(&rhs, 300, true));
+    try_(TEST_expect(BitSet_count(rhs.set) == 200));
+    try_(DynBitSet_resize(&rhs, 150, false));
+    try_(TEST_expect(BitSet_count(rhs.set) == 50));
+
+    // Same length, differing only in the last bit of the partial tail word
+    var other = try_(DynBitSet_clone(&rhs, allocator));
+    defer_(DynBitSet_fini(&other));
+    try_(TEST_expect(BitSet_eql(rhs.set, other.set)));
+    BitSet_toggle(other.set, 149);
+    try_(TEST_expect(BitSet_count(other.set) == 49));
+    try_(TEST_expect(!BitSet_eql(rhs.set, other.set)));
+} TEST_unscoped_ext;
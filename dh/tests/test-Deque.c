@@ -0,0 +1,72 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/heap/Page.h"
+#include "dh/Deque.h"
+
+use_Deque$(i32);
+use_Opt$(Ptr$i32);
+
+fn_TEST_scope_ext("Deque Keeps Order Across Wrap And Growth") {
+    var_(classic, heap_Classic) = {};
+    var deque                   = type$(Deque$i32, Deque_init(typeInfo$(i32), heap_Classic_allocator(&classic)));
+    defer_(Deque_fini(deque.base));
+
+    // Front pushes wrap head around before the first growth
+    for (i32 i = 0; i < 4; ++i) {
+        var back  = 10 + i;
+        var front = -1 - i;
+        try_(Deque_pushBack(deque.base, meta_refPtr(&back)));
+        try_(Deque_pushFront(deque.base, meta_refPtr(&front)));
+    }
+    for (i32 i = 14; i < 40; ++i) {
+        try_(Deque_pushBack(deque.base, meta_refPtr(&i)));
+    }
+    try_(TEST_expect(deque.len == 34));
+
+    // Front is -4 .. -1, then 10 .. 39
+    let halves = Deque_halves(deque.base);
+    try_(TEST_expect(halves.first.len + halves.second.len == 34));
+    for (usize i = 0; i < deque.len; ++i) {
+        let expected = i < 4 ? as$(i32, i) - 4 : as$(i32, i) + 6;
+        try_(TEST_expect(*meta_castPtr$(i32*, Deque_at(deque.base, i)) == expected));
+    }
+
+    let front = meta_castOpt$(Opt$Ptr$i32, Deque_popFront(deque.base));
+    let back  = meta_castOpt$(Opt$Ptr$i32, Deque_popBack(deque.base));
+    try_(TEST_expect(isSome(front) && *unwrap(front) == -4));
+    try_(TEST_expect(isSome(back) && *unwrap(back) == 39));
+
+    while (isSome(Deque_popFront(deque.base))) {}
+    try_(TEST_expect(deque.len == 0));
+    try_(TEST_expect(isNone(Deque_popBack(deque.base))));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Deque Grows In Place Moving Only The Wrapped Run") {
+    // Page allocator grows a block in place within its pages, heap_Classic never does
+    var_(page, heap_Page) = heap_Page_init((heap_Page_Opts){});
+    var deque             = type$(Deque$i32, Deque_init(typeInfo$(i32), heap_Page_allocator(&page)));
+    defer_(Deque_fini(deque.base));
+
+    for (i32 i = 0; i < 3; ++i) {
+        var back  = i;
+        var front = -1 - i;
+        try_(Deque_pushBack(deque.base, meta_refPtr(&back)));
+        try_(Deque_pushFront(deque.base, meta_refPtr(&front)));
+    }
+    // Head sits near the end of the buffer, so the back items wrap to its start
+    let old_buf = deque.buf;
+    let old_cap = deque.cap;
+    try_(TEST_expect(old_cap < deque.head + deque.len));
+
+    for (i32 i = 3; deque.len <= old_cap; ++i) {
+        try_(Deque_pushBack(deque.base, meta_refPtr(&i)));
+    }
+    try_(TEST_expect(deque.buf == old_buf && old_cap < deque.cap));
+
+    // Front is -3 .. -1, then 0 .. len - 4
+    for (usize i = 0; i < deque.len; ++i) {
+        try_(TEST_expect(*meta_castPtr$(i32*, Deque_at(deque.base, i)) == as$(i32, i) - 3));
+    }
+} TEST_unscoped_ext;
@@ -0,0 +1,66 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/HashMap.h"
+
+use_HashMap$(i32, i64);
+use_HashMap$(Str_const, i32);
+use_Opt$(Ptr$i32);
+use_Opt$(Ptr$i64);
+
+fn_TEST_scope_ext("HashMap Put Get Remove Across Growth") {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(HashMap$i32$i64, HashMap_init(typeInfo$(i32), typeInfo$(i64), (HashMap_Ctx){}, heap_Classic_allocator(&classic)));
+    defer_(HashMap_fini(map.base));
+
+    // Enough entries to rehash several times
+    for (i32 key = 0; key < 1000; ++key) {
+        var val = as$(i64, key) * 3;
+        try_(HashMap_put(map.base, meta_refPtr(&key), meta_refPtr(&val)));
+    }
+    try_(TEST_expect(map.len == 1000));
+
+    // Remove every even key, tombstones must not hide odd keys
+    for (i32 key = 0; key < 1000; key += 2) {
+        try_(TEST_expect(HashMap_remove(map.base, meta_refPtr(&key))));
+    }
+    try_(TEST_expect(map.len == 500));
+    for (i32 key = 0; key < 1000; ++key) {
+        let val = meta_castOpt$(Opt$Ptr$i64, HashMap_getPtr(map.base, meta_refPtr(&key)));
+        if (key % 2 == 0) {
+            try_(TEST_expect(isNone(val)));
+        } else {
+            try_(TEST_expect(isSome(val) && *unwrap(val) == as$(i64, key) * 3));
+        }
+    }
+
+    // Iteration visits each remaining entry once
+    var   iter  = HashMap_iter(map.base);
+    usize count = 0;
+    for (var entry = HashMap_Iter_next(&iter); isSome(entry); entry = HashMap_Iter_next(&iter)) {
+        try_(TEST_expect(*meta_castPtr$(i32*, unwrap(entry).key) % 2 == 1));
+        count++;
+    }
+    try_(TEST_expect(count == 500));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("HashMap Counts Str Keys By Content") {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(HashMap$Str_const$i32, HashMap_init(typeInfo$(Str_const), typeInfo$(i32), HashMap_Ctx_str(), heap_Classic_allocator(&classic)));
+    defer_(HashMap_fini(map.base));
+
+    let words = Str_l("b a c a b a");
+    for (usize i = 0; i < words.len; i += 2) {
+        var word   = Str_slice(words, i, i + 1);
+        let result = try_(HashMap_getOrPut(map.base, meta_refPtr(&word)));
+        if (!result.found_existing) { *meta_castPtr$(i32*, result.val) = 0; }
+        *meta_castPtr$(i32*, result.val) += 1;
+    }
+    try_(TEST_expect(map.len == 3));
+
+    // Lookup key points to different memory than the inserted one
+    var_(key, Str_const) = Str_l("a");
+    let count            = meta_castOpt$(Opt$Ptr$i32, HashMap_getPtr(map.base, meta_refPtr(&key)));
+    try_(TEST_expect(isSome(count) && *unwrap(count) == 3));
+} TEST_unscoped_ext;
@@ -0,0 +1,36 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/HashSet.h"
+
+use_HashSet$(i32);
+
+fn_TEST_scope_ext("HashSet Deduplicates Elements") {
+    var_(classic, heap_Classic) = {};
+    var set                     = type$(HashSet$i32, HashSet_init(typeInfo$(i32), (HashMap_Ctx){}, heap_Classic_allocator(&classic)));
+    defer_(HashSet_fini(set.base));
+
+    // Every value appears three times
+    usize added = 0;
+    for (i32 i = 0; i < 300; ++i) {
+        var elem = i % 100;
+        added += try_(HashSet_insert(set.base, meta_refPtr(&elem)));
+    }
+    try_(TEST_expect(added == 100));
+    try_(TEST_expect(set.len == 100));
+
+    var_(missing, i32) = 100;
+    try_(TEST_expect(!HashSet_contains(set.base, meta_refPtr(&missing))));
+    for (i32 elem = 0; elem < 100; elem += 2) {
+        try_(TEST_expect(HashSet_remove(set.base, meta_refPtr(&elem))));
+    }
+
+    var   iter  = HashSet_iter(set.base);
+    usize count = 0;
+    for (var elem = HashSet_Iter_next(&iter); isSome(elem); elem = HashSet_Iter_next(&iter)) {
+        try_(TEST_expect(*meta_castPtr$(i32*, unwrap(elem)) % 2 == 1));
+        count++;
+    }
+    try_(TEST_expect(count == 50));
+} TEST_unscoped_ext;
@@ -0,0 +1,47 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/IntMap.h"
+
+use_IntMap$(u32, u32);
+use_Opt$(Ptr$u32);
+
+fn_TEST_scope_ext("IntMap Backward Shift Keeps Clusters Reachable") {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(IntMap$u32$u32, IntMap_init(typeInfo$(u32), typeInfo$(u32), heap_Classic_allocator(&classic)));
+    defer_(IntMap_fini(map.base));
+
+    // Key zero lives outside the table
+    for (u32 key = 0; key < 2000; ++key) {
+        var val = key + 1;
+        try_(IntMap_put(map.base, key, meta_refPtr(&val)));
+    }
+    try_(TEST_expect(map.len == 2000));
+
+    // Remove every third key, including zero, then check all remaining ones
+    for (u32 key = 0; key < 2000; key += 3) {
+        try_(TEST_expect(IntMap_remove(map.base, key)));
+    }
+    for (u32 key = 0; key < 2000; ++key) {
+        let val = meta_castOpt$(Opt$Ptr$u32, IntMap_getPtr(map.base, key));
+        if (key % 3 == 0) {
+            try_(TEST_expect(isNone(val)));
+        } else {
+            try_(TEST_expect(isSome(val) && *unwrap(val) == key + 1));
+        }
+    }
+
+    // Reinserting key zero reuses its slot
+    let result = try_(IntMap_getOrPut(map.base, 0));
+    try_(TEST_expect(!result.found_existing));
+    *meta_castPtr$(u32*, result.val) = 42;
+
+    var   iter  = IntMap_iter(map.base);
+    usize count = 0;
+    for (var entry = IntMap_Iter_next(&iter); isSome(entry); entry = IntMap_Iter_next(&iter)) {
+        try_(TEST_expect(unwrap(entry).key == 0 || unwrap(entry).key % 3 != 0));
+        count++;
+    }
+    try_(TEST_expect(count == map.len));
+} TEST_unscoped_ext;
@@ -0,0 +1,106 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/heap/Pool.h"
+#include "dh/ListUnrolled.h"
+
+use_ListUnrolled$(i32);
+use_Opt$(Ptr$i32);
+
+/// Every node but the last holds at least half of its capacity
+static fn_(test_isDense(const ListUnrolled* list), bool) {
+    for (var node = list->first; node != null && node->next != null; node = node->next) {
+        if (node->len < list->node_cap / 2) { return false; }
+    }
+    return true;
+}
+
+fn_TEST_scope_ext("ListUnrolled Splits, Merges And Splices Pool Backed Nodes") {
+    var_(classic, heap_Classic) = {};
+    var_(pool, heap_Pool)       = heap_Pool_init(heap_Classic_allocator(&classic), ListUnrolled_nodeType(typeInfo$(i32)));
+    defer_(heap_Pool_fini(pool));
+
+    var list = type$(ListUnrolled$i32, ListUnrolled_init(typeInfo$(i32), heap_Pool_allocator(&pool)));
+    defer_(ListUnrolled_fini(list.base));
+    for (i32 i = 0; i < 200; ++i) {
+        var_(item, i32) = i;
+        try_(ListUnrolled_append(list.base, meta_refPtr(&item)));
+    }
+    // Sequential appends fill every node but the last
+    try_(TEST_expect(ListUnrolled_len(list.base) == 200 && list.first->len == list.node_cap));
+
+    // Inserting into a full node splits it, neighbors keep their order
+    var_(marker, i32) = -1;
+    let inserted      = try_(ListUnrolled_insertAt(list.base, ListUnrolled_posAt(list.base, 30), meta_refPtr(&marker)));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, inserted)) == -1));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, ListUnrolled_next(list.base, inserted))) == 30));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, ListUnrolled_posAt(list.base, 29))) == 29));
+    let after = ListUnrolled_removeAt(list.base, inserted);
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, after)) == 30));
+
+    // Removing every even item drains nodes until they borrow or merge
+    for (var pos = ListUnrolled_front(list.base); pos.node != null;) {
+        if (*meta_castPtr$(i32*, ListUnrolled_get(list.base, pos)) % 2 == 0) {
+            pos = ListUnrolled_removeAt(list.base, pos);
+        } else {
+            pos = ListUnrolled_next(list.base, pos);
+        }
+    }
+    try_(TEST_expect(ListUnrolled_len(list.base) == 100 && test_isDense(list.base)));
+
+    var tail = type$(ListUnrolled$i32, ListUnrolled_init(typeInfo$(i32), heap_Pool_allocator(&pool)));
+    defer_(ListUnrolled_fini(tail.base));
+    for (i32 i = 200; i < 210; ++i) {
+        var_(item, i32) = i;
+        try_(ListUnrolled_append(tail.base, meta_refPtr(&item)));
+    }
+    // Old last node is short, so it is refilled from the first moved node
+    let junction = list.last;
+    try_(TEST_expect(junction->len < list.node_cap / 2));
+    ListUnrolled_concatByMoving(list.base, tail.base);
+    try_(TEST_expect(ListUnrolled_len(list.base) == 110 && ListUnrolled_len(tail.base) == 0 && tail.first == null));
+    try_(TEST_expect(list.node_cap / 2 <= junction->len && test_isDense(list.base)));
+
+    var_(head, i32) = -1;
+    try_(ListUnrolled_prepend(list.base, meta_refPtr(&head)));
+    var expected = as$(i32, -1);
+    var iter     = ListUnrolled_iter(list.base);
+    for (var item = ListUnrolled_Iter_next(&iter); isSome(item); item = ListUnrolled_Iter_next(&iter)) {
+        try_(TEST_expect(*meta_castPtr$(i32*, unwrap(item)) == expected));
+        expected = expected < 199 ? expected + 2 : expected + 1;
+    }
+    try_(TEST_expect(expected == 210));
+
+    let popped = meta_castOpt$(Opt$Ptr$i32, ListUnrolled_pop(list.base));
+    try_(TEST_expect(isSome(popped) && *unwrap(popped) == 209 && ListUnrolled_len(list.base) == 110));
+
+    // Cleared nodes stay with the list and are reused before the pool is asked again
+    ListUnrolled_clearRetainingCap(list.base);
+    let slots = heap_Pool_queryCap(&pool);
+    for (i32 i = 0; i < 100; ++i) {
+        var_(item, i32) = i;
+        try_(ListUnrolled_append(list.base, meta_refPtr(&item)));
+    }
+    try_(TEST_expect(ListUnrolled_len(list.base) == 100 && heap_Pool_queryCap(&pool) == slots));
+    for (i32 i = 100; i < 200; ++i) {
+        var_(item, i32) = i;
+        try_(ListUnrolled_append(list.base, meta_refPtr(&item)));
+    }
+
+    // Prepending into the full first node splits it evenly instead of starting a one item node
+    try_(TEST_expect(list.first->len == list.node_cap));
+    try_(ListUnrolled_prepend(list.base, meta_refPtr(&head)));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, ListUnrolled_front(list.base))) == -1));
+    try_(TEST_expect(ListUnrolled_len(list.base) == 201 && test_isDense(list.base)));
+
+    // Appending past a full node in the middle splits it evenly too
+    var middle = list.first;
+    while (middle->len < list.node_cap) { middle = middle->next; }
+    try_(TEST_expect(middle->next != null));
+    let last_of_middle = *meta_castPtr$(i32*, ListUnrolled_get(list.base, (ListUnrolled_Pos){ .node = middle, .index = middle->len - 1 }));
+    let appended       = try_(ListUnrolled_insertAt(list.base, (ListUnrolled_Pos){ .node = middle, .index = middle->len }, meta_refPtr(&marker)));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, appended)) == -1));
+    try_(TEST_expect(*meta_castPtr$(i32*, ListUnrolled_get(list.base, ListUnrolled_next(list.base, appended))) == last_of_middle + 1));
+    try_(TEST_expect(ListUnrolled_len(list.base) == 202 && test_isDense(list.base)));
+} TEST_unscoped_ext;
@@ -0,0 +1,80 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/MpmcQueue.h"
+
+#include <pthread.h>
+
+// -pthread
+
+use_MpmcQueue$(u64);
+
+#define test_threads (4)
+#define test_items   (20000)
+
+fn_TEST_scope_ext("MpmcQueue Keeps FIFO Order And Reports Full And Empty") {
+    var_(classic, heap_Classic) = {};
+    var queue                   = type$(MpmcQueue$u64, try_(MpmcQueue_init(typeInfo$(u64), 5, heap_Classic_allocator(&classic))));
+    defer_(MpmcQueue_fini(queue.base));
+    try_(TEST_expect(MpmcQueue_cap(queue.base) == 8));
+
+    var_(item, u64) = 0;
+    try_(TEST_expect(!MpmcQueue_tryPop(queue.base, meta_refPtr(&item))));
+    // Wrap around the ring several times to cycle every cell sequence
+    for (u64 lap = 0; lap < 3; ++lap) {
+        for (u64 i = 0; i < 8; ++i) {
+            item = lap * 100 + i;
+            try_(TEST_expect(MpmcQueue_tryPush(queue.base, meta_refPtr(&item))));
+        }
+        try_(TEST_expect(!MpmcQueue_tryPush(queue.base, meta_refPtr(&item))));
+        try_(TEST_expect(MpmcQueue_lenApprox(queue.base) == 8));
+        for (u64 i = 0; i < 8; ++i) {
+            try_(TEST_expect(MpmcQueue_tryPop(queue.base, meta_refPtr(&item)) && item == lap * 100 + i));
+        }
+        try_(TEST_expect(!MpmcQueue_tryPop(queue.base, meta_refPtr(&item))));
+        try_(TEST_expect(MpmcQueue_lenApprox(queue.base) == 0));
+    }
+} TEST_unscoped_ext;
+
+static void* test_produce(void* arg) {
+    let queue = as$(MpmcQueue*, arg);
+    for (u64 i = 1; i <= test_items; ++i) {
+        MpmcQueue_push(queue, meta_refPtr(&i));
+    }
+    return null;
+}
+
+static void* test_consume(void* arg) {
+    let queue = as$(MpmcQueue*, arg);
+    var sum   = as$(u64, 0);
+    for (usize i = 0; i < test_items; ++i) {
+        var_(item, u64) = 0;
+        MpmcQueue_pop(queue, meta_refPtr(&item));
+        sum += item;
+    }
+    return as$(void*, as$(usize, sum));
+}
+
+fn_TEST_scope_ext("MpmcQueue Delivers Every Item Once Across Threads") {
+    var_(classic, heap_Classic) = {};
+    var queue                   = type$(MpmcQueue$u64, try_(MpmcQueue_init(typeInfo$(u64), 64, heap_Classic_allocator(&classic))));
+    defer_(MpmcQueue_fini(queue.base));
+
+    pthread_t producers[test_threads] = {};
+    pthread_t consumers[test_threads] = {};
+    for (usize i = 0; i < test_threads; ++i) {
+        pthread_create(&producers[i], null, test_produce, queue.base);
+        pthread_create(&consumers[i], null, test_consume, queue.base);
+    }
+    var sum = as$(u64, 0);
+    for (usize i = 0; i < test_threads; ++i) {
+        void* part = null;
+        pthread_join(producers[i], null);
+        pthread_join(consumers[i], &part);
+        sum += as$(usize, part);
+    }
+    // Each producer pushes 1..test_items, so a lost or duplicated item changes the total
+    try_(TEST_expect(sum == as$(u64, test_threads) * test_items * (test_items + 1) / 2));
+    try_(TEST_expect(MpmcQueue_lenApprox(queue.base) == 0));
+} TEST_unscoped_ext;
@@ -0,0 +1,50 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/MultiArrList.h"
+
+typedef struct Particle {
+    u8  tag;
+    f64 pos;
+    f32 mass;
+} Particle;
+use_MultiArrList$(Particle);
+
+static const MultiArrList_Field particle_fields[] = {
+    MultiArrList_field$(Particle, tag),
+    MultiArrList_field$(Particle, pos),
+    MultiArrList_field$(Particle, mass),
+};
+
+static fn_(cmpF32(anyptr_const lhs, anyptr_const rhs), cmp_Ord) {
+    return prim_cmp(*as$(const f32*, lhs), *as$(const f32*, rhs));
+}
+
+fn_TEST_scope_ext("MultiArrList Stores Fields As Columns") {
+    var_(classic, heap_Classic) = {};
+    var list                    = type$(MultiArrList$Particle, MultiArrList_init(typeInfo$(Particle), particle_fields, countOf(particle_fields), heap_Classic_allocator(&classic)));
+    defer_(MultiArrList_fini(list.base));
+
+    // Enough items to grow (and move every column) a few times
+    for (u8 i = 0; i < 40; ++i) {
+        var particle = (Particle){ .tag = i, .pos = i * 0.5, .mass = as$(f32, 40 - i) };
+        try_(MultiArrList_append(list.base, meta_refPtr(&particle)));
+    }
+    let masses = MultiArrList_items$(Sli$f32, list.base, 2);
+    try_(TEST_expect(masses.len == 40 && masses.ptr[3] == 37.0f));
+
+    // Last item fills the hole
+    MultiArrList_removeSwap(list.base, 0);
+    var_(particle, Particle) = {};
+    MultiArrList_get(list.base, 0, meta_refPtr(&particle));
+    try_(TEST_expect(particle.tag == 39 && particle.pos == 19.5 && particle.mass == 1.0f));
+
+    // Every column follows the key column
+    try_(MultiArrList_sort(list.base, 2, wrapFn(cmpF32)));
+    for (usize i = 0; i < list.len; ++i) {
+        MultiArrList_get(list.base, i, meta_refPtr(&particle));
+        try_(TEST_expect(particle.mass == as$(f32, i + 1) && particle.tag == 39 - i));
+        try_(TEST_expect(particle.pos == particle.tag * 0.5));
+    }
+} TEST_unscoped_ext;
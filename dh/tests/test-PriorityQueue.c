@@ -0,0 +1,42 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/PriorityQueue.h"
+
+use_PriorityQueue$(i32);
+use_Opt$(Ptr$i32);
+
+static fn_(cmpI32(anyptr_const lhs, anyptr_const rhs), cmp_Ord) {
+    return prim_cmp(*as$(const i32*, lhs), *as$(const i32*, rhs));
+}
+
+fn_TEST_scope_ext("PriorityQueue Pops In Order For Both Arities") {
+    static const PriorityQueue_Arity arities[] = { PriorityQueue_Arity_binary, PriorityQueue_Arity_quaternary };
+    static const i32                 values[]  = { 42, 7, 19, 3, 88, 7, 51, 0, 64, 23, 11, 5, 97, 30 };
+    for (usize a = 0; a < countOf(arities); ++a) {
+        var_(classic, heap_Classic) = {};
+        var items                   = (meta_Sli_const){ .type = typeInfo$(i32), .addr = values, .len = countOf(values) };
+        var queue                   = type$(PriorityQueue$i32, try_(PriorityQueue_initSli(items, wrapFn(cmpI32), arities[a], heap_Classic_allocator(&classic))));
+        defer_(PriorityQueue_fini(queue.base));
+
+        // Handle of values[4] (88) jumps to the front, values[3] (3) leaves early
+        PriorityQueue_decreaseKey(queue.base, (PriorityQueue_Handle){ .id = 4 }, meta_create$(i32, -1));
+        PriorityQueue_remove(queue.base, (PriorityQueue_Handle){ .id = 3 });
+        var_(pushed, i32) = 50;
+        let handle        = try_(PriorityQueue_push(queue.base, meta_refPtr(&pushed)));
+        PriorityQueue_update(queue.base, handle, meta_create$(i32, 100));
+
+        var prev  = as$(i32, -2);
+        var count = as$(usize, 0);
+        for (var item = meta_castOpt$(Opt$Ptr$i32, PriorityQueue_pop(queue.base)); isSome(item); item = meta_castOpt$(Opt$Ptr$i32, PriorityQueue_pop(queue.base))) {
+            try_(TEST_expect(prev <= *unwrap(item)));
+            if (count == 0) { try_(TEST_expect(*unwrap(item) == -1)); }
+            prev = *unwrap(item);
+            count++;
+        }
+        try_(TEST_expect(count == countOf(values)));
+        try_(TEST_expect(prev == 100));
+        try_(TEST_expect(!PriorityQueue_isQueued(queue.base, handle)));
+    }
+} TEST_unscoped_ext;
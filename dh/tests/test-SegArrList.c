@@ -0,0 +1,46 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/SegArrList.h"
+
+use_SegArrList$(i32);
+use_Opt$(Ptr$i32);
+
+fn_TEST_scope_ext("SegArrList Keeps Item Addresses Across Growth") {
+    var_(classic, heap_Classic) = {};
+    var list                    = type$(SegArrList$i32, SegArrList_init(typeInfo$(i32), heap_Classic_allocator(&classic)));
+    defer_(SegArrList_fini(list.base));
+
+    var first = -1;
+    try_(SegArrList_append(list.base, meta_refPtr(&first)));
+    let first_ptr = SegArrList_at$(i32*, list.base, 0);
+
+    // Segments of 8, 16, 32, 64, 128 hold 248 items
+    for (i32 i = 1; i < 200; ++i) {
+        *meta_castPtr$(i32*, try_(SegArrList_addBackOne(list.base))) = i;
+    }
+    try_(TEST_expect(list.len == 200 && list.segs_len == 5));
+    try_(TEST_expect(SegArrList_cap(list.base) == 248));
+    try_(TEST_expect(SegArrList_at$(i32*, list.base, 0) == first_ptr && *first_ptr == -1));
+
+    // Segment boundaries: index 7 ends the first segment, 8 starts the second
+    try_(TEST_expect(SegArrList_at$(i32*, list.base, 7) == list.segs[0] + 7));
+    try_(TEST_expect(SegArrList_at$(i32*, list.base, 8) == list.segs[1]));
+    try_(TEST_expect(SegArrList_at$(i32*, list.base, 120) == list.segs[4]));
+    try_(TEST_expect(*SegArrList_at$(i32*, list.base, 199) == 199));
+
+    var expected = -1;
+    var iter     = SegArrList_iter(list.base);
+    for (var item = SegArrList_Iter_next(&iter); isSome(item); item = SegArrList_Iter_next(&iter)) {
+        try_(TEST_expect(*meta_castPtr$(i32*, unwrap(item)) == expected));
+        expected = expected == -1 ? 1 : expected + 1;
+    }
+    try_(TEST_expect(expected == 200));
+
+    let popped = meta_castOpt$(Opt$Ptr$i32, SegArrList_popOrNull(list.base));
+    try_(TEST_expect(isSome(popped) && *unwrap(popped) == 199 && list.len == 199));
+
+    SegArrList_clearAndFree(list.base);
+    try_(TEST_expect(list.len == 0 && SegArrList_cap(list.base) == 0));
+} TEST_unscoped_ext;
@@ -0,0 +1,53 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/SlotMap.h"
+
+use_SlotMap$(i32);
+use_Opt$(Ptr$i32);
+
+fn_TEST_scope_ext("SlotMap Detects Stale Handles And Reuses Slots") {
+    var_(classic, heap_Classic) = {};
+    var map                     = type$(SlotMap$i32, SlotMap_init(typeInfo$(i32), heap_Classic_allocator(&classic)));
+    defer_(SlotMap_fini(map.base));
+
+    SlotMap_Handle handles[8] = { 0 };
+    for (i32 i = 0; i < 8; ++i) {
+        var_(item, i32) = i * 10;
+        let handle      = try_(SlotMap_insert(map.base, meta_refPtr(&item)));
+        handles[i]      = handle;
+    }
+    try_(TEST_expect(SlotMap_len(map.base) == 8));
+
+    // Removing item 2 moves the last item into its place, its handle still finds it
+    try_(TEST_expect(SlotMap_remove(map.base, handles[2])));
+    try_(TEST_expect(!SlotMap_remove(map.base, handles[2])));
+    try_(TEST_expect(isNone(SlotMap_get(map.base, handles[2]))));
+    let last = meta_castOpt$(Opt$Ptr$i32, SlotMap_get(map.base, handles[7]));
+    try_(TEST_expect(isSome(last) && *unwrap(last) == 70 && unwrap(last) == map.items.items.ptr + 2));
+
+    // New item reuses the freed slot with a newer generation
+    var_(item, i32) = 99;
+    let reused      = try_(SlotMap_insert(map.base, meta_refPtr(&item)));
+    try_(TEST_expect(reused.index == handles[2].index && reused.gen != handles[2].gen));
+    try_(TEST_expect(!SlotMap_contains(map.base, handles[2]) && SlotMap_contains(map.base, reused)));
+    try_(TEST_expect(SlotMap_Handle_eq(SlotMap_Handle_fromBits(SlotMap_Handle_toBits(reused)), reused)));
+    try_(TEST_expect(!SlotMap_contains(map.base, SlotMap_Handle_none)));
+
+    // Dense items map back to the handles that reach them
+    var sum = as$(i32, 0);
+    for_slice_indexed (map.items.items, live, index) {
+        let handle = SlotMap_handleAt(map.base, index);
+        let found  = meta_castOpt$(Opt$Ptr$i32, SlotMap_get(map.base, handle));
+        try_(TEST_expect(isSome(found) && unwrap(found) == live));
+        sum += *live;
+    }
+    try_(TEST_expect(sum == 280 - 20 + 99));
+
+    SlotMap_clearRetainingCap(map.base);
+    try_(TEST_expect(SlotMap_len(map.base) == 0 && !SlotMap_contains(map.base, reused)));
+    for (usize i = 0; i < countOf(handles); ++i) {
+        try_(TEST_expect(!SlotMap_contains(map.base, handles[i])));
+    }
+} TEST_unscoped_ext;
@@ -0,0 +1,46 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/SmallArrList.h"
+
+use_SmallArrList$(4, i32);
+use_Opt$(Ptr$i32);
+
+fn_TEST_scope_ext("SmallArrList Stays Inline Until It Spills") {
+    var_(classic, heap_Classic)    = {};
+    var_(list, SmallArrList$4$i32) = {};
+    SmallArrList_init$(&list, heap_Classic_allocator(&classic));
+    defer_(SmallArrList_fini(list.base));
+
+    // Up to 4 items live in the list itself
+    for (i32 i = 0; i < 4; ++i) {
+        try_(SmallArrList_append(list.base, meta_refPtr(&i)));
+    }
+    try_(TEST_expect(SmallArrList_isInline(list.base)));
+    try_(TEST_expect(list.items.ptr == list.inline_items && list.items.len == 4));
+
+    // Fifth item moves everything to the allocator
+    var front = -1;
+    try_(SmallArrList_insert(list.base, 0, meta_refPtr(&front)));
+    try_(TEST_expect(!SmallArrList_isInline(list.base)));
+    try_(TEST_expect(list.items.ptr != list.inline_items && 5 <= list.cap));
+    for (usize i = 0; i < list.items.len; ++i) {
+        try_(TEST_expect(list.items.ptr[i] == as$(i32, i) - 1));
+    }
+
+    // Removed items stay readable just past the end
+    let swapped = meta_castPtr$(i32*, SmallArrList_removeSwap(list.base, 0));
+    try_(TEST_expect(*swapped == -1 && list.items.ptr[0] == 3));
+    let shifted = meta_castPtr$(i32*, SmallArrList_removeOrdered(list.base, 0));
+    try_(TEST_expect(*shifted == 3 && list.items.ptr[0] == 0 && list.items.len == 3));
+    let popped = meta_castOpt$(Opt$Ptr$i32, SmallArrList_popOrNull(list.base));
+    try_(TEST_expect(isSome(popped) && *unwrap(popped) == 2));
+
+    // Owned slice takes the items and the list returns to inline storage
+    let owned = meta_castSli$(Sli$i32, try_(SmallArrList_toOwnedSli(list.base)));
+    defer_(mem_Allocator_free(heap_Classic_allocator(&classic), anySli(owned)));
+    try_(TEST_expect(owned.len == 2 && owned.ptr[0] == 0 && owned.ptr[1] == 1));
+    try_(TEST_expect(SmallArrList_isInline(list.base) && list.items.len == 0));
+    try_(TEST_expect(list.items.ptr == list.inline_items));
+} TEST_unscoped_ext;
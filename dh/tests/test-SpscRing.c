@@ -0,0 +1,82 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/SpscRing.h"
+
+#include <pthread.h>
+
+// -pthread
+
+use_SpscRing$(u64);
+
+#define test_items (200000)
+#define test_batch (32)
+
+fn_TEST_scope_ext("SpscRing Reserves And Peeks Contiguous Runs Across The Wrap") {
+    var_(classic, heap_Classic) = {};
+    var ring                    = type$(SpscRing$u64, try_(SpscRing_init(typeInfo$(u64), 8, heap_Classic_allocator(&classic))));
+    defer_(SpscRing_fini(ring.base));
+    try_(TEST_expect(SpscRing_cap(ring.base) == 8));
+
+    // Fill and drain six slots so the next reservation starts near the end of the ring
+    var dst = meta_castSli$(Sli$u64, SpscRing_reserve(ring.base, 6));
+    try_(TEST_expect(dst.len == 6));
+    for_slice_indexed (dst, item, i) { *item = i; }
+    SpscRing_commit(ring.base, dst.len);
+    var src = meta_castSli$(Sli$u64, SpscRing_peek(ring.base, 16));
+    try_(TEST_expect(src.len == 6 && src.ptr[5] == 5));
+    SpscRing_consume(ring.base, src.len);
+
+    // Reservation stops at the end of the ring, the rest starts over at the front
+    dst = meta_castSli$(Sli$u64, SpscRing_reserve(ring.base, 5));
+    try_(TEST_expect(dst.len == 2));
+    for_slice_indexed (dst, item, i) { *item = 10 + i; }
+    SpscRing_commit(ring.base, dst.len);
+    dst = meta_castSli$(Sli$u64, SpscRing_reserve(ring.base, 16));
+    try_(TEST_expect(dst.len == 6));
+    for_slice_indexed (dst, item, i) { *item = 12 + i; }
+    SpscRing_commit(ring.base, dst.len);
+
+    var_(item, u64) = 0;
+    try_(TEST_expect(SpscRing_lenApprox(ring.base) == 8 && SpscRing_reserve(ring.base, 1).len == 0));
+    try_(TEST_expect(!SpscRing_tryPush(ring.base, meta_refPtr(&item))));
+
+    // Partial consume keeps the remaining items in place for the next peek
+    src = meta_castSli$(Sli$u64, SpscRing_peek(ring.base, 16));
+    try_(TEST_expect(src.len == 2 && src.ptr[0] == 10));
+    SpscRing_consume(ring.base, 1);
+    try_(TEST_expect(SpscRing_tryPop(ring.base, meta_refPtr(&item)) && item == 11));
+    for (u64 expected = 12; expected < 18; ++expected) {
+        try_(TEST_expect(SpscRing_tryPop(ring.base, meta_refPtr(&item)) && item == expected));
+    }
+    try_(TEST_expect(!SpscRing_tryPop(ring.base, meta_refPtr(&item))));
+    try_(TEST_expect(SpscRing_lenApprox(ring.base) == 0));
+} TEST_unscoped_ext;
+
+static void* test_produce(void* arg) {
+    let ring = as$(SpscRing*, arg);
+    for (u64 next = 0; next < test_items;) {
+        let dst = meta_castSli$(Sli$u64, SpscRing_reserve(ring, prim_min(test_batch, test_items - next)));
+        for_slice (dst, item) { *item = next++; }
+        SpscRing_commit(ring, dst.len);
+    }
+    return null;
+}
+
+fn_TEST_scope_ext("SpscRing Hands Batches To Another Thread In Order") {
+    var_(classic, heap_Classic) = {};
+    var ring                    = type$(SpscRing$u64, try_(SpscRing_init(typeInfo$(u64), 64, heap_Classic_allocator(&classic))));
+    defer_(SpscRing_fini(ring.base));
+
+    pthread_t producer = {};
+    pthread_create(&producer, null, test_produce, ring.base);
+    var in_order = true;
+    for (u64 expected = 0; expected < test_items;) {
+        let src = meta_castSli$(Sli$u64, SpscRing_peek(ring.base, test_batch));
+        for_slice (src, item) { in_order = in_order && *item == expected++; }
+        SpscRing_consume(ring.base, src.len);
+    }
+    pthread_join(producer, null);
+    try_(TEST_expect(in_order && SpscRing_lenApprox(ring.base) == 0));
+} TEST_unscoped_ext;
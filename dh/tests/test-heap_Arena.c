@@ -0,0 +1,137 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Classic.h"
+#include "dh/heap/Arena.h"
+#include "dh/mem/Allocator.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+// -pthread
+
+fn_TEST_scope_ext("Arena Savepoint Rolls Back Nested Allocations") {
+    var_(classic, heap_Classic) = {};
+    var_(arena, heap_Arena)     = heap_Arena_init(heap_Classic_allocator(&classic));
+    defer_(heap_Arena_fini(arena));
+
+    let allocator = heap_Arena_allocator(&arena);
+    let kept      = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 32)));
+    let mark      = heap_Arena_mark(&arena);
+    let cap       = heap_Arena_queryCap(&arena);
+
+    // Enough nested allocations to force new buffers
+    for (usize i = 0; i < 64; ++i) {
+        $ignore try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 256));
+    }
+    let grown_cap = heap_Arena_queryCap(&arena);
+    try_(TEST_expect(cap < grown_cap));
+
+    heap_Arena_restore(&arena, mark);
+    try_(TEST_expect(heap_Arena_queryCap(&arena) < grown_cap));
+
+    // Next allocation continues right after the allocation made before the mark
+    let next = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 1)));
+    try_(TEST_expect(next.ptr == kept.ptr + kept.len));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Arena Gives Back A Padded Batch Freed At Once") {
+    var_(classic, heap_Classic) = {};
+    var_(arena, heap_Arena)     = heap_Arena_init(heap_Classic_allocator(&classic));
+    defer_(heap_Arena_fini(arena));
+
+    let allocator = heap_Arena_allocator(&arena);
+    let kept      = unwrap(mem_Allocator_rawAlloc(allocator, 16, 8));
+
+    // Items of 12 bytes at 8 byte alignment leave 4 bytes of padding between them
+    var_(ptrs, Arr$$(4, Ptr$u8)) = Arr_zero();
+    let bufs                     = Sli_arr$(Sli$Ptr$u8, ptrs);
+    try_(TEST_expect(mem_Allocator_rawAllocMany(allocator, 12, 8, bufs)));
+    try_(TEST_expect(bufs.ptr[0] == kept + 16 && bufs.ptr[3] == kept + 16 + 3 * 16));
+    mem_Allocator_rawFreeMany(allocator, bufs, 12, 8);
+
+    // Next allocation reuses the start of the batch
+    let next = unwrap(mem_Allocator_rawAlloc(allocator, 1, 1));
+    try_(TEST_expect(next == kept + 16));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Scratch Arenas Avoid Conflicting Arena") {
+    defer_(heap_Arena_scratchFini());
+
+    heap_Arena_scratch_defer(outer, null);
+    heap_Arena_scratch_defer(inner, outer.arena);
+    try_(TEST_expect(outer.arena != inner.arena));
+
+    let sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(heap_Arena_Scratch_allocator(inner), typeInfo$(u8), 64)));
+    try_(TEST_expect(sli.len == 64));
+} TEST_unscoped_ext;
+
+#define test_thrd_count  (4)
+#define test_thrd_allocs (2000)
+
+typedef struct TestBlock {
+    usize addr;
+    usize len;
+} TestBlock;
+
+typedef struct TestThrd {
+    mem_Allocator allocator;
+    u8            id;
+    TestBlock*    blocks;
+} TestThrd;
+
+static void* test_allocMany(void* arg) {
+    let thrd = as$(TestThrd*, arg);
+    for (usize i = 0; i < test_thrd_allocs; ++i) {
+        let len = 1 + (i * 7) % 64;
+        let ptr = unwrap(mem_Allocator_rawAlloc(thrd->allocator, len, 8));
+        bti_memset(ptr, thrd->id, len);
+        thrd->blocks[i] = (TestBlock){ .addr = rawptrToInt(ptr), .len = len };
+    }
+    return null;
+}
+
+static fn_(test_compareBlocks(const void* lhs, const void* rhs), int) {
+    return prim_cmp(as$(const TestBlock*, lhs)->addr, as$(const TestBlock*, rhs)->addr);
+}
+
+fn_TEST_scope_ext("Thread-Safe Arena Hands Out Disjoint Blocks To Concurrent Threads") {
+    var_(classic, heap_Classic)      = {};
+    var_(arena, heap_Arena_ThrdSafe) = heap_Arena_ThrdSafe_init(heap_Classic_allocator(&classic));
+    defer_(heap_Arena_ThrdSafe_fini(arena));
+
+    static TestBlock blocks[test_thrd_count * test_thrd_allocs] = {};
+    pthread_t        thrds[test_thrd_count]                     = {};
+    TestThrd         args[test_thrd_count]                      = {};
+    for (usize t = 0; t < test_thrd_count; ++t) {
+        args[t] = (TestThrd){
+            .allocator = heap_Arena_ThrdSafe_allocator(&arena),
+            .id        = as$(u8, t + 1),
+            .blocks    = blocks + t * test_thrd_allocs,
+        };
+        pthread_create(&thrds[t], null, test_allocMany, &args[t]);
+    }
+    for (usize t = 0; t < test_thrd_count; ++t) {
+        pthread_join(thrds[t], null);
+    }
+
+    // Every block still holds its owner's bytes, so no other thread wrote over it
+    var total = as$(usize, 0);
+    for (usize t = 0; t < test_thrd_count; ++t) {
+        for (usize i = 0; i < test_thrd_allocs; ++i) {
+            let block = args[t].blocks[i];
+            let bytes = intToRawptr$(const u8*, block.addr);
+            for (usize b = 0; b < block.len; ++b) {
+                try_(TEST_expect(bytes[b] == args[t].id));
+            }
+            total += block.len;
+        }
+    }
+    try_(TEST_expect(total <= heap_Arena_ThrdSafe_queryCap(&arena)));
+
+    // Sorted by address, each block ends before the next one starts
+    qsort(blocks, countOf(blocks), sizeOf(TestBlock), test_compareBlocks);
+    for (usize i = 1; i < countOf(blocks); ++i) {
+        try_(TEST_expect(blocks[i - 1].addr + blocks[i - 1].len <= blocks[i].addr));
+    }
+} TEST_unscoped_ext;
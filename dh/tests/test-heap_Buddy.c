@@ -0,0 +1,45 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/Arr.h"
+#include "dh/heap/Buddy.h"
+#include "dh/mem/Allocator.h"
+
+fn_TEST_scope_ext("Buddy Allocator Merges Freed Blocks") {
+    var_(buffer, Arr$$(4096, u8)) = Arr_zero();
+    var_(buddy, heap_Buddy)       = heap_Buddy_init(Sli_arr$(Sli$u8, buffer));
+    let allocator                 = heap_Buddy_allocator(&buddy);
+    let initial                   = heap_Buddy_queryStats(&buddy);
+
+    // Freeing out of allocation order is fine, unlike heap_Fixed
+    let first  = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 100)));
+    let second = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 40)));
+    let used   = heap_Buddy_queryStats(&buddy);
+    try_(TEST_expect(used.alloc_count == 2));
+    try_(TEST_expect(used.used_len == 128 + 64));
+    try_(TEST_expect(used.requested_len == 140));
+
+    mem_Allocator_free(allocator, anySli(first));
+    mem_Allocator_free(allocator, anySli(second));
+    let freed = heap_Buddy_queryStats(&buddy);
+    try_(TEST_expect(freed.used_len == 0));
+    try_(TEST_expect(freed.largest_free_len == initial.largest_free_len));
+    try_(TEST_expect(freed.free_block_count == initial.free_block_count));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Buddy Allocator Resizes In Place") {
+    var_(buffer, Arr$$(4096, u8)) = Arr_zero();
+    var_(buddy, heap_Buddy)       = heap_Buddy_init(Sli_arr$(Sli$u8, buffer));
+    let allocator                 = heap_Buddy_allocator(&buddy);
+
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 32)));
+    defer_(mem_Allocator_free(allocator, anySli(sli)));
+
+    // Grows by absorbing free upper buddies, shrinks by splitting them off again
+    try_(TEST_expect(mem_Allocator_resize(allocator, anySli(sli), 256)));
+    sli.len = 256;
+    try_(TEST_expect(heap_Buddy_queryStats(&buddy).used_len == 256));
+    try_(TEST_expect(mem_Allocator_resize(allocator, anySli(sli), 48)));
+    sli.len = 48;
+    try_(TEST_expect(heap_Buddy_queryStats(&buddy).used_len == 64));
+} TEST_unscoped_ext;
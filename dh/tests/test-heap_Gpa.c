@@ -0,0 +1,63 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Gpa.h"
+#include "dh/mem/Allocator.h"
+
+fn_TEST_scope_ext("Gpa Allocator Honors Alignment Up To The Largest Class") {
+    var_(gpa, heap_Gpa) = {};
+    let allocator       = heap_Gpa_allocator(&gpa);
+
+    // Enough blocks per alignment to run past the first span of each class
+    u8* ptrs[24] = {};
+    for (u32 align = 16; align <= (1u << heap_Gpa_max_class_log2); align <<= 1) {
+        for (usize i = 0; i < countOf(ptrs); ++i) {
+            ptrs[i] = unwrap(mem_Allocator_rawAlloc(allocator, 1 + i, align));
+            try_(TEST_expect(mem_isAligned(rawptrToInt(ptrs[i]), align)));
+        }
+        for (usize i = 0; i < countOf(ptrs); ++i) {
+            mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = ptrs[i], .len = 1 + i }, align);
+        }
+    }
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Gpa Allocator Resizes Only Within A Size Class") {
+    var_(gpa, heap_Gpa) = {};
+    let allocator       = heap_Gpa_allocator(&gpa);
+
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 20)));
+    for_slice_indexed (sli, byte, i) { *byte = as$(u8, i); }
+
+    // 20 and 32 bytes share the 32 byte class, 33 bytes does not
+    try_(TEST_expect(mem_Allocator_resize(allocator, anySli(sli), 32)));
+    sli.len = 32;
+    try_(TEST_expect(!mem_Allocator_resize(allocator, anySli(sli), 33)));
+
+    // Moving to a larger class keeps the contents, into the large passthrough too
+    sli = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), 100)));
+    try_(TEST_expect(sli.ptr[0] == 0 && sli.ptr[19] == 19));
+    let large_len = as$(usize, 1) << (heap_Gpa_max_class_log2 + 1);
+    sli           = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), large_len)));
+    try_(TEST_expect(sli.ptr[0] == 0 && sli.ptr[19] == 19));
+
+    // Large blocks may not shrink into a size class in place
+    try_(TEST_expect(!mem_Allocator_resize(allocator, anySli(sli), 64)));
+    mem_Allocator_free(allocator, anySli(sli));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Gpa Allocator Reuses Blocks From The Thread Cache") {
+    var_(gpa, heap_Gpa) = {};
+    let allocator       = heap_Gpa_allocator(&gpa);
+
+    let first = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 48)));
+    mem_Allocator_free(allocator, anySli(first));
+    // Same thread, same class: the block just freed is handed out first
+    let second = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 60)));
+    try_(TEST_expect(first.ptr == second.ptr));
+
+    // Other classes keep their own free lists
+    let other = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 16)));
+    try_(TEST_expect(other.ptr != second.ptr));
+    mem_Allocator_free(allocator, anySli(other));
+    mem_Allocator_free(allocator, anySli(second));
+} TEST_unscoped_ext;
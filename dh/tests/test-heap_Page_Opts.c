@@ -0,0 +1,71 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Page.h"
+#include "dh/mem/Allocator.h"
+
+#if bti_plat_linux
+#include <sys/mman.h> // For mincore
+#endif /* bti_plat_linux */
+
+fn_TEST_scope_ext("Page Allocator Queries A Valid Huge Page Size") {
+    let size = heap_Page_hugePageSize();
+    try_(TEST_expect(mem_isValidAlign(size) && mem_page_size <= size));
+    try_(TEST_expect(heap_Page_hugePageSize() == size));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Page Allocator Rounds Huge Mappings To The Huge Page Size") {
+    // Not a real huge page size, so the mapping falls back to normal pages of the same length
+    let huge_len          = 4 * mem_page_size;
+    var_(page, heap_Page) = heap_Page_init((heap_Page_Opts){ .huge_pages = true, .huge_page_size = huge_len });
+    let allocator         = heap_Page_allocator(&page);
+
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 1)));
+    defer_(mem_Allocator_free(allocator, anySli(sli)));
+    Sli_setAt(sli, 0, 0x5A);
+
+    // The whole huge page is mapped, growth past it would need a new mapping
+    try_(TEST_expect(mem_Allocator_resize(allocator, anySli(sli), huge_len)));
+    try_(TEST_expect(!mem_Allocator_resize(allocator, anySli(sli), huge_len + 1)));
+    try_(TEST_expect(Sli_getAt(sli, 0) == 0x5A));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Page Allocator Refuses Lengths That Overflow When Rounded") {
+    var_(plain, heap_Page) = heap_Page_init((heap_Page_Opts){});
+    try_(TEST_expect(isNone(mem_Allocator_rawAlloc(heap_Page_allocator(&plain), usize_limit - 1, 1))));
+
+    // Fits when rounded to normal pages, overflows when rounded to huge pages
+    let huge_len          = 4 * mem_page_size;
+    var_(huge, heap_Page) = heap_Page_init((heap_Page_Opts){ .huge_pages = true, .huge_page_size = huge_len });
+    try_(TEST_expect(isNone(mem_Allocator_rawAlloc(heap_Page_allocator(&huge), usize_limit - 2 * mem_page_size, 1))));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Page Allocator Discards The Pages Of Retained Mappings") {
+    var_(page, heap_Page) = heap_Page_init((heap_Page_Opts){ .retain_freed = true });
+    defer_(heap_Page_trim(&page));
+    let allocator = heap_Page_allocator(&page);
+    let len       = 8 * mem_page_size;
+
+    let first = unwrap(mem_Allocator_rawAlloc(allocator, len, 1));
+    bti_memset(first, 0x5A, len);
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = first, .len = len }, 1);
+
+#if bti_plat_linux
+    // Every page but the header page has left memory
+    u8 resident[8] = {};
+    try_(TEST_expect(mincore(first, len, resident) == 0));
+    var discarded = true;
+    for (usize i = 1; i < countOf(resident); ++i) { discarded = discarded && (resident[i] & 1) == 0; }
+    try_(TEST_expect(discarded));
+#endif /* bti_plat_linux */
+
+    // Same length reuses the retained address range, discarded pages come back zeroed
+    let second = unwrap(mem_Allocator_rawAlloc(allocator, len, 1));
+    try_(TEST_expect(second == first));
+#if bti_plat_linux
+    var zeroed = true;
+    for (usize i = mem_page_size; i < len; ++i) { zeroed = zeroed && second[i] == 0; }
+    try_(TEST_expect(zeroed));
+#endif /* bti_plat_linux */
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = second, .len = len }, 1);
+} TEST_unscoped_ext;
@@ -0,0 +1,25 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/heap/Page.h"
+#include "dh/mem/Allocator.h"
+
+fn_TEST_scope_ext("Reserving Page Allocator Grows In Place") {
+    var_(reserve, heap_Page_Reserve) = heap_Page_Reserve_init(64 * mem_page_size);
+    let allocator                    = heap_Page_Reserve_allocator(&reserve);
+
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 16)));
+    defer_(mem_Allocator_free(allocator, anySli(sli)));
+    try_(TEST_expect(mem_isAligned(rawptrToInt(sli.ptr), mem_page_size)));
+    Sli_setAt(sli, 0, 0x5A);
+
+    // Growth commits following pages without moving the buffer
+    let grown = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), 32 * mem_page_size)));
+    try_(TEST_expect(grown.ptr == sli.ptr));
+    try_(TEST_expect(Sli_getAt(grown, 0) == 0x5A));
+    Sli_setAt(grown, grown.len - 1, 0xA5);
+    sli = grown;
+
+    // Growth beyond the reservation is refused
+    try_(TEST_expect(!mem_Allocator_resize(allocator, anySli(sli), 128 * mem_page_size)));
+} TEST_unscoped_ext;
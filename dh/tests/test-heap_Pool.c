@@ -0,0 +1,86 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/Arr.h"
+#include "dh/heap/Classic.h"
+#include "dh/heap/Pool.h"
+#include "dh/mem/Allocator.h"
+
+typedef struct TestNode {
+    f64    value;
+    usize  index;
+    anyptr next;
+} TestNode;
+
+fn_TEST_scope_ext("Pool Allocator Slot Reuse") {
+    var_(classic, heap_Classic) = {};
+    var_(pool, heap_Pool)       = heap_Pool_init(heap_Classic_allocator(&classic), typeInfo$(TestNode));
+    defer_(heap_Pool_fini(pool));
+
+    let allocator = heap_Pool_allocator(&pool);
+    let first     = meta_castPtr$(TestNode*, try_(mem_Allocator_create(allocator, typeInfo$(TestNode))));
+    let second    = meta_castPtr$(TestNode*, try_(mem_Allocator_create(allocator, typeInfo$(TestNode))));
+    try_(TEST_expect(first != second));
+    try_(TEST_expect(heap_Pool_ownsPtr(&pool, as$(u8*, first))));
+
+    // Freed slot is handed out again in O(1)
+    mem_Allocator_destroy(allocator, anyPtr(first));
+    let third = meta_castPtr$(TestNode*, try_(mem_Allocator_create(allocator, typeInfo$(TestNode))));
+    try_(TEST_expect(first == third));
+
+    // Oversized requests are rejected
+    try_(TEST_expect(isNone(mem_Allocator_rawAlloc(allocator, sizeOf(TestNode) * 2, alignOf(TestNode)))));
+
+    mem_Allocator_destroy(allocator, anyPtr(second));
+    mem_Allocator_destroy(allocator, anyPtr(third));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Pool Allocator Slab Growth and Reset") {
+    var_(classic, heap_Classic) = {};
+    var_(pool, heap_Pool)       = heap_Pool_init(heap_Classic_allocator(&classic), typeInfo$(TestNode));
+    defer_(heap_Pool_fini(pool));
+
+    let allocator = heap_Pool_allocator(&pool);
+    let count     = as$(usize, heap_Pool_min_slots_per_slab * 3);
+    for (usize i = 0; i < count; ++i) {
+        let node    = meta_castPtr$(TestNode*, try_(mem_Allocator_create(allocator, typeInfo$(TestNode))));
+        node->index = i;
+        try_(TEST_expect(mem_isAligned(rawptrToInt(node), alignOf(TestNode))));
+    }
+    let cap = heap_Pool_queryCap(&pool);
+    try_(TEST_expect(count <= cap));
+
+    // Retained slabs serve allocations without touching the child allocator
+    heap_Pool_reset(&pool, tagUnion$(heap_Pool_ResetMode, heap_Pool_ResetMode_retain_capacity, {}));
+    try_(TEST_expect(heap_Pool_queryCap(&pool) == cap));
+    for (usize i = 0; i < count; ++i) {
+        $ignore try_(mem_Allocator_create(allocator, typeInfo$(TestNode)));
+    }
+    try_(TEST_expect(heap_Pool_queryCap(&pool) == cap));
+
+    heap_Pool_reset(&pool, tagUnion$(heap_Pool_ResetMode, heap_Pool_ResetMode_free_all, {}));
+    try_(TEST_expect(heap_Pool_queryCap(&pool) == 0));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Pool Allocator Batched Create") {
+    var_(classic, heap_Classic) = {};
+    var_(pool, heap_Pool)       = heap_Pool_init(heap_Classic_allocator(&classic), typeInfo$(TestNode));
+    defer_(heap_Pool_fini(pool));
+
+    // Batch spans more than the first slab
+    let allocator                   = heap_Pool_allocator(&pool);
+    var_(nodes, Arr$$(100, Ptr$u8)) = Arr_zero();
+    let batch                       = Sli_arr$(Sli$Ptr$u8, nodes);
+    try_(mem_Allocator_createMany(allocator, typeInfo$(TestNode), batch));
+    for (usize i = 0; i < batch.len; ++i) {
+        try_(TEST_expect(heap_Pool_ownsPtr(&pool, batch.ptr[i])));
+        as$(TestNode*, batch.ptr[i])->index = i;
+    }
+    try_(TEST_expect(as$(TestNode*, batch.ptr[99])->index == 99));
+
+    // Whole batch goes back to free list and is reused first
+    let first = batch.ptr[0];
+    mem_Allocator_destroyMany(allocator, typeInfo$(TestNode), batch);
+    let reused = meta_castPtr$(TestNode*, try_(mem_Allocator_create(allocator, typeInfo$(TestNode))));
+    try_(TEST_expect(as$(u8*, reused) == first));
+} TEST_unscoped_ext;
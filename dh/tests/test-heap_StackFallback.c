@@ -0,0 +1,105 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/Arr.h"
+#include "dh/heap/Classic.h"
+#include "dh/heap/Fixed.h"
+#include "dh/heap/StackFallback.h"
+#include "dh/mem/Allocator.h"
+
+fn_TEST_scope_ext("Stack Fallback Spills To Fallback Allocator") {
+    var_(buffer, Arr$$(64, u8))     = Arr_zero();
+    var_(classic, heap_Classic)     = {};
+    var_(stack, heap_StackFallback) = heap_StackFallback_init(Sli_arr$(Sli$u8, buffer), heap_Classic_allocator(&classic));
+    let allocator                   = heap_StackFallback_allocator(&stack);
+
+    // Small request is served inline
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 16)));
+    defer_(mem_Allocator_free(allocator, anySli(sli)));
+    try_(TEST_expect(heap_StackFallback_ownsInline(&stack, sli.ptr)));
+    for_slice_indexed (sli, item, idx) { deref(item) = as$(u8, idx); }
+
+    // Growing past inline buffer moves data to fallback allocator
+    let grown = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), 256)));
+    try_(TEST_expect(!heap_StackFallback_ownsInline(&stack, grown.ptr)));
+    for (usize i = 0; i < 16; ++i) { try_(TEST_expect(Sli_getAt(grown, i) == i)); }
+    sli = grown;
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Stack Fallback Routes Frees To The Owning Allocator") {
+    // Fixed fallback, so its end index shows which side a call reached
+    var_(inline_buf, Arr$$(64, u8))    = Arr_zero();
+    var_(fallback_buf, Arr$$(512, u8)) = Arr_zero();
+    var_(fallback, heap_Fixed)         = heap_Fixed_init(Sli_arr$(Sli$u8, fallback_buf));
+    var_(stack, heap_StackFallback)    = heap_StackFallback_init(Sli_arr$(Sli$u8, inline_buf), heap_Fixed_allocator(&fallback));
+    let allocator                      = heap_StackFallback_allocator(&stack);
+
+    let small = unwrap(mem_Allocator_rawAlloc(allocator, 16, 1));
+    let large = unwrap(mem_Allocator_rawAlloc(allocator, 128, 1));
+    try_(TEST_expect(heap_StackFallback_ownsInline(&stack, small) && !heap_StackFallback_ownsInline(&stack, large)));
+    try_(TEST_expect(stack.fixed.end_index == 16 && fallback.end_index == 128));
+
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = large, .len = 128 }, 1);
+    try_(TEST_expect(stack.fixed.end_index == 16 && fallback.end_index == 0));
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = small, .len = 16 }, 1);
+    try_(TEST_expect(stack.fixed.end_index == 0 && fallback.end_index == 0));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Stack Fallback Keeps Contents When Resizing Across The Inline Boundary") {
+    var_(inline_buf, Arr$$(64, u8))    = Arr_zero();
+    var_(fallback_buf, Arr$$(512, u8)) = Arr_zero();
+    var_(fallback, heap_Fixed)         = heap_Fixed_init(Sli_arr$(Sli$u8, fallback_buf));
+    var_(stack, heap_StackFallback)    = heap_StackFallback_init(Sli_arr$(Sli$u8, inline_buf), heap_Fixed_allocator(&fallback));
+    let allocator                      = heap_StackFallback_allocator(&stack);
+
+    var sli = meta_cast$(Sli$u8, try_(mem_Allocator_alloc(allocator, typeInfo$(u8), 16)));
+    for_slice_indexed (sli, item, idx) { deref(item) = as$(u8, idx); }
+
+    // Growing within inline buffer stays in place
+    try_(TEST_expect(mem_Allocator_rawResize(allocator, sli, 1, 48)));
+    sli.len = 48;
+    try_(TEST_expect(heap_StackFallback_ownsInline(&stack, sli.ptr) && stack.fixed.end_index == 48));
+
+    // Inline side cannot grow past its buffer, neither in place nor by remapping
+    try_(TEST_expect(!mem_Allocator_rawResize(allocator, sli, 1, 256)));
+    try_(TEST_expect(isNone(mem_Allocator_rawRemap(allocator, sli, 1, 256))));
+    try_(TEST_expect(stack.fixed.end_index == 48 && fallback.end_index == 0));
+
+    // Moving out copies the contents and releases the inline space
+    sli = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), 256)));
+    try_(TEST_expect(!heap_StackFallback_ownsInline(&stack, sli.ptr) && heap_Fixed_ownsPtr(&fallback, sli.ptr)));
+    try_(TEST_expect(stack.fixed.end_index == 0));
+    for (usize i = 0; i < 16; ++i) { try_(TEST_expect(Sli_getAt(sli, i) == i)); }
+
+    // Shrinking the moved buffer stays with the fallback
+    sli = meta_cast$(Sli$u8, try_(mem_Allocator_realloc(allocator, anySli(sli), 8)));
+    try_(TEST_expect(heap_Fixed_ownsPtr(&fallback, sli.ptr) && stack.fixed.end_index == 0));
+    for (usize i = 0; i < 8; ++i) { try_(TEST_expect(Sli_getAt(sli, i) == i)); }
+    mem_Allocator_free(allocator, anySli(sli));
+    try_(TEST_expect(fallback.end_index == 0));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Stack Fallback Reuses Inline Space After Reset") {
+    var_(inline_buf, Arr$$(64, u8))    = Arr_zero();
+    var_(fallback_buf, Arr$$(512, u8)) = Arr_zero();
+    var_(fallback, heap_Fixed)         = heap_Fixed_init(Sli_arr$(Sli$u8, fallback_buf));
+    var_(stack, heap_StackFallback)    = heap_StackFallback_init(Sli_arr$(Sli$u8, inline_buf), heap_Fixed_allocator(&fallback));
+    let allocator                      = heap_StackFallback_allocator(&stack);
+
+    // Older inline allocations are not the last one, so freeing them does not reclaim space
+    let first  = unwrap(mem_Allocator_rawAlloc(allocator, 32, 1));
+    let second = unwrap(mem_Allocator_rawAlloc(allocator, 32, 1));
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = first, .len = 32 }, 1);
+    let spilled = unwrap(mem_Allocator_rawAlloc(allocator, 32, 1));
+    try_(TEST_expect(!heap_StackFallback_ownsInline(&stack, spilled)));
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = spilled, .len = 32 }, 1);
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = second, .len = 32 }, 1);
+    try_(TEST_expect(stack.fixed.end_index == 32 && fallback.end_index == 0));
+
+    // Reset hands the whole inline buffer out again
+    heap_StackFallback_reset(&stack);
+    let reused = unwrap(mem_Allocator_rawAlloc(allocator, 64, 1));
+    defer_(mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = reused, .len = 64 }, 1));
+    try_(TEST_expect(reused == first && heap_StackFallback_ownsInline(&stack, reused)));
+    try_(TEST_expect(fallback.end_index == 0));
+} TEST_unscoped_ext;
@@ -0,0 +1,15 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/int.h"
+
+fn_TEST_scope_ext("Next Power Of Two Is None Once It Overflows") {
+    try_(TEST_expect(unwrap(usize_chkdNextPow2(0)) == 1));
+    try_(TEST_expect(unwrap(usize_chkdNextPow2(1)) == 1));
+    try_(TEST_expect(unwrap(usize_chkdNextPow2(5)) == 8));
+    try_(TEST_expect(unwrap(usize_chkdNextPow2(64)) == 64));
+    try_(TEST_expect(unwrap(usize_chkdNextPow2(usize_limit / 2 + 1)) == usize_limit / 2 + 1));
+    // Would wrap around to zero
+    try_(TEST_expect(isNone(usize_chkdNextPow2(usize_limit / 2 + 2))));
+    try_(TEST_expect(isNone(usize_chkdNextPow2(usize_limit))));
+} TEST_unscoped_ext;
@@ -1,6 +1,7 @@
 #include "dh/main.h"
 
 #include "dh/Arr.h"
+#include "dh/heap/Classic.h"
 #include "dh/heap/Fixed.h"
 #include "dh/mem/Allocator.h"
 
@@ -32,3 +33,33 @@ fn_TEST_scope_ext("Basic Allocator Reallocation Usage") {
 
     for (usize i = 0; i < 10; ++i) { try_(TEST_expect(Sli_getAt(sli, i) == i)); }
 } TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Batched Create Falls Back To Single Allocations") {
+    // heap_Classic has no batch entry, so every buffer is dispatched on its own
+    var_(classic, heap_Classic)   = {};
+    let allocator                 = heap_Classic_allocator(&classic);
+    var_(ptrs, Arr$$(32, Ptr$u8)) = Arr_zero();
+    let batch                     = Sli_arr$(Sli$Ptr$u8, ptrs);
+    try_(mem_Allocator_createMany(allocator, typeInfo$(u64), batch));
+    for (usize i = 0; i < batch.len; ++i) {
+        try_(TEST_expect(batch.ptr[i] != null));
+        try_(TEST_expect(mem_isAligned(rawptrToInt(batch.ptr[i]), alignOf(u64))));
+        *as$(u64*, batch.ptr[i]) = i;
+    }
+    for (usize i = 1; i < batch.len; ++i) {
+        try_(TEST_expect(batch.ptr[i] != batch.ptr[i - 1]));
+        try_(TEST_expect(*as$(u64*, batch.ptr[i]) == i));
+    }
+    mem_Allocator_destroyMany(allocator, typeInfo$(u64), batch);
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Batched Create Fallback Rolls Back On Failure") {
+    var_(buffer, Arr$$(1024, u8)) = Arr_zero();
+    var_(fixed, heap_Fixed)       = heap_Fixed_init(Sli_arr$(Sli$u8, buffer));
+    let allocator                 = heap_Fixed_allocator(&fixed);
+
+    // Only part of the batch fits, the buffers already taken are given back
+    var_(ptrs, Arr$$(32, Ptr$u8)) = Arr_zero();
+    try_(TEST_expect(isErr(mem_Allocator_createMany(allocator, (TypeInfo){ .size = 64, .align = 1 }, Sli_arr$(Sli$Ptr$u8, ptrs)))));
+    try_(TEST_expect(fixed.end_index == 0));
+} TEST_unscoped_ext;
@@ -0,0 +1,111 @@
+#include "dh/main.h"
+#include "dh/TEST.h"
+
+#include "dh/Str.h"
+#include "dh/Arr.h"
+#include "dh/heap/Classic.h"
+#include "dh/mem/Allocator.h"
+#include "dh/mem/Tracker.h"
+
+#if defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled
+#else
+
+#define test_log_path "log/test-mem_Tracker.log"
+
+/// Contents of a log file, truncated to the buffer
+static fn_(test_readLog(const char* path, Sli$u8 buf), Str_const) {
+    let file = fopen(path, "r");
+    if (!file) { return (Str_const){ .ptr = buf.ptr, .len = 0 }; }
+    let len = fread(buf.ptr, 1, buf.len, file);
+    $ignore fclose(file);
+    return (Str_const){ .ptr = buf.ptr, .len = len };
+}
+
+fn_TEST_scope_ext("Tracker Counts Live Allocations Through The Allocator") {
+    let tracker     = mem_Tracker_instance();
+    let base_bytes  = atomic_load(tracker->total_allocated, atomic_MemOrd_acquire);
+    let base_allocs = atomic_load(tracker->active_allocs, atomic_MemOrd_acquire);
+
+    var_(classic, heap_Classic) = {};
+    let allocator               = heap_Classic_allocator(&classic);
+
+    let ptr = unwrap(mem_Allocator_rawAlloc(allocator, 48, 8));
+    try_(TEST_expect(atomic_load(tracker->total_allocated, atomic_MemOrd_acquire) == base_bytes + 48));
+    try_(TEST_expect(atomic_load(tracker->active_allocs, atomic_MemOrd_acquire) == base_allocs + 1));
+
+    // Moved or not, the block stays one live allocation of the new size
+    let moved = unwrap(mem_Allocator_rawRemap(allocator, (Sli$u8){ .ptr = ptr, .len = 48 }, 8, 200));
+    try_(TEST_expect(atomic_load(tracker->total_allocated, atomic_MemOrd_acquire) == base_bytes + 200));
+    try_(TEST_expect(atomic_load(tracker->active_allocs, atomic_MemOrd_acquire) == base_allocs + 1));
+
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = moved, .len = 200 }, 8);
+    try_(TEST_expect(atomic_load(tracker->total_allocated, atomic_MemOrd_acquire) == base_bytes));
+    try_(TEST_expect(atomic_load(tracker->active_allocs, atomic_MemOrd_acquire) == base_allocs));
+} TEST_unscoped_ext;
+
+/// Allocation site the heap profile should attribute the sample to
+static no_inline fn_(test_allocSampled(mem_Allocator allocator), u8*) {
+    return unwrap(mem_Allocator_rawAlloc(allocator, 64, 8));
+}
+
+fn_TEST_scope_ext("Tracker Profile Writes Sampled Stacks") {
+    // Sampling every byte, so the allocation below is sampled for sure
+    try_(mem_Tracker_startProfile((mem_Tracker_ProfileCfg){
+        .sample_interval      = 1,
+        .snapshot_interval    = 0,
+        .snapshot_path_prefix = Str_l("log/test-mem_Tracker"),
+    }));
+    defer_(mem_Tracker_stopProfile());
+
+    var_(classic, heap_Classic) = {};
+    let allocator               = heap_Classic_allocator(&classic);
+    let ptr                     = test_allocSampled(allocator);
+    defer_(mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = ptr, .len = 64 }, 8));
+
+    try_(mem_Tracker_writeProfile(Str_l("log/test-mem_Tracker.folded")));
+    static u8 folded_buf[64 * 1024] = {};
+    let       folded                = test_readLog("log/test-mem_Tracker.folded", (Sli$u8){ .ptr = folded_buf, .len = countOf(folded_buf) });
+    // Each stack ends with the allocation site
+    try_(TEST_expect(Str_contains(folded, Str_l("test_allocSampled [test-mem_Tracker.c:"))));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Tracker Profile Rejects Paths Too Long") {
+    static u8 long_path[300] = {};
+    bti_memset(long_path, 'a', countOf(long_path));
+
+    try_(TEST_expect(isErr(mem_Tracker_startProfile((mem_Tracker_ProfileCfg){
+        .snapshot_path_prefix = (Str_const){ .ptr = long_path, .len = 192 },
+    }))));
+    try_(TEST_expect(isErr(mem_Tracker_writeProfile((Str_const){ .ptr = long_path, .len = 256 }))));
+    try_(TEST_expect(isErr(mem_Tracker_writeProfile((Str_const){ .ptr = long_path, .len = countOf(long_path) }))));
+} TEST_unscoped_ext;
+
+fn_TEST_scope_ext("Tracker Report Names Unfreed Blocks") {
+    // Fresh tables, so the report only lists blocks of this test
+    try_(mem_Tracker_initWithPath(Str_l(test_log_path)));
+    var_(classic, heap_Classic) = {};
+    let allocator               = heap_Classic_allocator(&classic);
+
+    let leaked = unwrap(mem_Allocator_rawAlloc(allocator, 24, 8));
+    let freed  = unwrap(mem_Allocator_rawAlloc(allocator, 40, 8));
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = freed, .len = 40 }, 8);
+    mem_Tracker_finiAndGenerateReport();
+
+    // Report is final, clean up untracked and resume tracking into the default log
+    Arr$$(64, u8) leaked_line = Arr_zero();
+    Arr$$(64, u8) freed_line  = Arr_zero();
+    $ignore snprintf(as$(char*, leaked_line.buf), Arr_len(leaked_line), "Address: %p\n", as$(anyptr, leaked));
+    $ignore snprintf(as$(char*, freed_line.buf), Arr_len(freed_line), "Address: %p\n", as$(anyptr, freed));
+    mem_Allocator_rawFree(allocator, (Sli$u8){ .ptr = leaked, .len = 24 }, 8);
+    try_(mem_Tracker_initWithPath(Str_l("log/mem.log")));
+
+    static u8 log_buf[64 * 1024] = {};
+    let       report            = test_readLog(test_log_path, (Sli$u8){ .ptr = log_buf, .len = countOf(log_buf) });
+    try_(TEST_expect(Str_contains(report, Str_l("Detected Memory Leaks:"))));
+    try_(TEST_expect(Str_contains(report, Str_viewZ(leaked_line.buf))));
+    try_(TEST_expect(Str_contains(report, Str_l("Size: 24 bytes"))));
+    try_(TEST_expect(Str_contains(report, Str_l("test-mem_Tracker.c"))));
+    try_(TEST_expect(!Str_contains(report, Str_viewZ(freed_line.buf))));
+} TEST_unscoped_ext;
+
+#endif /* defined(MEM_NO_TRACE_ALLOC_AND_FREE) || !debug_comp_enabled */